@@ -3,21 +3,40 @@
 // 어쨌든 지금은 잘 된다.
 
 #include "DebugSerial.h"
+#include "LogRingBuffer.h"
+#include "ledPatternEngine.h"
 #include <Arduino.h>
+#include <stdarg.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
 
 int DebugSerial::_ledPin = -1;
 bool DebugSerial::_ledActive = false;
+uint32_t DebugSerial::_droppedTotal = 0;
+uint8_t DebugSerial::_logLevel = DEBUG_SERIAL_LEVEL_VERBOSE;
+
+// 로그 레코드 버퍼와 출력 태스크
+static LogRingBuffer logBuffer;
+static TaskHandle_t drainTaskHandle = NULL;
+static SemaphoreHandle_t drainMutex = NULL;  // 소비자(출력 태스크, flush())는 한 번에 하나만
+static const uint32_t DRAIN_INTERVAL_MS = 10;
+static const size_t FORMAT_BUFFER_SIZE = 160;
 
 void DebugSerial::begin(unsigned long baudrate, int ledPin) {
     // Initialize serial communication
     Serial.begin(baudrate);
     
-    // Set LED pin if provided
+    // Start the low-priority task that writes queued log records
+    if (drainTaskHandle == NULL) {
+        drainMutex = xSemaphoreCreateMutex();
+        xTaskCreate(_drainTask, "LogDrain", 2048, NULL, 1, &drainTaskHandle);
+    }
+    
+    // Set LED pin if provided (blinks are played in the background by StatusLed)
     if (ledPin >= 0) {
         _ledPin = ledPin;
-        pinMode(_ledPin, OUTPUT);
-        _ledActive = true;
-        digitalWrite(_ledPin, LOW);
+        _ledActive = StatusLed.begin(_ledPin);
     }
     
     // Visual feedback
@@ -27,10 +46,12 @@ void DebugSerial::begin(unsigned long baudrate, int ledPin) {
 bool DebugSerial::waitForConnection(unsigned long timeout) {
     unsigned long startTime = millis();
     
-    // Wait for serial connection with timeout
+    // Wait for serial connection with timeout, blinking until it connects
+    if (_ledActive) StatusLed.blink(0, 100, 100);
     while (!Serial && (millis() - startTime < timeout)) {
-        _blinkLED(1, 100, 100);
+        delay(10);
     }
+    if (_ledActive) StatusLed.clear();
     
     // Connection feedback
     if (Serial) {
@@ -44,6 +65,9 @@ bool DebugSerial::waitForConnection(unsigned long timeout) {
 void DebugSerial::printSystemInfo() {
     if (!Serial) return;
     
+    // Keep queued messages ahead of the direct prints below
+    flush();
+    
     Serial.println("\n=================================");
     Serial.println("SYSTEM INFORMATION");
     Serial.println("=================================");
@@ -76,31 +100,129 @@ void DebugSerial::printSystemInfo() {
 }
 
 void DebugSerial::printDebug(const String& message) {
-    if (!Serial) return;
-    Serial.print("[");
-    Serial.print(millis() / 1000.0, 3);
-    Serial.print("] ");
-    Serial.print(message);
-    Serial.flush();
+    _enqueue(message.c_str(), message.length(), false);
 }
 
 void DebugSerial::printlnDebug(const String& message) {
-    printDebug(message + "\n");
+    _enqueue(message.c_str(), message.length(), true);
 }
 
-void DebugSerial::blinkPattern(int times, int onTime, int offTime) {
-    if (_ledActive) {
-        _blinkLED(times, onTime, offTime);
-    }
+void DebugSerial::printfDebug(const char* format, ...) {
+    char message[FORMAT_BUFFER_SIZE];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+    if (length < 0) return;
+    if ((size_t)length >= sizeof(message)) length = sizeof(message) - 1;  // truncated
+    _enqueue(message, length, false);
+}
+
+void DebugSerial::printDebugFromISR(const char* message) {
+    char stamp[20];
+    size_t stampLength = _formatTimestamp(stamp, sizeof(stamp));
+    LogRingBuffer::Segment segments[] = {
+        {stamp, stampLength},
+        {message, strlen(message)},
+        {"\n", 1},
+    };
+    logBuffer.push(segments, 3);
+}
+
+void DebugSerial::flush() {
+    _drain();
+    Serial.flush();
+}
+
+uint32_t DebugSerial::getDroppedCount() {
+    return _droppedTotal;
+}
+
+// Build one "[sec.msec] message" record; drops (and counts) instead of blocking when full
+void DebugSerial::_enqueue(const char* message, size_t length, bool newline) {
+    if (!Serial) return;
+    
+    char stamp[20];
+    size_t stampLength = _formatTimestamp(stamp, sizeof(stamp));
+    LogRingBuffer::Segment segments[] = {
+        {stamp, stampLength},
+        {message, length},
+        {"\n", newline ? 1u : 0u},
+    };
+    logBuffer.push(segments, 3);
+}
+
+// Trace frame: 0x00 marker (never appears in text output), format address,
+// timestamp in microseconds, payload length, payload
+void DebugSerial::_enqueueTrace(const char* format, const uint8_t* payload, size_t length) {
+    if (!Serial) return;
+    
+    uint8_t header[10];
+    uint32_t id = (uint32_t)(uintptr_t)format;
+    uint32_t timestamp = micros();
+    header[0] = 0x00;
+    memcpy(&header[1], &id, 4);
+    memcpy(&header[5], &timestamp, 4);
+    header[9] = (uint8_t)length;
+    LogRingBuffer::Segment segments[] = {
+        {(const char*)header, sizeof(header)},
+        {(const char*)payload, length},
+    };
+    logBuffer.push(segments, 2);
+}
+
+// Same "[12.345] " prefix as before. Digits are written by hand (no printf family),
+// so this is also safe from printDebugFromISR
+size_t DebugSerial::_formatTimestamp(char* out, size_t size) {
+    unsigned long now = millis();
+    unsigned long seconds = now / 1000;
+    unsigned long msec = now % 1000;
+    
+    char digits[10];  // seconds, least significant first (32-bit: at most 7 digits)
+    size_t count = 0;
+    do {
+        digits[count++] = (char)('0' + seconds % 10);
+        seconds /= 10;
+    } while (seconds > 0 && count < sizeof(digits));
+    
+    // '[' + seconds + ".mmm] "
+    size_t length = 1 + count + 6;
+    if (length > size) return 0;
+    
+    char* p = out;
+    *p++ = '[';
+    while (count > 0) *p++ = digits[--count];
+    *p++ = '.';
+    *p++ = (char)('0' + msec / 100);
+    *p++ = (char)('0' + msec / 10 % 10);
+    *p++ = (char)('0' + msec % 10);
+    *p++ = ']';
+    *p++ = ' ';
+    return length;
 }
 
-void DebugSerial::_blinkLED(int times, int onTime, int offTime) {
-    if (!_ledActive) return;
+void DebugSerial::_drain() {
+    bool locked = drainMutex && xSemaphoreTake(drainMutex, portMAX_DELAY) == pdTRUE;
+    
+    logBuffer.drain(Serial);
+    uint32_t dropped = logBuffer.takeDropped();
+    if (dropped > 0) {
+        _droppedTotal += dropped;
+        Serial.printf("[log] %u messages dropped\n", (unsigned)dropped);
+    }
     
-    for (int i = 0; i < times; i++) {
-        digitalWrite(_ledPin, HIGH);
-        delay(onTime);
-        digitalWrite(_ledPin, LOW);
-        if (i < times - 1) delay(offTime);
+    if (locked) xSemaphoreGive(drainMutex);
+}
+
+void DebugSerial::_drainTask(void*) {
+    while (true) {
+        vTaskDelay(DRAIN_INTERVAL_MS / portTICK_PERIOD_MS);
+        _drain();
+    }
+}
+
+void DebugSerial::blinkPattern(int times, int onTime, int offTime) {
+    if (_ledActive && times > 0) {
+        StatusLed.blink(times, onTime, offTime);
     }
 }
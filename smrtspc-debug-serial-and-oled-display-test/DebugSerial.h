@@ -2,6 +2,45 @@
 #define DEBUG_SERIAL_H
 
 #include <Arduino.h>
+#include <type_traits>
+
+// Log levels. DEBUG_SERIAL_LEVEL is fixed per translation unit at compile time: define it
+// before including this header (or with -DDEBUG_SERIAL_LEVEL=... for the whole build).
+// Calls above that level compile to nothing, argument expressions included, so production
+// firmware can be built with -DDEBUG_SERIAL_LEVEL=DEBUG_SERIAL_LEVEL_NONE without editing
+// call sites. setLogLevel() adds a runtime threshold on top.
+//   DEBUG_PRINT / DEBUG_PRINTLN / DEBUG_PRINTF / DEBUG_PRINT_ISR / DEBUG_TRACE -> DEBUG
+//   DEBUG_LOGE / DEBUG_LOGW / DEBUG_LOGI / DEBUG_LOGD                           -> their own level
+// Calling DebugSerial::printDebug() etc. directly always prints (no level check).
+#define DEBUG_SERIAL_LEVEL_NONE     0
+#define DEBUG_SERIAL_LEVEL_ERROR    1
+#define DEBUG_SERIAL_LEVEL_WARN     2
+#define DEBUG_SERIAL_LEVEL_INFO     3
+#define DEBUG_SERIAL_LEVEL_DEBUG    4
+#define DEBUG_SERIAL_LEVEL_VERBOSE  5
+
+#ifndef DEBUG_SERIAL_LEVEL
+#define DEBUG_SERIAL_LEVEL DEBUG_SERIAL_LEVEL_VERBOSE
+#endif
+
+// Guard for messages built over several statements:
+//   if (DEBUG_SERIAL_ENABLED(DEBUG_SERIAL_LEVEL_DEBUG)) { String msg = ...; ... }
+#define DEBUG_SERIAL_ENABLED(level) \
+    ((level) <= DEBUG_SERIAL_LEVEL && DebugSerial::isLevelEnabled(level))
+
+// Binary trace record: only the format string's flash address, a timestamp and the raw
+// argument bytes go over Serial; trace_decode.py rebuilds the text from the firmware ELF.
+//   DEBUG_TRACE("motor %u speed %d", motor, speed);
+// Supported arguments: integers (%d %u %x %c ..., 64-bit as %lld), float/double (%f, sent
+// as float32) and C strings (%s, truncated to 32 bytes).
+#if DEBUG_SERIAL_LEVEL >= DEBUG_SERIAL_LEVEL_DEBUG
+#define DEBUG_TRACE(format, ...) do { \
+        static const char _traceFormat[] __attribute__((section(".rodata.debug_trace"), used)) = format; \
+        if (DebugSerial::isLevelEnabled(DEBUG_SERIAL_LEVEL_DEBUG)) DebugSerial::trace(_traceFormat, ##__VA_ARGS__); \
+    } while (0)
+#else
+#define DEBUG_TRACE(format, ...) do {} while (0)
+#endif
 
 class DebugSerial {
 public:
@@ -20,14 +59,129 @@ public:
     // Print a debug message with timestamp and newline
     static void printlnDebug(const String& message);
     
-    // Blink LED pattern (for visual feedback)
+    // printf-style debug message with timestamp (formatted on the stack, no String)
+    static void printfDebug(const char* format, ...) __attribute__((format(printf, 1, 2)));
+    
+    // Queue a message from an interrupt handler (no printf formatting, never blocks)
+    static void printDebugFromISR(const char* message);
+    
+    // Write out everything queued so far (blocks until drained)
+    static void flush();
+    
+    // Messages dropped because the log buffer was full
+    static uint32_t getDroppedCount();
+    
+    // Queue a binary trace record (use the DEBUG_TRACE macro so the format lands in the table)
+    template <typename... Args>
+    static void trace(const char* format, Args... args) {
+        uint8_t payload[TRACE_MAX_PAYLOAD];
+        size_t length = 0;
+        (_packTraceArg(payload, length, args), ...);
+        _enqueueTrace(format, payload, length);
+    }
+    
+    static constexpr size_t TRACE_MAX_PAYLOAD = 64;
+    static constexpr size_t TRACE_MAX_STRING = 32;
+    
+    // Runtime threshold (default: DEBUG_SERIAL_LEVEL_VERBOSE, everything compiled in is printed)
+    static void setLogLevel(uint8_t level) { _logLevel = level; }
+    static uint8_t getLogLevel() { return _logLevel; }
+    static bool isLevelEnabled(uint8_t level) { return level <= _logLevel; }
+    
+    // Blink LED pattern (for visual feedback, queued and played in the background)
     static void blinkPattern(int times = 1, int onTime = 100, int offTime = 100);
     
 private:
     static int _ledPin;
     static bool _ledActive;
+    static uint32_t _droppedTotal;
+    static uint8_t _logLevel;
+    
+    // Messages are queued in a ring buffer and written by a low-priority task
+    static void _enqueue(const char* message, size_t length, bool newline);
+    static size_t _formatTimestamp(char* out, size_t size);
+    static void _enqueueTrace(const char* format, const uint8_t* payload, size_t length);
+    static void _drain();
+    static void _drainTask(void* parameter);
     
-    static void _blinkLED(int times = 1, int onTime = 100, int offTime = 100);
+    // Little-endian argument packing; arguments that do not fit are dropped
+    static void _putTraceBytes(uint8_t* payload, size_t& length, const void* data, size_t size) {
+        if (length + size > TRACE_MAX_PAYLOAD) return;
+        memcpy(payload + length, data, size);
+        length += size;
+    }
+    
+    template <typename T>
+    static void _packTraceArg(uint8_t* payload, size_t& length, T value) {
+        if constexpr (std::is_floating_point<T>::value) {
+            float f = (float)value;
+            _putTraceBytes(payload, length, &f, sizeof(f));
+        } else if constexpr (std::is_integral<T>::value || std::is_enum<T>::value) {
+            if constexpr (sizeof(T) > 4) {
+                uint64_t v = (uint64_t)value;
+                _putTraceBytes(payload, length, &v, sizeof(v));
+            } else {
+                uint32_t v = std::is_signed<T>::value ? (uint32_t)(int32_t)value : (uint32_t)value;
+                _putTraceBytes(payload, length, &v, sizeof(v));
+            }
+        } else if constexpr (std::is_convertible<T, const char*>::value) {
+            const char* str = value ? (const char*)value : "";
+            uint8_t n = (uint8_t)strnlen(str, TRACE_MAX_STRING);
+            if (length + 1 + n > TRACE_MAX_PAYLOAD) return;
+            payload[length++] = n;
+            _putTraceBytes(payload, length, str, n);
+        } else {
+            uint32_t v = (uint32_t)(uintptr_t)value;  // other pointers (%p)
+            _putTraceBytes(payload, length, &v, sizeof(v));
+        }
+    }
 };
 
+#define DEBUG_SERIAL_LOG(level, tag, format, ...) do { \
+        if (DebugSerial::isLevelEnabled(level)) DebugSerial::printfDebug(tag format "\n", ##__VA_ARGS__); \
+    } while (0)
+
+// DEBUG-level wrappers for the DebugSerial print functions. Below that level the call and
+// its argument expressions compile to nothing.
+#if DEBUG_SERIAL_LEVEL >= DEBUG_SERIAL_LEVEL_DEBUG
+#define DEBUG_PRINT(message) do { \
+        if (DebugSerial::isLevelEnabled(DEBUG_SERIAL_LEVEL_DEBUG)) DebugSerial::printDebug(message); \
+    } while (0)
+#define DEBUG_PRINTLN(message) do { \
+        if (DebugSerial::isLevelEnabled(DEBUG_SERIAL_LEVEL_DEBUG)) DebugSerial::printlnDebug(message); \
+    } while (0)
+#define DEBUG_PRINTF(format, ...) do { \
+        if (DebugSerial::isLevelEnabled(DEBUG_SERIAL_LEVEL_DEBUG)) DebugSerial::printfDebug(format, ##__VA_ARGS__); \
+    } while (0)
+#define DEBUG_PRINT_ISR(message) do { \
+        if (DebugSerial::isLevelEnabled(DEBUG_SERIAL_LEVEL_DEBUG)) DebugSerial::printDebugFromISR(message); \
+    } while (0)
+#else
+#define DEBUG_PRINT(message) do {} while (0)
+#define DEBUG_PRINTLN(message) do {} while (0)
+#define DEBUG_PRINTF(format, ...) do {} while (0)
+#define DEBUG_PRINT_ISR(message) do {} while (0)
+#endif
+
+#if DEBUG_SERIAL_LEVEL >= DEBUG_SERIAL_LEVEL_ERROR
+#define DEBUG_LOGE(format, ...) DEBUG_SERIAL_LOG(DEBUG_SERIAL_LEVEL_ERROR, "[E] ", format, ##__VA_ARGS__)
+#else
+#define DEBUG_LOGE(format, ...) do {} while (0)
+#endif
+#if DEBUG_SERIAL_LEVEL >= DEBUG_SERIAL_LEVEL_WARN
+#define DEBUG_LOGW(format, ...) DEBUG_SERIAL_LOG(DEBUG_SERIAL_LEVEL_WARN, "[W] ", format, ##__VA_ARGS__)
+#else
+#define DEBUG_LOGW(format, ...) do {} while (0)
+#endif
+#if DEBUG_SERIAL_LEVEL >= DEBUG_SERIAL_LEVEL_INFO
+#define DEBUG_LOGI(format, ...) DEBUG_SERIAL_LOG(DEBUG_SERIAL_LEVEL_INFO, "[I] ", format, ##__VA_ARGS__)
+#else
+#define DEBUG_LOGI(format, ...) do {} while (0)
+#endif
+#if DEBUG_SERIAL_LEVEL >= DEBUG_SERIAL_LEVEL_DEBUG
+#define DEBUG_LOGD(format, ...) DEBUG_SERIAL_LOG(DEBUG_SERIAL_LEVEL_DEBUG, "[D] ", format, ##__VA_ARGS__)
+#else
+#define DEBUG_LOGD(format, ...) do {} while (0)
+#endif
+
 #endif // DEBUG_SERIAL_H
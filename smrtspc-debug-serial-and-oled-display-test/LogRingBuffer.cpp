@@ -0,0 +1,87 @@
+#include "LogRingBuffer.h"
+#include <string.h>
+
+LogRingBuffer::LogRingBuffer() : head(0), tail(0), dropped(0) {
+    memset(buffer, 0, sizeof(buffer));
+}
+
+bool LogRingBuffer::push(const Segment* segments, size_t count) {
+    size_t length = 0;
+    for (size_t i = 0; i < count; i++) {
+        length += segments[i].length;
+    }
+
+    const uint32_t total = recordSize(length);
+    if (total > capacity) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // 공간 예약: 다른 생산자와 경쟁하면 다시 시도, 가득 차면 기다리지 않고 드롭
+    uint32_t pos = head.load(std::memory_order_relaxed);
+    do {
+        if (pos - tail.load(std::memory_order_acquire) + total > capacity) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    } while (!head.compare_exchange_weak(pos, pos + total,
+                                         std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    uint32_t offset = pos + 4;
+    for (size_t i = 0; i < count; i++) {
+        copyIn(offset, segments[i].data, segments[i].length);
+        offset += segments[i].length;
+    }
+
+    // 본문을 다 쓴 뒤 헤더를 기록해야 소비자가 완성된 레코드만 본다
+    __atomic_store_n(headerAt(pos), uint32_t(length + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+size_t LogRingBuffer::drain(Print& out) {
+    size_t written = 0;
+    uint32_t pos = tail.load(std::memory_order_relaxed);
+
+    while (true) {
+        const uint32_t header = __atomic_load_n(headerAt(pos), __ATOMIC_ACQUIRE);
+        if (header == 0) break;  // 비어 있거나 아직 쓰는 중
+
+        const uint32_t length = header - 1;
+        const uint32_t start = (pos + 4) & mask;
+        const uint32_t first = length < capacity - start ? length : capacity - start;
+        out.write(&buffer[start], first);
+        if (first < length) {
+            out.write(&buffer[0], length - first);
+        }
+        written += length;
+
+        // 다음 바퀴의 레코드 헤더가 0(미커밋)으로 보이도록 사용한 영역을 비운다
+        const uint32_t total = recordSize(length);
+        clear(pos, total);
+        pos += total;
+        tail.store(pos, std::memory_order_release);
+    }
+    return written;
+}
+
+uint32_t LogRingBuffer::takeDropped() {
+    return dropped.exchange(0, std::memory_order_relaxed);
+}
+
+void LogRingBuffer::copyIn(uint32_t pos, const char* data, size_t length) {
+    const uint32_t start = pos & mask;
+    const size_t first = length < capacity - start ? length : capacity - start;
+    memcpy(&buffer[start], data, first);
+    if (first < length) {
+        memcpy(&buffer[0], data + first, length - first);
+    }
+}
+
+void LogRingBuffer::clear(uint32_t pos, uint32_t length) {
+    const uint32_t start = pos & mask;
+    const uint32_t first = length < capacity - start ? length : capacity - start;
+    memset(&buffer[start], 0, first);
+    if (first < length) {
+        memset(&buffer[0], 0, length - first);
+    }
+}
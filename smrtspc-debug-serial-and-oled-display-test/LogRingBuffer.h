@@ -0,0 +1,48 @@
+#ifndef LOG_RING_BUFFER_H
+#define LOG_RING_BUFFER_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// 여러 생산자(태스크, ISR)가 미리 포맷된 로그 레코드를 넣고, 하나의 소비자가 꺼내 쓰는 링 버퍼.
+// 생산자는 CAS로 공간을 예약한 뒤 내용을 쓰고 헤더를 마지막에 기록(커밋)한다. 공간이 없으면
+// 기다리지 않고 false를 반환하므로 호출한 쪽은 절대 블록되지 않는다.
+// (ESP32-C3는 RISC-V A 확장이 없어 atomic 연산이 짧은 인터럽트 마스킹으로 구현된다.)
+//
+// 레코드 형식: [uint32 헤더 = 길이 + 1][본문][4바이트 정렬 패딩]
+// 헤더가 0이면 아직 커밋되지 않은 레코드이므로 소비자는 거기서 멈춘다.
+class LogRingBuffer {
+public:
+    static constexpr uint32_t capacity = 2048;  // 2의 거듭제곱, 4의 배수
+
+    struct Segment {
+        const char* data;
+        size_t length;
+    };
+
+    LogRingBuffer();
+
+    // 여러 조각을 이어 붙여 레코드 하나로 추가. 공간이 부족하면 false (ISR에서도 호출 가능)
+    bool push(const Segment* segments, size_t count);
+
+    // 커밋된 레코드를 순서대로 out에 쓰고 쓴 바이트 수를 반환 (소비자는 한 번에 하나만)
+    size_t drain(Print& out);
+
+    // 공간 부족으로 버려진 레코드 수를 반환하고 0으로 초기화
+    uint32_t takeDropped();
+
+private:
+    static constexpr uint32_t mask = capacity - 1;
+
+    alignas(4) uint8_t buffer[capacity];
+    std::atomic<uint32_t> head;     // 예약된 끝 위치 (단조 증가, 2^32에서 자연스럽게 순환)
+    std::atomic<uint32_t> tail;     // 소비자가 읽은 위치
+    std::atomic<uint32_t> dropped;
+
+    static uint32_t recordSize(uint32_t length) { return 4 + ((length + 3) & ~3u); }
+    uint32_t* headerAt(uint32_t pos) { return reinterpret_cast<uint32_t*>(&buffer[pos & mask]); }
+    void copyIn(uint32_t pos, const char* data, size_t length);
+    void clear(uint32_t pos, uint32_t length);
+};
+
+#endif // LOG_RING_BUFFER_H
@@ -0,0 +1,194 @@
+#include "compositor.h"
+#include "fixedFormat.h"
+#include <string.h>
+
+bool Compositor::setScreen(const WidgetSpec* newWidgets, uint8_t count) {
+    if (!newWidgets || count > MAX_WIDGETS) return false;
+
+    widgets = newWidgets;
+    widgetCount = count;
+
+    memset(slotWidgets, 0, sizeof(slotWidgets));
+    uint8_t sparklines = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        const WidgetSpec& spec = widgets[i];
+        historyOf[i] = -1;
+        if (spec.slot >= 0 && spec.slot < MAX_SLOTS) slotWidgets[spec.slot] |= uint16_t(1u << i);
+        if (spec.kind == Kind::SPARKLINE && sparklines < MAX_SPARKLINES) {
+            histories[sparklines] = History();
+            historyOf[i] = int8_t(sparklines++);
+        }
+    }
+
+    for (uint8_t b = 0; b < backendCount; b++) layout(b);
+    invalidate();
+    return true;
+}
+
+int8_t Compositor::addBackend(CompositorBackend& backend, uint16_t minIntervalMs) {
+    if (backendCount >= MAX_BACKENDS) return -1;
+
+    BackendState& state = backendStates[backendCount];
+    state = BackendState();
+    state.backend = &backend;
+    state.minIntervalMs = minIntervalMs;
+    state.clearAll = true;
+    layout(backendCount);
+    state.dirty = widgetsFor(backendCount);
+    return int8_t(backendCount++);
+}
+
+void Compositor::set(uint8_t slot, int32_t value) {
+    if (slot >= MAX_SLOTS || slots[slot] == value) return;
+    slots[slot] = value;
+
+    const uint16_t bound = slotWidgets[slot];
+    for (uint8_t i = 0; i < widgetCount; i++) {
+        if (!(bound & (1u << i)) || historyOf[i] < 0) continue;
+        // 표시 범위로 먼저 자른 뒤 int16_t로 저장 (범위를 넘는 값이 잘려서 반대쪽 끝에 찍히지 않도록)
+        const WidgetSpec& spec = widgets[i];
+        int32_t sample = value;
+        if (sample < spec.min) sample = spec.min;
+        if (sample > spec.max) sample = spec.max;
+        History& history = histories[historyOf[i]];
+        history.samples[history.head] = int16_t(sample);
+        history.head = (history.head + 1) % SPARKLINE_SAMPLES;
+        if (history.count < SPARKLINE_SAMPLES) history.count++;
+    }
+
+    for (uint8_t b = 0; b < backendCount; b++) {
+        backendStates[b].dirty |= bound & widgetsFor(b);
+    }
+}
+
+uint16_t Compositor::update(uint32_t nowMs) {
+    uint16_t drawn = 0;
+
+    for (uint8_t b = 0; b < backendCount; b++) {
+        BackendState& state = backendStates[b];
+        if (!state.dirty && !state.clearAll) continue;
+
+        // 갱신 예산: 마지막 전송 후 minIntervalMs가 지나야 다시 그린다 (dirty는 그대로 유지)
+        if (state.presented && nowMs - state.lastPresentMs < state.minIntervalMs) {
+            state.stats.deferredUpdates++;
+            continue;
+        }
+
+        CompositorBackend& out = *state.backend;
+        if (state.clearAll) {
+            out.clearRect({0, 0, out.width(), out.height()});
+            state.clearAll = false;
+        }
+
+        for (uint8_t i = 0; i < widgetCount; i++) {
+            if (!(state.dirty & (1u << i))) continue;
+            draw(b, i);
+            drawn++;
+            state.stats.widgetsDrawn++;
+        }
+        state.dirty = 0;
+
+        out.present();
+        state.presented = true;
+        state.lastPresentMs = nowMs;
+        state.stats.frames++;
+    }
+    return drawn;
+}
+
+void Compositor::invalidate() {
+    for (uint8_t b = 0; b < backendCount; b++) {
+        backendStates[b].clearAll = true;
+        backendStates[b].dirty = widgetsFor(b);
+    }
+}
+
+uint16_t Compositor::widgetsFor(uint8_t backend) const {
+    uint16_t mask = 0;
+    for (uint8_t i = 0; i < widgetCount; i++) {
+        const uint8_t targets = widgets[i].backends;
+        if (targets == 0 || (targets & (1u << backend))) mask |= uint16_t(1u << i);
+    }
+    return mask;
+}
+
+// % 좌표를 이 디스플레이의 픽셀 좌표로 (한 번만 계산)
+void Compositor::layout(uint8_t backend) {
+    BackendState& state = backendStates[backend];
+    const int32_t width = state.backend->width();
+    const int32_t height = state.backend->height();
+
+    for (uint8_t i = 0; i < widgetCount; i++) {
+        const WidgetSpec& spec = widgets[i];
+        const int16_t left = int16_t(spec.x * width / 100);
+        const int16_t top = int16_t(spec.y * height / 100);
+        const int16_t right = int16_t((spec.x + spec.w) * width / 100);
+        const int16_t bottom = int16_t((spec.y + spec.h) * height / 100);
+        state.rects[i] = {left, top, int16_t(right - left), int16_t(bottom - top)};
+    }
+}
+
+void Compositor::draw(uint8_t backend, uint8_t widget) {
+    CompositorBackend& out = *backendStates[backend].backend;
+    const Rect& rect = backendStates[backend].rects[widget];
+    const WidgetSpec& spec = widgets[widget];
+    const int32_t value = spec.slot >= 0 ? get(uint8_t(spec.slot)) : 0;
+
+    out.clearRect(rect);
+
+    switch (spec.kind) {
+        case Kind::LABEL:
+            if (spec.text) out.drawText(rect, spec.text, spec.align, CompositorBackend::Ink::NORMAL);
+            break;
+
+        case Kind::VALUE: {
+            char text[24];
+            uint8_t length = formatGrouped(text, 0, value);
+            if (spec.text) {
+                const size_t unit = strlen(spec.text);
+                if (length + unit < sizeof(text)) memcpy(text + length, spec.text, unit + 1);
+            }
+            out.drawText(rect, text, spec.align, CompositorBackend::Ink::ACCENT);
+            break;
+        }
+
+        case Kind::BAR: {
+            out.drawFrame(rect, CompositorBackend::Ink::NORMAL);
+            const int32_t range = spec.max > spec.min ? spec.max - spec.min : 1;
+            int32_t clamped = value < spec.min ? spec.min : (value > spec.max ? spec.max : value);
+            const int16_t inner = rect.w > 2 ? rect.w - 2 : 0;
+            const int16_t filled = int16_t(int32_t(inner) * (clamped - spec.min) / range);
+            if (filled > 0 && rect.h > 2) {
+                out.fillRect({int16_t(rect.x + 1), int16_t(rect.y + 1), filled, int16_t(rect.h - 2)},
+                             CompositorBackend::Ink::ACCENT);
+            }
+            break;
+        }
+
+        case Kind::SPARKLINE:
+            if (historyOf[widget] >= 0) drawSparkline(out, rect, spec, histories[historyOf[widget]]);
+            break;
+    }
+}
+
+void Compositor::drawSparkline(CompositorBackend& out, const Rect& rect, const WidgetSpec& spec,
+                               const History& history) {
+    if (history.count < 2 || rect.w < 2 || rect.h < 2) return;
+
+    const int32_t range = spec.max > spec.min ? spec.max - spec.min : 1;
+    // 가장 오래된 점부터 왼쪽에서 오른쪽으로, 가장 최근 점이 오른쪽 끝
+    const uint8_t first = (history.head + SPARKLINE_SAMPLES - history.count) % SPARKLINE_SAMPLES;
+    int16_t prevX = 0;
+    int16_t prevY = 0;
+    for (uint8_t i = 0; i < history.count; i++) {
+        int32_t sample = history.samples[(first + i) % SPARKLINE_SAMPLES];
+        if (sample < spec.min) sample = spec.min;
+        if (sample > spec.max) sample = spec.max;
+
+        const int16_t x = int16_t(rect.x + rect.w - 1 - int32_t(history.count - 1 - i) * (rect.w - 1) / (SPARKLINE_SAMPLES - 1));
+        const int16_t y = int16_t(rect.y + rect.h - 1 - (sample - spec.min) * (rect.h - 1) / range);
+        if (i > 0) out.drawLine(prevX, prevY, x, y, CompositorBackend::Ink::ACCENT);
+        prevX = x;
+        prevY = y;
+    }
+}
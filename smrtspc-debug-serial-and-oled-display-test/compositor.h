@@ -0,0 +1,147 @@
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 여러 디스플레이(72x40 흑백 OLED, 284x76 RGB565 TFT 등)에 같은 화면을 그리는 합성기.
+//  - 화면은 위젯(글자, 값, 막대, 스파크라인) 표 하나로 선언한다. 위치와 크기는 화면 대비 %로
+//    적으므로 해상도가 다른 디스플레이에도 그대로 쓰인다. 픽셀 좌표는 setScreen()/addBackend()
+//    때 한 번만 계산해 두고 매 프레임 다시 계산하지 않는다.
+//  - 값은 슬롯(slot)에 넣는다. set()으로 값이 바뀌면 그 슬롯에 묶인 위젯만 디스플레이마다 dirty로 표시된다.
+//  - update()는 디스플레이마다 갱신 간격(예산)이 지났고 dirty 위젯이 있을 때만 그 위젯들을 다시 그리고
+//    present()를 부른다. 느린 디스플레이가 빠른 디스플레이를 붙잡지 않는다.
+// 그리기는 CompositorBackend가 담당하므로 이 클래스는 하드웨어에 의존하지 않는다.
+// set()과 update()는 같은 태스크에서 호출한다.
+
+class CompositorBackend {
+public:
+    struct Rect {
+        int16_t x;
+        int16_t y;
+        int16_t w;
+        int16_t h;
+    };
+
+    enum class Align : uint8_t { LEFT, CENTER, RIGHT };
+
+    // 색 역할. 흑백 디스플레이는 모두 같은 색으로 그린다
+    enum class Ink : uint8_t {
+        NORMAL,  // 글자, 테두리
+        ACCENT   // 값, 막대 채움, 그래프
+    };
+
+    virtual ~CompositorBackend() = default;
+
+    virtual int16_t width() const = 0;
+    virtual int16_t height() const = 0;
+
+    // 영역을 배경색으로 지우기
+    virtual void clearRect(const Rect& rect) = 0;
+    // 영역 안에 한 줄 글자. 글자 크기는 영역 높이에 맞춰 백엔드가 고른다
+    virtual void drawText(const Rect& rect, const char* text, Align align, Ink ink) = 0;
+    virtual void fillRect(const Rect& rect, Ink ink) = 0;
+    virtual void drawFrame(const Rect& rect, Ink ink) = 0;
+    virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, Ink ink) = 0;
+    // 그린 내용을 화면으로 보내기 (프레임 버퍼가 있는 백엔드)
+    virtual void present() {}
+};
+
+class Compositor {
+public:
+    using Rect = CompositorBackend::Rect;
+    using Align = CompositorBackend::Align;
+
+    static constexpr uint8_t MAX_WIDGETS = 16;
+    static constexpr uint8_t MAX_BACKENDS = 4;
+    static constexpr uint8_t MAX_SLOTS = 8;
+    static constexpr uint8_t MAX_SPARKLINES = 4;
+    static constexpr uint8_t SPARKLINE_SAMPLES = 32;
+
+    enum class Kind : uint8_t {
+        LABEL,      // 고정 글자 (text)
+        VALUE,      // 슬롯 값 + 단위(text)
+        BAR,        // 슬롯 값을 min~max 막대로
+        SPARKLINE   // 슬롯 값이 바뀔 때마다 한 점, 최근 SPARKLINE_SAMPLES개를 꺾은선으로
+    };
+
+    // 위젯 선언. x, y, w, h는 화면 대비 % (0~100)
+    struct WidgetSpec {
+        Kind kind;
+        uint8_t x;
+        uint8_t y;
+        uint8_t w;
+        uint8_t h;
+        int8_t slot;               // 묶을 값 슬롯 (-1 = 없음)
+        const char* text;          // LABEL 글자, VALUE 단위
+        int16_t min;               // BAR/SPARKLINE 범위
+        int16_t max;
+        Align align;
+        uint8_t backends;          // 그릴 디스플레이 비트 (0 = 모두)
+    };
+
+    struct BackendStats {
+        uint32_t frames = 0;           // present() 횟수
+        uint32_t widgetsDrawn = 0;     // 다시 그린 위젯 수 (누적)
+        uint32_t deferredUpdates = 0;  // 예산이 남아 다음으로 미룬 횟수
+    };
+
+    // 화면(위젯 표) 설정. 표는 정적 배열이어야 한다 (복사하지 않음)
+    bool setScreen(const WidgetSpec* widgets, uint8_t count);
+    template <uint8_t N>
+    bool setScreen(const WidgetSpec (&widgets)[N]) {
+        return setScreen(widgets, N);
+    }
+
+    // 디스플레이 추가. minIntervalMs = 이 디스플레이를 다시 그리는 최소 간격. 번호(0~) 또는 -1
+    int8_t addBackend(CompositorBackend& backend, uint16_t minIntervalMs);
+
+    // 슬롯 값 갱신. 값이 같으면 아무것도 하지 않는다
+    void set(uint8_t slot, int32_t value);
+    int32_t get(uint8_t slot) const { return slot < MAX_SLOTS ? slots[slot] : 0; }
+
+    // 예산이 지난 디스플레이에 dirty 위젯을 그린다. 그린 위젯 수를 반환
+    uint16_t update(uint32_t nowMs);
+
+    // 모든 디스플레이를 처음부터 다시 그리기
+    void invalidate();
+
+    const BackendStats& getStats(uint8_t backend) const { return backendStates[backend].stats; }
+
+private:
+    struct History {
+        int16_t samples[SPARKLINE_SAMPLES];
+        uint8_t head;
+        uint8_t count;
+    };
+
+    struct BackendState {
+        CompositorBackend* backend;
+        uint16_t minIntervalMs;
+        uint32_t lastPresentMs;
+        bool presented;
+        bool clearAll;
+        uint16_t dirty;                 // 다시 그릴 위젯 비트
+        Rect rects[MAX_WIDGETS];        // 위젯 픽셀 영역
+        BackendStats stats;
+    };
+
+    const WidgetSpec* widgets = nullptr;
+    uint8_t widgetCount = 0;
+
+    BackendState backendStates[MAX_BACKENDS];
+    uint8_t backendCount = 0;
+
+    int32_t slots[MAX_SLOTS] = {};
+    uint16_t slotWidgets[MAX_SLOTS] = {};   // 슬롯에 묶인 위젯 비트
+
+    History histories[MAX_SPARKLINES];
+    int8_t historyOf[MAX_WIDGETS];
+
+    uint16_t widgetsFor(uint8_t backend) const;
+    void layout(uint8_t backend);
+    void draw(uint8_t backend, uint8_t widget);
+    void drawSparkline(CompositorBackend& out, const Rect& rect, const WidgetSpec& spec, const History& history);
+};
+
+#endif
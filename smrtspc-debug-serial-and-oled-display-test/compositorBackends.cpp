@@ -0,0 +1,73 @@
+#include "compositorBackends.h"
+
+namespace {
+
+// 영역 안에서 정렬한 기준 x
+int16_t alignedX(const CompositorBackend::Rect& rect, int16_t textWidth, CompositorBackend::Align align) {
+    switch (align) {
+        case CompositorBackend::Align::CENTER: return rect.x + (rect.w - textWidth) / 2;
+        case CompositorBackend::Align::RIGHT:  return rect.x + rect.w - textWidth;
+        default:                               return rect.x;
+    }
+}
+
+}  // namespace
+
+// ---- OLED ----
+
+void OledBackend::clearRect(const Rect& rect) {
+    display.clearRect(rect.x, rect.y, rect.w, rect.h);
+}
+
+void OledBackend::drawText(const Rect& rect, const char* text, Align align, Ink) {
+    // 영역 높이에 들어가는 가장 큰 글꼴
+    static const FontSize sizes[] = {FONT_LARGE, FONT_MEDIUM, FONT_SMALL};
+    for (FontSize size : sizes) {
+        display.setFont(size);
+        if (display.getFontHeight() <= rect.h) break;
+    }
+    display.print(text, alignedX(rect, display.getTextWidth(text), align), rect.y);
+}
+
+void OledBackend::fillRect(const Rect& rect, Ink) {
+    display.drawRect(rect.x, rect.y, rect.w, rect.h, true);
+}
+
+void OledBackend::drawFrame(const Rect& rect, Ink) {
+    display.drawFrame(rect.x, rect.y, rect.w, rect.h);
+}
+
+void OledBackend::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, Ink) {
+    display.drawLine(x0, y0, x1, y1);
+}
+
+// ---- TFT ----
+
+void TftBackend::clearRect(const Rect& rect) {
+    gfx.fillRect(rect.x, rect.y, rect.w, rect.h, background);
+}
+
+void TftBackend::drawText(const Rect& rect, const char* text, Align align, Ink ink) {
+    // 기본 글꼴은 6x8. 높이에 맞는 배율 (1~4)
+    uint8_t scale = uint8_t(rect.h / 8);
+    if (scale < 1) scale = 1;
+    if (scale > 4) scale = 4;
+
+    const int16_t textWidth = int16_t(strlen(text) * 6 * scale);
+    gfx.setTextSize(scale);
+    gfx.setTextColor(color(ink));
+    gfx.setCursor(alignedX(rect, textWidth, align), rect.y + (rect.h - 8 * scale) / 2);
+    gfx.print(text);
+}
+
+void TftBackend::fillRect(const Rect& rect, Ink ink) {
+    gfx.fillRect(rect.x, rect.y, rect.w, rect.h, color(ink));
+}
+
+void TftBackend::drawFrame(const Rect& rect, Ink ink) {
+    gfx.drawRect(rect.x, rect.y, rect.w, rect.h, color(ink));
+}
+
+void TftBackend::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, Ink ink) {
+    gfx.drawLine(x0, y0, x1, y1, color(ink));
+}
@@ -0,0 +1,56 @@
+#ifndef COMPOSITOR_BACKENDS_H
+#define COMPOSITOR_BACKENDS_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_ST77xx.h>
+#include "compositor.h"
+#include "miniDisplayManager.h"
+
+// 72x40 흑백 OLED (DisplayManager). 흰 배경에 검은 글자 (DisplayManager와 같은 방식)
+// 프레임 버퍼에 그린 뒤 present()에서 한 번 전송하고, FrameFlusher가 바뀐 타일만 보낸다.
+class OledBackend : public CompositorBackend {
+public:
+    explicit OledBackend(DisplayManager& display) : display(display) {}
+
+    int16_t width() const override { return DisplayManager::width; }
+    int16_t height() const override { return DisplayManager::height; }
+
+    void clearRect(const Rect& rect) override;
+    void drawText(const Rect& rect, const char* text, Align align, Ink ink) override;
+    void fillRect(const Rect& rect, Ink ink) override;
+    void drawFrame(const Rect& rect, Ink ink) override;
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, Ink ink) override;
+    void present() override { display.update(); }
+
+private:
+    DisplayManager& display;
+};
+
+// RGB565 TFT (Adafruit_GFX, 예: 284x76 ST7789). 프레임 버퍼 없이 바로 그린다.
+// 글자는 Adafruit 기본 글꼴(6x8)을 영역 높이에 맞는 배율로 그린다.
+class TftBackend : public CompositorBackend {
+public:
+    TftBackend(Adafruit_GFX& gfx, uint16_t background = ST77XX_BLACK,
+               uint16_t foreground = ST77XX_WHITE, uint16_t accent = ST77XX_YELLOW)
+        : gfx(gfx), background(background), foreground(foreground), accent(accent) {}
+
+    int16_t width() const override { return gfx.width(); }
+    int16_t height() const override { return gfx.height(); }
+
+    void clearRect(const Rect& rect) override;
+    void drawText(const Rect& rect, const char* text, Align align, Ink ink) override;
+    void fillRect(const Rect& rect, Ink ink) override;
+    void drawFrame(const Rect& rect, Ink ink) override;
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, Ink ink) override;
+
+private:
+    Adafruit_GFX& gfx;
+    const uint16_t background;
+    const uint16_t foreground;
+    const uint16_t accent;
+
+    uint16_t color(Ink ink) const { return ink == Ink::ACCENT ? accent : foreground; }
+};
+
+#endif
@@ -0,0 +1,97 @@
+#include "driverBenchSuite.h"
+#include "microBench.h"
+#include "miniDisplayManager.h"
+#include "maqueenWheelManager.h"
+#include "fixedFormat.h"
+
+namespace {
+
+// 텍스트 캐시(8개)보다 많은 서로 다른 문자열: 매번 캐시 실패
+const char* const ROTATING_LABELS[] = {
+    "Speed", "Battery", "Heading", "Range", "Left", "Right", "Temp", "Status",
+    "Mode", "Signal", "Voltage", "Current", "Power", "Error", "Uptime", "Target",
+};
+constexpr uint32_t ROTATING_COUNT = sizeof(ROTATING_LABELS) / sizeof(ROTATING_LABELS[0]);
+
+// 값만 바뀌는 화면 (실제 예제처럼 라벨은 그대로, 숫자만 변함)
+void formatCounter(char* out, uint32_t i) {
+    formatGrouped(out, 0, int32_t(i * 37));
+}
+
+}  // namespace
+
+void runDriverBenchSuite(Print& out, uint32_t iterations) {
+    MicroBench bench(out);
+    bench.printHeader();
+
+    // 측정 자체의 비용 (다른 줄에서 빼서 보면 된다)
+    bench.run("empty", iterations, [](uint32_t) {});
+
+    // ---- 숫자 포맷 ----
+    char text[24];
+    volatile uint8_t sink = 0;
+    bench.run("formatGrouped", iterations, [&](uint32_t i) {
+        sink = formatGrouped(text, 11, int32_t(i * 104729u));
+    });
+    bench.run("formatHundredths", iterations, [&](uint32_t i) {
+        sink = formatHundredths(text, int32_t(i * 7919u) - 500000, true);
+    });
+    (void)sink;
+
+    // ---- 글자 폭 (getStrWidth는 텍스트 캐시를 거친다) ----
+    Display.setFont(FONT_MEDIUM);
+    volatile int width = 0;
+    bench.run("getTextWidth_cached", iterations, [&](uint32_t) {
+        width = Display.getTextWidth("Battery");
+    });
+    bench.run("getTextWidth_miss", iterations, [&](uint32_t i) {
+        width = Display.getTextWidth(ROTATING_LABELS[i % ROTATING_COUNT]);
+    });
+    (void)width;
+
+    // ---- 화면 그리기 + 전송 (변경된 타일만 I2C로 전송) ----
+    Display.setFont(FONT_LARGE);
+    bench.run("display2Lines", iterations, [&](uint32_t i) {
+        formatCounter(text, i);
+        Display.display2Lines("Count", text, ALIGN_RIGHT);
+    });
+
+    Display.setFont(FONT_SMALL);
+    bench.run("display4Lines", iterations, [&](uint32_t i) {
+        formatCounter(text, i);
+        Display.display4Lines("ESP32-C3", "Maqueen", "Count", text);
+    });
+
+    Display.setFont(FONT_MEDIUM);
+    bench.run("displayText", iterations, [&](uint32_t i) {
+        formatCounter(text, i);
+        const char* const lines[] = {"Speed", text, "mm/s"};
+        Display.displayText(lines, ALIGN_CENTER);
+    });
+
+    // ---- 프레임 전송 (sendBuffer 대신 FrameFlusher를 거치는 update) ----
+    Display.clear();
+    bench.run("update_unchanged", iterations, [](uint32_t) {
+        Display.update();  // 바뀐 타일 없음: 비교만 하고 전송 0바이트
+    });
+    bench.run("update_full", iterations, [](uint32_t i) {
+        // 흰 화면과 검은 화면을 번갈아: 모든 타일 전송 (전체 sendBuffer와 같은 양)
+        if (i & 1) {
+            Display.clearRect(0, 0, DisplayManager::width, DisplayManager::height);
+        } else {
+            Display.drawRect(0, 0, DisplayManager::width, DisplayManager::height, true);
+        }
+        Display.update();
+    });
+    Display.clear();
+
+    // ---- 모터 명령 (한 번의 I2C 쓰기, 같은 명령 생략 경로 포함) ----
+    bench.run("setWheelSpeeds", iterations, [](uint32_t i) {
+        const int16_t speed = int16_t(40 + (i % 2) * 40);  // 매번 값이 달라 항상 전송
+        Maqueen.setWheelSpeeds(speed, -speed);
+    });
+    bench.run("setWheelSpeeds_skipped", iterations, [](uint32_t) {
+        Maqueen.setWheelSpeeds(60, 60);  // 마지막 명령과 같으면 전송 생략
+    });
+    Maqueen.stop();
+}
@@ -0,0 +1,11 @@
+#ifndef DRIVER_BENCH_SUITE_H
+#define DRIVER_BENCH_SUITE_H
+
+#include <Arduino.h>
+
+// 화면(miniDisplayManager), 모터(maqueenWheelManager), 숫자 포맷터 벤치마크 묶음.
+// 보드(ex-micro-benchmark.ino)와 호스트(sim/simMicroBench.cpp)가 같은 목록을 돌린다.
+// Display.begin(), Maqueen.begin()을 먼저 호출해 둘 것. 결과는 MicroBench CSV 형식.
+void runDriverBenchSuite(Print& out, uint32_t iterations);
+
+#endif
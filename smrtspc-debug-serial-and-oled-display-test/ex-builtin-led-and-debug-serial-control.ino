@@ -1,6 +1,7 @@
 #include <Arduino.h>
 #include "DebugSerial.h"
 #include "oledDisplayManager.h"
+#include "ledPatternEngine.h"
 
 // LED pin configuration
 #define LED_PIN 8
@@ -10,6 +11,12 @@
 #define LED_ON  LOW
 #define LED_OFF HIGH
 
+// 1로 바꾸면 TOGGLE 로그를 텍스트 대신 바이너리 트레이스(DEBUG_TRACE)로 보낸다.
+// 시리얼 모니터에는 깨진 문자로 보이므로 trace_decode.py로 읽어야 한다.
+#ifndef LED_TEST_BINARY_TRACE
+#define LED_TEST_BINARY_TRACE 0
+#endif
+
 // Test states
 enum TestState {
   TEST_OFF,
@@ -26,22 +33,20 @@ TestState currentTest = TEST_OFF;
 unsigned long testStartTime = 0;
 bool ledState = false;
 unsigned long lastToggleTime = 0;
-float pulseValue = 0;
-bool pulseDirection = true;
 
 void setup() {
   // Initialize serial
   DebugSerial::begin(115200, -1);
   if (!DebugSerial::waitForConnection(10000)) {
-    DebugSerial::printlnDebug("[DEBUG] No serial connection, entering blink mode");
+    DEBUG_PRINTLN("[DEBUG] No serial connection, entering blink mode");
     // If no connection, blink pattern
     while (true) {
       for (int i = 0; i < 3; i++) {
         digitalWrite(LED_PIN, LED_ON);
-        DebugSerial::printlnDebug("LED ON");
+        DEBUG_PRINTLN("LED ON");
         delay(100);
         digitalWrite(LED_PIN, LED_OFF);
-        DebugSerial::printlnDebug("LED OFF");
+        DEBUG_PRINTLN("LED OFF");
         delay(50);
       }
       delay(100);
@@ -49,34 +54,35 @@ void setup() {
   }
   DebugSerial::printSystemInfo();
 
-  DebugSerial::printlnDebug("=== Starting LED Test ===");
+  DEBUG_PRINTLN("=== Starting LED Test ===");
   
   // Initialize OLED display
   Display.begin();
+  Display.beginAsync();  // 화면 전송은 별도 태스크에서 (loop()가 I2C 전송을 기다리지 않음)
   Display.clear();
   Display.display4Lines("LED Test", "ESP32-C3", "Starting...", "");
   delay(1000);
 
   // Initialize LED pin
-  DebugSerial::printlnDebug("LED pin initializing to OUTPUT");
-  DebugSerial::printDebug("Testing LED on pin: ");
-  DebugSerial::printlnDebug(String(LED_PIN));
+  DEBUG_PRINTLN("LED pin initializing to OUTPUT");
+  DEBUG_PRINT("Testing LED on pin: ");
+  DEBUG_PRINTLN(String(LED_PIN));
   pinMode(LED_PIN, OUTPUT);  // 핀 모드 설정
   digitalWrite(LED_PIN, LED_OFF);  // 초기 상태로 설정
 
   // Test LED with more detailed feedback
-  DebugSerial::printlnDebug("--- LED Connection Test ---");
+  DEBUG_PRINTLN("--- LED Connection Test ---");
   for (int i = 0; i < 3; i++) {
-    DebugSerial::printDebug("Setting LED_PIN ");
-    DebugSerial::printDebug(String(LED_PIN));
-    DebugSerial::printlnDebug(" ON");
+    DEBUG_PRINT("Setting LED_PIN ");
+    DEBUG_PRINT(String(LED_PIN));
+    DEBUG_PRINTLN(" ON");
     pinMode(LED_PIN, OUTPUT);  // 핀 모드 설정
     digitalWrite(LED_PIN, LED_ON);
     delay(500);
     
-    DebugSerial::printDebug("Setting LED_PIN ");
-    DebugSerial::printDebug(String(LED_PIN));
-    DebugSerial::printlnDebug(" OFF");
+    DEBUG_PRINT("Setting LED_PIN ");
+    DEBUG_PRINT(String(LED_PIN));
+    DEBUG_PRINTLN(" OFF");
     // pinMode는 이미 설정되었으므로 생략 가능
     digitalWrite(LED_PIN, LED_OFF);
     delay(500);
@@ -100,32 +106,37 @@ void loop() {
       currentTest = TEST_OFF;
       digitalWrite(LED_PIN, LED_OFF);
       ledState = false;
-      DebugSerial::printlnDebug("--- TEST CYCLE RESTARTED ---");
+      DEBUG_PRINTLN("--- TEST CYCLE RESTARTED ---");
     }
     
-    // 디버그 정보 출력
-    String debugMsg = "\n[DEBUG] Current Test: ";
-    debugMsg += String((int)currentTest);
-    debugMsg += " (";
-    switch(currentTest) {
-      case TEST_OFF: debugMsg += "OFF"; break;
-      case TEST_ON: debugMsg += "ON"; break;
-      case TEST_BLINK: debugMsg += "BLINK"; break;
-      case TEST_FAST_BLINK: debugMsg += "FAST_BLINK"; break;
-      case TEST_PULSE: debugMsg += "PULSE"; break;
-      case TEST_TOGGLE: debugMsg += "TOGGLE"; break;
-      case TEST_DONE: debugMsg += "DONE"; break;
-      default: debugMsg += "UNKNOWN";
+    // 디버그 정보 출력 (여러 줄에 걸쳐 만드는 메시지는 레벨이 꺼져 있으면 통째로 건너뛴다)
+    if (DEBUG_SERIAL_ENABLED(DEBUG_SERIAL_LEVEL_DEBUG)) {
+      String debugMsg = "\n[DEBUG] Current Test: ";
+      debugMsg += String((int)currentTest);
+      debugMsg += " (";
+      switch(currentTest) {
+        case TEST_OFF: debugMsg += "OFF"; break;
+        case TEST_ON: debugMsg += "ON"; break;
+        case TEST_BLINK: debugMsg += "BLINK"; break;
+        case TEST_FAST_BLINK: debugMsg += "FAST_BLINK"; break;
+        case TEST_PULSE: debugMsg += "PULSE"; break;
+        case TEST_TOGGLE: debugMsg += "TOGGLE"; break;
+        case TEST_DONE: debugMsg += "DONE"; break;
+        default: debugMsg += "UNKNOWN";
+      }
+      debugMsg += ")";
+      DEBUG_PRINTLN(debugMsg);
+    
+      // LED 핀 상태 디버그
+      debugMsg = "[DEBUG] Before change - LED_PIN: ";
+      debugMsg += (digitalRead(LED_PIN) == LED_ON) ? "ON" : "OFF";
+      debugMsg += ", ledState: ";
+      debugMsg += ledState ? "ON" : "OFF";
+      DEBUG_PRINTLN(debugMsg);
     }
-    debugMsg += ")";
-    DebugSerial::printlnDebug(debugMsg);
     
-    // LED 핀 상태 디버그
-    debugMsg = "[DEBUG] Before change - LED_PIN: ";
-    debugMsg += (digitalRead(LED_PIN) == LED_ON) ? "ON" : "OFF";
-    debugMsg += ", ledState: ";
-    debugMsg += ledState ? "ON" : "OFF";
-    DebugSerial::printlnDebug(debugMsg);
+    // PULSE 테스트가 LEDC로 잡고 있던 핀을 돌려받는다 (아래 pinMode/digitalWrite용)
+    StatusLed.end();
     
     // Initialize the new test
     char lineBuffer[16];  // Buffer for display lines
@@ -134,10 +145,9 @@ void loop() {
         pinMode(LED_PIN, OUTPUT);  // 핀 모드 설정
         digitalWrite(LED_PIN, LED_OFF);
         ledState = false;
-        DebugSerial::printlnDebug("--- TEST: LED OFF ---");
-        debugMsg = "[DEBUG] LED should be OFF - LED_PIN: ";
-        debugMsg += (digitalRead(LED_PIN) == LED_ON) ? "ON" : "OFF";
-        DebugSerial::printlnDebug(debugMsg);
+        DEBUG_PRINTLN("--- TEST: LED OFF ---");
+        DEBUG_PRINTF("[DEBUG] LED should be OFF - LED_PIN: %s\n",
+                     (digitalRead(LED_PIN) == LED_ON) ? "ON" : "OFF");
         snprintf(lineBuffer, sizeof(lineBuffer), "Pin: %d", LED_PIN);
         Display.display4Lines("OFF", "LED: Off", lineBuffer, "Active Low");
         break;
@@ -146,10 +156,9 @@ void loop() {
         pinMode(LED_PIN, OUTPUT);  // 핀 모드 설정
         digitalWrite(LED_PIN, LED_ON);
         ledState = true;
-        DebugSerial::printlnDebug("--- TEST: LED ON ---");
-        debugMsg = "[DEBUG] LED should be ON - LED_PIN: ";
-        debugMsg += (digitalRead(LED_PIN) == LED_ON) ? "ON" : "OFF";
-        DebugSerial::printlnDebug(debugMsg);
+        DEBUG_PRINTLN("--- TEST: LED ON ---");
+        DEBUG_PRINTF("[DEBUG] LED should be ON - LED_PIN: %s\n",
+                     (digitalRead(LED_PIN) == LED_ON) ? "ON" : "OFF");
         snprintf(lineBuffer, sizeof(lineBuffer), "Pin: %d", LED_PIN);
         Display.display4Lines("ON", "LED: On", lineBuffer, "Active Low");
         break;
@@ -158,7 +167,7 @@ void loop() {
         pinMode(LED_PIN, OUTPUT);  // 핀 모드 설정
         digitalWrite(LED_PIN, LED_OFF);
         ledState = false;
-        DebugSerial::printlnDebug("\n--- TEST: BLINK (500ms) ---");
+        DEBUG_PRINTLN("\n--- TEST: BLINK (500ms) ---");
         snprintf(lineBuffer, sizeof(lineBuffer), "Pin: %d", LED_PIN);
         Display.display4Lines("BLINK", "Interval: 500ms", lineBuffer, "Active Low");
         break;
@@ -167,16 +176,16 @@ void loop() {
         pinMode(LED_PIN, OUTPUT);  // 핀 모드 설정
         digitalWrite(LED_PIN, LED_OFF);
         ledState = false;
-        DebugSerial::printlnDebug("\n--- TEST: FAST BLINK (200ms) ---");
+        DEBUG_PRINTLN("\n--- TEST: FAST BLINK (200ms) ---");
         snprintf(lineBuffer, sizeof(lineBuffer), "Pin: %d", LED_PIN);
         Display.display4Lines("FAST BLINK", "Interval: 200ms", lineBuffer, "Active Low");
         break;
         
       case TEST_PULSE:
-        pinMode(LED_PIN, OUTPUT);  // 핀 모드 설정
-        pulseValue = 0;
-        pulseDirection = true;
-        DebugSerial::printlnDebug("\n--- TEST: PULSE (fade in/out) ---");
+        // 페이드는 타이머 + LEDC가 백그라운드에서 재생 (loop()에서 analogWrite 하지 않음)
+        StatusLed.begin(LED_PIN, true);
+        StatusLed.pulse(0, 1000);
+        DEBUG_PRINTLN("\n--- TEST: PULSE (fade in/out) ---");
         snprintf(lineBuffer, sizeof(lineBuffer), "Pin: %d", LED_PIN);
         Display.display4Lines("PULSE", "Fade In/Out", "PWM Control", lineBuffer);
         break;
@@ -185,7 +194,7 @@ void loop() {
         pinMode(LED_PIN, OUTPUT);  // 핀 모드 설정
         digitalWrite(LED_PIN, LED_OFF);
         ledState = false;
-        DebugSerial::printlnDebug("\n--- TEST: TOGGLE (500ms) ---");
+        DEBUG_PRINTLN("\n--- TEST: TOGGLE (500ms) ---");
         snprintf(lineBuffer, sizeof(lineBuffer), "Pin: %d", LED_PIN);
         Display.display4Lines("TOGGLE", "Interval: 1s", lineBuffer, "Active Low");
         break;
@@ -194,10 +203,15 @@ void loop() {
         pinMode(LED_PIN, OUTPUT);  // 핀 모드 설정
         digitalWrite(LED_PIN, LED_OFF);
         ledState = false;
-        DebugSerial::printlnDebug("\n--- ALL TESTS COMPLETE! ---");
+        DEBUG_PRINTLN("\n--- ALL TESTS COMPLETE! ---");
         Display.display4Lines("CYCLE", "COMPLETE", "Restarting...", "");
         break;
     }
+
+    // 화면 갱신 때 loop()가 멈춘 시간 (비동기 모드면 프레임 복사 시간만 남는다)
+    DEBUG_PRINTF("[DEBUG] Display update blocked: %lu us, coalesced frames: %lu\n",
+                 (unsigned long)Display.getLastUpdateMicros(),
+                 (unsigned long)Display.getCoalescedFrames());
   }
   
   // Update current test
@@ -218,31 +232,20 @@ void loop() {
       }
       break;
       
-    case TEST_PULSE:
-      if (pulseDirection) {
-        pulseValue += 5;
-        if (pulseValue >= 255) {
-          pulseValue = 255;
-          pulseDirection = false;
-        }
-      } else {
-        pulseValue -= 5;
-        if (pulseValue <= 0) {
-          pulseValue = 0;
-          pulseDirection = true;
-        }
-      }
-      analogWrite(LED_PIN, (int)pulseValue);
-      break;
-      
     case TEST_TOGGLE:
       if (currentTime - lastToggleTime >= 1000) {  // Changed to 1 second for better visibility
         ledState = !ledState;
         digitalWrite(LED_PIN, ledState ? LED_ON : LED_OFF);
-        DebugSerial::printDebug("[TOGGLE] LED_PIN set to: ");
-        DebugSerial::printlnDebug(ledState ? "ON" : "OFF");
-        DebugSerial::printDebug("[TOGGLE] Reading back from pin: ");
-        DebugSerial::printlnDebug((digitalRead(LED_PIN) == LED_ON) ? "ON" : "OFF");
+#if LED_TEST_BINARY_TRACE
+        // 바이너리 트레이스: trace_decode.py --elf <firmware.elf> 로 읽는다
+        DEBUG_TRACE("[TOGGLE] LED_PIN %d set to: %s, read back: %s", LED_PIN,
+                    ledState ? "ON" : "OFF", (digitalRead(LED_PIN) == LED_ON) ? "ON" : "OFF");
+#else
+        DEBUG_PRINT("[TOGGLE] LED_PIN set to: ");
+        DEBUG_PRINTLN(ledState ? "ON" : "OFF");
+        DEBUG_PRINT("[TOGGLE] Reading back from pin: ");
+        DEBUG_PRINTLN((digitalRead(LED_PIN) == LED_ON) ? "ON" : "OFF");
+#endif
         lastToggleTime = currentTime;
       }
       break;
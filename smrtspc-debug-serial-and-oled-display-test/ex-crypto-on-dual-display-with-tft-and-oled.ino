@@ -6,8 +6,6 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <HTTPClient.h>
-#include <ArduinoJson.h>
 #include <Wire.h>
 #include <U8g2lib.h>
 #include <SPI.h>
@@ -16,32 +14,28 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/queue.h>
+#include "taskRuntime.h"
+#include "tickerFetcher.h"
+#include "priceBoardView.h"
+#include "metricsRegistry.h"
+#include "serialShell.h"
 
 // WiFi 설정
 const char* ssid = "U+Net37BAD";
 const char* password = "9882286$5";
 
-// Upbit API 설정
-const char* btcApiUrl = "https://api.upbit.com/v1/ticker?markets=KRW-BTC";
-const char* ethApiUrl = "https://api.upbit.com/v1/ticker?markets=KRW-ETH";
-const char* linkApiUrl = "https://api.upbit.com/v1/ticker?markets=KRW-LINK";
-unsigned long lastUpdateTime = 0;
+// Upbit 시세 조회 설정
+// 모든 마켓을 한 번의 요청으로 조회한다. 모의 서버로 시험할 때는 "http://<PC IP>:5003" (server.py)
+#define TICKER_BASE_URL "https://api.upbit.com"
+const char* const tickerMarkets[] = {"KRW-BTC", "KRW-ETH", "KRW-LINK"};
+const uint8_t tickerMarketCount = sizeof(tickerMarkets) / sizeof(tickerMarkets[0]);
 const unsigned long updateInterval = 60000; // 1분마다 업데이트
 
-// 암호화폐 가격 구조체
-typedef struct {
-  float btcPrice;
-  float ethPrice;
-  float linkPrice;
-  float btcPrevClose;
-  float ethPrevClose;
-  float linkPrevClose;
-  char formattedDate[11];  // YYYY/MM/DD + null
-  char formattedTime[9];   // HH:MM:SS + null
-  bool dataValid;
-} CryptoPrices_t;
+// 새 시세가 없을 때 TFT 화면을 다시 그리는 주기 (연결 중 표시)
+const uint32_t TFT_IDLE_REDRAW_MS = 1000;
 
-CryptoPrices_t cryptoPrices = {0, 0, 0, 0, 0, 0, "0000/00/00", "00:00:00", false};
+// 시세는 조회 태스크가 발행하고 TFT 태스크가 받는다
+Mailbox<TickerSnapshot>::Reader priceReader;
 
 // 디스플레이 데이터 구조체
 typedef struct {
@@ -49,15 +43,25 @@ typedef struct {
   int percentage;
 } DisplayData_t;
 
-// 디스플레이 업데이트 큐
-QueueHandle_t displayQueue;
+// OLED 상태 우편함: 최신 값만 유지, OLED는 밀린 중간 값 없이 가장 최근 값만 그린다
+Mailbox<DisplayData_t> displayState;
+Mailbox<DisplayData_t>::Reader oledReader;
+
+// 가변 저항 읽기 주기, 태스크 상태 보고 주기
+const uint32_t POT_SAMPLE_MS = 100;
+const uint32_t TASK_REPORT_MS = 10000;
+
+// 시리얼 명령 (stats: 조회 지연 http.fetch_ms, I2C 대기, 태스크 스택 등)
+SerialShell shell(Serial);
+uint32_t statsStreamMs = 0;   // 0이면 스트리밍 안 함
+uint32_t lastStatsMs = 0;
 
 // ST7789 SPI 디스플레이 핀 설정
 #define TFT_RST   1    // RST (Reset)
 #define TFT_DC    2    // DC (Data/Command)
 #define TFT_CS    7    // CS (Chip Select)
-#define TFT_MOSI  8    // SDA (Software SPI MOSI)
-#define TFT_SCLK  9    // SCL (Software SPI Clock)
+#define TFT_MOSI  8    // SDA (SPI MOSI)
+#define TFT_SCLK  9    // SCL (SPI Clock)
 #define TFT_BLK   10   // BLK (Backlight)
 
 // SPI 클럭 속도 설정 (40MHz)
@@ -71,8 +75,13 @@ TaskHandle_t tftTaskHandle = NULL;
 #define TFT_WIDTH  284  // 실제 화면의 가로 길이 (90도 회전 시 세로가 됨)
 #define TFT_HEIGHT 76   // 실제 화면의 세로 길이 (90도 회전 시 가로가 됨)
 
-// ST7789 객체 생성 (소프트웨어 SPI 모드)
-Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_MOSI, TFT_SCLK, TFT_RST);
+// ST7789 객체 생성 (하드웨어 SPI 모드)
+// MOSI/SCLK 핀을 생성자에 넘기면 소프트웨어(비트뱅잉) SPI가 되므로, SPI 객체를 넘기고
+// 핀은 initSPI_TFTDisplay()의 SPI.begin()에서 지정한다
+Adafruit_ST7789 tft = Adafruit_ST7789(&SPI, TFT_CS, TFT_DC, TFT_RST);
+
+// 가격 화면: 바뀐 글자 칸만 다시 그림 (첫 가격 줄 10,25 / 갱신 시각 줄 10,TFT_HEIGHT-10)
+PriceBoardView priceView(tft, 10, 25, TFT_HEIGHT - 10);
 
 // U8g2 하드웨어 I2C 생성자 (reset 핀 없음)
 U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE);
@@ -130,104 +139,6 @@ void connectToWiFi() {
   }
 }
 
-// 암호화폐 가격 가져오기 (Upbit API 사용)
-bool fetchCryptoPrices() {
-  bool result = true;
-  HTTPClient http;
-  
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("WiFi not connected, attempting to connect...");
-    connectToWiFi();
-    if (WiFi.status() != WL_CONNECTED) {
-      Serial.println("Failed to connect to WiFi");
-      return false;
-    }
-  }
-
-  bool btcSuccess = false;
-  bool ethSuccess = false;
-  bool linkSuccess = false;
-  
-  // BTC 가격 및 어제 종가 가져오기
-  http.begin(btcApiUrl);
-  int httpCode = http.GET();
-  if (httpCode == HTTP_CODE_OK) {
-    String payload = http.getString();
-    DynamicJsonDocument doc(2048);
-    deserializeJson(doc, payload);
-    
-    // 가격 데이터 및 거래 시간 저장
-    cryptoPrices.btcPrice = doc[0]["trade_price"];
-    // 어제 종가 (prev_closing_price 사용)
-    cryptoPrices.btcPrevClose = doc[0]["prev_closing_price"];
-    
-    // 거래일자와 거래시간 저장 (YYYYMMDD, HHMMSS 형식)
-    String tradeDate = doc[0]["trade_date_kst"].as<String>();
-    String tradeTime = doc[0]["trade_time_kst"].as<String>();
-    
-    // 날짜 포맷팅 (YYYY/MM/DD)
-    snprintf(cryptoPrices.formattedDate, sizeof(cryptoPrices.formattedDate),
-             "%s/%s/%s", 
-             tradeDate.substring(0, 4).c_str(), 
-             tradeDate.substring(4, 6).c_str(), 
-             tradeDate.substring(6, 8).c_str());
-             
-    // 시간 포맷팅 (HH:MM:SS)
-    snprintf(cryptoPrices.formattedTime, sizeof(cryptoPrices.formattedTime),
-             "%s:%s:%s",
-             tradeTime.substring(0, 2).c_str(),
-             tradeTime.substring(2, 4).c_str(),
-             tradeTime.substring(4, 6).c_str());
-    
-    btcSuccess = true;
-  } else {
-    Serial.print("BTC API request failed, error: ");
-    Serial.println(httpCode);
-  }
-  http.end();
-  
-  // ETH 가격 및 어제 종가 가져오기
-  http.begin(ethApiUrl);
-  httpCode = http.GET();
-  if (httpCode == HTTP_CODE_OK) {
-    String payload = http.getString();
-    DynamicJsonDocument doc(2048);
-    deserializeJson(doc, payload);
-    cryptoPrices.ethPrice = doc[0]["trade_price"];
-    cryptoPrices.ethPrevClose = doc[0]["prev_closing_price"];
-    ethSuccess = true;
-  } else {
-    Serial.print("ETH API request failed, error: ");
-    Serial.println(httpCode);
-  }
-  http.end();
-  
-  // LINK 가격 및 어제 종가 가져오기
-  http.begin(linkApiUrl);
-  httpCode = http.GET();
-  if (httpCode == HTTP_CODE_OK) {
-    String payload = http.getString();
-    DynamicJsonDocument doc(2048);
-    deserializeJson(doc, payload);
-    cryptoPrices.linkPrice = doc[0]["trade_price"];
-    cryptoPrices.linkPrevClose = doc[0]["prev_closing_price"];
-    linkSuccess = true;
-  } else {
-    Serial.print("LINK API request failed, error: ");
-    Serial.println(httpCode);
-  }
-  http.end();
-  
-  cryptoPrices.dataValid = (btcSuccess && ethSuccess && linkSuccess);
-  if (cryptoPrices.dataValid) {
-    Serial.println("\nSuccessfully updated BTC, ETH, and LINK prices");
-  } else {
-    Serial.println("\nFailed to update some prices");
-  }
-  
-  return cryptoPrices.dataValid;
-}
-
 void initSPI_TFTDisplay() {
   Serial.println("Initializing SPI TFT display...");
   
@@ -235,16 +146,15 @@ void initSPI_TFTDisplay() {
   pinMode(TFT_BLK, OUTPUT);
   digitalWrite(TFT_BLK, LOW); // 백라이트 켜기
   
-  // SPI 초기화 및 고속 설정
-  SPI.begin(TFT_SCLK, -1, TFT_MOSI, TFT_CS);  // MISO는 사용하지 않음
-  SPI.setFrequency(SPI_FREQ_HZ);
+  // 하드웨어 SPI 핀 지정 (MISO는 사용하지 않음). tft.init()보다 먼저 해야 이 핀이 유지된다
+  SPI.begin(TFT_SCLK, -1, TFT_MOSI, TFT_CS);
   
   // TFT 디스플레이 초기화 (90도 회전 적용)
   tft.init(TFT_HEIGHT, TFT_WIDTH);  // swap width/height for rotation
+  tft.setSPISpeed(SPI_FREQ_HZ);      // init()이 기본 클럭으로 되돌리므로 그 다음에 설정
   tft.setRotation(1);  // 90도 회전 (0=0°, 1=90°, 2=180°, 3=270°)
   
-  // SPI 트랜잭션 설정 (고속 모드)
-  SPI.beginTransaction(SPISettings(SPI_FREQ_HZ, MSBFIRST, SPI_MODE0));
+  // SPI 트랜잭션은 드라이버가 그릴 때마다 시작/종료한다 (여기서 열어 두면 다른 태스크의 그리기가 막힘)
   
   // 화면 초기화
   tft.invertDisplay(false);
@@ -260,8 +170,9 @@ void oledTask(void *parameter) {
   DisplayData_t displayData;
   
   while(1) {
-    // 큐에서 데이터를 받아옴
-    if (xQueueReceive(displayQueue, &displayData, portMAX_DELAY) == pdPASS) {
+    // 새 값이 올 때까지 블록, 최신 값만 받아옴
+    if (oledReader.wait(displayData)) {
+      WorkTimer work;
       // OLED 디스플레이 업데이트
       char valueStr[32];
       snprintf(valueStr, sizeof(valueStr), "Value: %d", displayData.potValue);
@@ -280,42 +191,15 @@ void oledTask(void *parameter) {
       u8g2.drawStr(xOffset, yOffset + 40, valueStr);
       u8g2.sendBuffer();
     }
-    vTaskDelay(10 / portTICK_PERIOD_MS); // 짧은 딜레이
-  }
-}
-
-// 숫자를 9자리 우측 정렬, 천 단위 구분자(,)가 있는 문자열로 변환하는 함수
-String formatNumber(float number) {
-  String numStr = String((long)number);
-  String result = "";
-  int len = numStr.length();
-  
-  // 천 단위 구분자(,) 추가
-  for (int i = 0; i < len; i++) {
-    if ((len - i) % 3 == 0 && i != 0) {
-      result += ",";
-    }
-    result += numStr[i];
   }
-  
-  // 9자리로 맞추기 위해 앞에 공백 추가 (우측 정렬 효과)
-  int totalLength = result.length();
-  while (totalLength < 11) {  // 최대 9자리 숫자 + 2개의 콤마 = 11자리
-    result = " " + result;
-    totalLength++;
-  }
-  
-  return result;
 }
 
 // TFT 디스플레이 태스크
+// 가격 조회는 Ticker 태스크가 하므로 여기서는 새 시세를 기다렸다가 바뀐 글자만 다시 그린다
 void tftTask(void *parameter) {
-  unsigned long lastUpdateAttempt = -updateInterval;  // 시작 즉시 조회하도록 설정
-  
-  // 시간 동기화를 위한 변수
-  struct tm timeinfo;
-  char timeStr[9];  // HH:MM:SS + null
-  char dateStr[11]; // YYYY/MM/DD + null
+  TickerSnapshot prices;
+  bool hasPrices = false;
+  uint8_t dotCount = 0;
   
   // TFT 초기 화면 설정 (90도 회전 고려)
   tft.fillScreen(ST77XX_BLACK);
@@ -325,123 +209,45 @@ void tftTask(void *parameter) {
   tft.drawLine(5, 20, TFT_WIDTH - 5, 20, ST77XX_WHITE);  // 가로선 길이 조정
   
   while(1) {
-    unsigned long currentTime = millis();
-    
-    // 1분마다 가격 업데이트 시도
-    if (currentTime - lastUpdateAttempt >= updateInterval) {
-      lastUpdateAttempt = currentTime;
-      
-      if (fetchCryptoPrices()) {
-        lastUpdateTime = currentTime;
-      }
-    }
-    
-    // 화면 업데이트 (90도 회전 고려)
-    // 전체 화면을 지우지 않고 각 영역만 업데이트
-    tft.fillRect(0, 25, TFT_WIDTH, 70, ST77XX_BLACK);  // 가격 표시 영역만 지우기 (LINK 추가로 높이 증가)
+    // 새 시세가 오면 바로 깨어남. 시세가 아직 없으면 주기적으로 연결 중 표시
+    bool updated = priceReader.wait(prices, pdMS_TO_TICKS(TFT_IDLE_REDRAW_MS));
+    if (!updated && hasPrices) continue;
+    hasPrices = hasPrices || updated;
     
-    if (cryptoPrices.dataValid) {
-      // 비트코인 가격 및 변동률 표시
-      float btcChange = 0;
-      if (cryptoPrices.btcPrevClose > 0) {
-        btcChange = ((cryptoPrices.btcPrice - cryptoPrices.btcPrevClose) / cryptoPrices.btcPrevClose) * 100;
-        // 변동률에 따라 색상 설정 (0% 이상: 노란색, 0% 미만: 초록색)
-        tft.setTextColor(btcChange >= 0 ? ST77XX_YELLOW : ST77XX_GREEN);
-        
-        Serial.print("BTC Change: ");
-        Serial.print(btcChange);
-        Serial.println("%");
-      } else {
-        tft.setTextColor(ST77XX_WHITE);
-        Serial.println("BTC prev_close is 0 or invalid");
-      }
-      
-      tft.setCursor(10, 25);
-      tft.print("BTC: ");
-      tft.print(formatNumber(cryptoPrices.btcPrice));
-      tft.print(" KRW ");
-      
-      if (cryptoPrices.btcPrevClose > 0) {
-        tft.print("(");
-        if (btcChange >= 0) tft.print("+");
-        tft.print(btcChange, 2);
-        tft.print("%)");
-      }
-
-      // 이더리움 가격 및 변동률 표시
-      float ethChange = 0;
-      if (cryptoPrices.ethPrevClose > 0) {
-        ethChange = ((cryptoPrices.ethPrice - cryptoPrices.ethPrevClose) / cryptoPrices.ethPrevClose) * 100;
-        // 변동률에 따라 색상 설정 (0% 이상: 노란색, 0% 미만: 초록색)
-        tft.setTextColor(ethChange >= 0 ? ST77XX_YELLOW : ST77XX_GREEN);
-      } else {
-        tft.setTextColor(ST77XX_WHITE);
-      }
-      
-      tft.setCursor(10, 35);
-      tft.print("ETH: ");
-      tft.print(formatNumber(cryptoPrices.ethPrice));
-      tft.print(" KRW ");
-      
-      if (cryptoPrices.ethPrevClose > 0) {
-        tft.print("(");
-        if (ethChange >= 0) tft.print("+");
-        tft.print(ethChange, 2);
-        tft.print("%)");
-      }
-      
-      // 링크 가격 및 변동률 표시
-      float linkChange = 0;
-      if (cryptoPrices.linkPrevClose > 0) {
-        linkChange = ((cryptoPrices.linkPrice - cryptoPrices.linkPrevClose) / cryptoPrices.linkPrevClose) * 100;
-        // 변동률에 따라 색상 설정 (0% 이상: 노란색, 0% 미만: 초록색)
-        tft.setTextColor(linkChange >= 0 ? ST77XX_YELLOW : ST77XX_GREEN);
-      } else {
-        tft.setTextColor(ST77XX_WHITE);
-      }
-      
-      tft.setCursor(10, 45);
-      tft.print("LINK:");
-      tft.print(formatNumber(cryptoPrices.linkPrice));
-      tft.print(" KRW ");
-      
-      if (cryptoPrices.linkPrevClose > 0) {
-        tft.print("(");
-        if (linkChange >= 0) tft.print("+");
-        tft.print(linkChange, 2);
-        tft.print("%)");
-      }
-
-      tft.setTextColor(ST77XX_WHITE);  // 다른 텍스트는 흰색으로 되돌리기
-      // API 응답에서 파싱한 날짜와 시간을 그대로 사용
-      // 이미 KST 시간이므로 추가 변환 없이 표시
-      
-      // API 응답에서 받은 거래일시 사용
-      strncpy(dateStr, cryptoPrices.formattedDate, sizeof(dateStr));
-      strncpy(timeStr, cryptoPrices.formattedTime, sizeof(timeStr));
-      
-      // 마지막 업데이트 시간 표시 (90도 회전 고려)
-      tft.fillRect(0, TFT_HEIGHT - 10, TFT_WIDTH, TFT_HEIGHT, ST77XX_BLACK);  // 하단 영역 지우기
-      tft.setCursor(10, TFT_HEIGHT - 10);  // 하단 여백 조정
-      tft.print("Updated: ");
-      tft.print(dateStr);
-      tft.print(" ");
-      tft.print(timeStr);
-      tft.print("   ");  // 이전 텍스트 지우기
-      
+    WorkTimer work;
+    if (hasPrices) {
+      priceView.showPrices(prices);
     } else {
-      tft.setCursor(10, 35);
-      tft.print("Connecting");
-      // 연결 애니메이션을 위한 점 추가
-      static int dotCount = 0;
+      // 연결 애니메이션 (점 0~3개)
       dotCount = (dotCount + 1) % 4;
-      for (int i = 0; i < dotCount; i++) {
-        tft.print(".");
-      }
-      tft.print("   ");  // 이전 텍스트 지우기
+      priceView.showConnecting(dotCount);
     }
-    
-    vTaskDelay(30000 / portTICK_PERIOD_MS); // 30초 대기
+    priceView.render();
+  }
+}
+
+void cmdStats(SerialShell& shell, uint8_t argc, char* argv[]) {
+  Print& out = shell.out();
+  if (argc == 1) {
+    Metrics.printStats(out);
+  }
+  else if (strcmp(argv[1], "reset") == 0) {
+    Metrics.resetHistograms();
+    out.println("✅ 히스토그램을 초기화했습니다.");
+  }
+  else if (strcmp(argv[1], "stream") == 0 && argc > 2 && strcmp(argv[2], "off") == 0) {
+    statsStreamMs = 0;
+    out.println("✅ stats 스트리밍 중지");
+  }
+  else if (strcmp(argv[1], "stream") == 0) {
+    long period = argc > 2 ? atol(argv[2]) : 1000;
+    if (period < 100) period = 100;  // 시리얼 출력이 루프를 잡아먹지 않도록
+    statsStreamMs = uint32_t(period);
+    lastStatsMs = millis() - statsStreamMs;  // 바로 한 줄 출력
+    out.printf("✅ stats 스트리밍 %lu ms 간격 (중지: stats stream off)\n", (unsigned long)statsStreamMs);
+  }
+  else {
+    out.println("❌ 사용법: stats | stats stream [ms] | stats stream off | stats reset");
   }
 }
 
@@ -457,45 +263,40 @@ void setup() {
   initSPI_TFTDisplay();
   initI2C_OLEDDisplay();
   
-  // 디스플레이 업데이트 큐 생성 (10개 항목 저장 가능)
-  displayQueue = xQueueCreate(10, sizeof(DisplayData_t));
+  // 디스플레이 상태 우편함 생성
+  if (!displayState.begin()) {
+    Serial.println("Error creating the display mailbox");
+    while(1); // 생성 실패 시 정지
+  }
+  oledReader = displayState.reader();
   
-  if (displayQueue == NULL) {
-    Serial.println("Error creating the queue");
-    while(1); // 큐 생성 실패 시 정지
+  // 시세 조회기: 설정한 마켓을 한 번의 요청으로, 연결은 keep-alive로 유지
+  if (!Tickers.begin(tickerMarkets, tickerMarketCount, TICKER_BASE_URL, updateInterval)) {
+    Serial.println("Error setting up the ticker fetcher");
+    while(1);
   }
+  priceReader = Tickers.reader();
   
-  // 태스크 생성
-  xTaskCreatePinnedToCore(
-    oledTask,      // 태스크 함수
-    "OLED_Task",   // 태스크 이름
-    4096,          // 스택 크기
-    NULL,          // 파라미터
-    1,             // 우선순위
-    &oledTaskHandle, // 태스크 핸들
-    0              // 코어 0에서 실행
-  );
+  // 태스크 생성 (스택 크기는 Tasks.printReport()의 MinFree를 보고 조정)
+  // 가격 조회는 오래 걸리는 네트워크 작업이므로 화면 갱신보다 낮은 우선순위 (Ticker 태스크)
+  oledTaskHandle = Tasks.spawn("OLED_Task", oledTask, NULL, 4096, TaskPriority::Screen);
+  tftTaskHandle = Tasks.spawn("TFT_Task", tftTask, NULL, 4096, TaskPriority::Screen);
+  Tickers.start(8192, TaskPriority::Background);
+  Tasks.adopt("loop", NULL, 8192);  // Arduino loop 태스크 (가변 저항 읽기)
   
-  xTaskCreatePinnedToCore(
-    tftTask,       // 태스크 함수
-    "TFT_Task",    // 태스크 이름
-    8192,          // 스택 크기 (네트워크 작업을 위해 더 큰 스택 필요)
-    NULL,          // 파라미터
-    1,             // 우선순위
-    &tftTaskHandle, // 태스크 핸들
-    0              // 코어 0에서 실행
-  );
+  shell.add("stats", "[stream <ms>|off|reset]", "성능 지표 조회, 주기 출력, 히스토그램 초기화", cmdStats);
   
-  Serial.println("FreeRTOS tasks started");
+  Serial.println("FreeRTOS tasks started. Type 'help' for available commands.");
 }
 
 void loop() {
-  static unsigned long lastReadTime = 0;
   static int lastPotValue = -1;
+  static unsigned long lastReportTime = 0;
   
-  // 100ms마다 가변 저항 값을 읽음
-  if (millis() - lastReadTime > 100) {
-    lastReadTime = millis();
+  // 100ms마다 가변 저항 값을 읽음 (기다리는 동안은 블록되어 CPU를 쓰지 않음)
+  vTaskDelay(pdMS_TO_TICKS(POT_SAMPLE_MS));
+  {
+    WorkTimer work;
     
     // 가변 저항 값을 읽음 (0~4095)
     int potValue = analogRead(0);
@@ -513,13 +314,26 @@ void loop() {
         .percentage = percentage
       };
       
-      // 큐에 데이터 전송 (non-blocking)
-      if (xQueueSend(displayQueue, &displayData, 10 / portTICK_PERIOD_MS) != pdPASS) {
-        Serial.println("Queue full, dropped display update");
-      }
+      // 최신 값으로 덮어씀 (기다리지 않음, OLED가 느리면 중간 값은 건너뜀)
+      displayState.publish(displayData);
     }
   }
   
-  // 다른 태스크에 CPU 양보
-  vTaskDelay(1);
+  // 시리얼 명령 (loop가 100ms마다 깨어날 때 확인)
+  shell.poll();
+  if (statsStreamMs > 0 && millis() - lastStatsMs >= statsStreamMs) {
+    lastStatsMs += statsStreamMs;
+    Metrics.printSnapshot(Serial);
+  }
+  
+  // 태스크별 스택 여유와 CPU 사용률
+  if (millis() - lastReportTime >= TASK_REPORT_MS) {
+    lastReportTime = millis();
+    Tasks.printReport(Serial);
+    Serial.printf("OLED updates skipped: %lu\n", (unsigned long)oledReader.getSkipped());
+    Tickers.printStats(Serial);
+    Serial.printf("TFT: last update %u cells / %lu px, %lu px in %lu updates\n",
+                  (unsigned)priceView.getLastCells(), (unsigned long)priceView.getLastPixels(),
+                  (unsigned long)priceView.getTotalPixels(), (unsigned long)priceView.getRenderCount());
+  }
 }
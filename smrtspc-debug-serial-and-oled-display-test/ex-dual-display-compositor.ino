@@ -0,0 +1,129 @@
+// 72*40 supermini i2c oled display 와 76*284 spi tft display 에
+// 같은 화면(위젯 표 하나)을 합성기(Compositor)로 그리는 예제소스입니다.
+// 가변저항 값을 읽어 글자, 값, 막대, 스파크라인으로 보여줍니다.
+// 화면 구성은 아래 dashboard 표만 고치면 두 디스플레이에 모두 반영됩니다.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_ST7789.h>
+#include "miniDisplayManager.h"
+#include "compositor.h"
+#include "compositorBackends.h"
+
+// 가변 저항이 연결된 아날로그 핀 번호
+const int POT_PIN = 0; // GPIO0 (ADC1_CH0)에 연결
+
+// ST7789 SPI 디스플레이 핀 설정
+#define TFT_RST   1    // RST (Reset)
+#define TFT_DC    2    // DC (Data/Command)
+#define TFT_CS    7    // CS (Chip Select)
+#define TFT_MOSI  8    // SDA (SPI MOSI)
+#define TFT_SCLK  9    // SCL (SPI Clock)
+#define TFT_BLK   10   // BLK (Backlight)
+
+// SPI 클럭 속도 설정 (40MHz)
+#define SPI_FREQ_HZ 40000000
+
+// TFT 디스플레이 해상도 (90도 회전 고려)
+#define TFT_WIDTH  284
+#define TFT_HEIGHT 76
+
+// ST7789 객체 생성 (하드웨어 SPI 모드)
+Adafruit_ST7789 tft = Adafruit_ST7789(&SPI, TFT_CS, TFT_DC, TFT_RST);
+
+// 값 슬롯
+enum Slot : int8_t {
+  SLOT_PERCENT,
+  SLOT_RAW
+};
+
+// 디스플레이 번호 (addBackend 순서), 위젯을 한쪽에만 그릴 때 사용
+const uint8_t ON_OLED = 1 << 0;
+const uint8_t ON_TFT  = 1 << 1;
+
+// 화면 선언: 위치와 크기는 화면 대비 % (x, y, w, h)
+const Compositor::WidgetSpec dashboard[] = {
+  // kind                          x   y    w   h   slot          text             min  max   align                           displays
+  {Compositor::Kind::LABEL,        0,  0, 100, 25, -1,           "Potentiometer", 0,   0,    Compositor::Align::LEFT,   0},
+  {Compositor::Kind::VALUE,        0, 25,  50, 45, SLOT_PERCENT, "%",             0,   0,    Compositor::Align::LEFT,   0},
+  {Compositor::Kind::VALUE,       50, 25,  50, 45, SLOT_RAW,     "",              0,   0,    Compositor::Align::RIGHT,  ON_TFT},
+  {Compositor::Kind::BAR,          0, 75, 100, 25, SLOT_PERCENT, nullptr,         0,   100,  Compositor::Align::LEFT,   ON_OLED},
+  {Compositor::Kind::BAR,          0, 75,  45, 25, SLOT_PERCENT, nullptr,         0,   100,  Compositor::Align::LEFT,   ON_TFT},
+  {Compositor::Kind::SPARKLINE,   50, 75,  50, 25, SLOT_PERCENT, nullptr,         0,   100,  Compositor::Align::LEFT,   ON_TFT},
+};
+
+Compositor screen;
+OledBackend oledBackend(Display);
+TftBackend tftBackend(tft);
+
+// 디스플레이별 갱신 간격 (I2C OLED는 한 프레임 전송이 느리므로 더 길게)
+const uint16_t OLED_REFRESH_MS = 100;
+const uint16_t TFT_REFRESH_MS = 50;
+
+// 가변 저항 읽기 주기, 통계 출력 주기
+const uint32_t POT_SAMPLE_MS = 20;
+const uint32_t STATS_PRINT_MS = 5000;
+
+void initSPI_TFTDisplay() {
+  Serial.println("Initializing SPI TFT display...");
+
+  // 백라이트 핀 설정 (LOW일 때 켜지는 타입)
+  pinMode(TFT_BLK, OUTPUT);
+  digitalWrite(TFT_BLK, LOW);
+
+  // 하드웨어 SPI 핀 지정 (MISO는 사용하지 않음). tft.init()보다 먼저 해야 이 핀이 유지된다
+  SPI.begin(TFT_SCLK, -1, TFT_MOSI, TFT_CS);
+
+  tft.init(TFT_HEIGHT, TFT_WIDTH);  // swap width/height for rotation
+  tft.setSPISpeed(SPI_FREQ_HZ);      // init()이 기본 클럭으로 되돌리므로 그 다음에 설정
+  tft.setRotation(1);
+  tft.invertDisplay(false);
+
+  Serial.println("SPI TFT Display setup complete.");
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(1000);
+  Serial.println("Starting ESP32-C3 dual display compositor");
+
+  Display.begin();
+  initSPI_TFTDisplay();
+
+  // 디스플레이 등록 순서가 위 ON_OLED / ON_TFT 비트 순서
+  screen.addBackend(oledBackend, OLED_REFRESH_MS);
+  screen.addBackend(tftBackend, TFT_REFRESH_MS);
+  screen.setScreen(dashboard);
+}
+
+void loop() {
+  static unsigned long lastSample = 0;
+  static unsigned long lastStats = 0;
+  unsigned long now = millis();
+
+  if (now - lastSample >= POT_SAMPLE_MS) {
+    lastSample = now;
+
+    // 가변 저항 값을 읽습니다 (0~4095). 노이즈 필터링을 위해 4단위로 자름
+    int potValue = analogRead(POT_PIN) & ~0x3;
+    screen.set(SLOT_RAW, potValue);
+    screen.set(SLOT_PERCENT, map(potValue, 0, 4095, 0, 100));
+  }
+
+  // 값이 바뀐 위젯만, 각 디스플레이의 갱신 간격에 맞춰 다시 그림
+  screen.update(now);
+
+  if (now - lastStats >= STATS_PRINT_MS) {
+    lastStats = now;
+    for (uint8_t i = 0; i < 2; i++) {
+      const Compositor::BackendStats& stats = screen.getStats(i);
+      Serial.printf("%s: frames %lu, widgets drawn %lu, deferred %lu\n", i == 0 ? "OLED" : "TFT",
+                    (unsigned long)stats.frames, (unsigned long)stats.widgetsDrawn,
+                    (unsigned long)stats.deferredUpdates);
+    }
+    Serial.printf("OLED last flush %u bytes\n", (unsigned)Display.getLastFlushBytes());
+  }
+
+  delay(5);
+}
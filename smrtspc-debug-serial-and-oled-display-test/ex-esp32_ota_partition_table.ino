@@ -8,7 +8,6 @@
 #include <EEPROM.h>
 #include <nvs_flash.h>
 #include <nvs.h>
-#include <map>
 #include <numeric>
 
 #define EEPROM_SIZE 512  // EEPROM size
@@ -16,6 +15,9 @@
 // #include <esp_flash.h>  // Not needed if using ESP.getFlashChipSize()
 #include <esp_ota_ops.h>   // For esp_ota_get_running_partition()
 #include <ESP.h>           // For ESP.getFlashChipSize()
+#include "metricsRegistry.h"
+#include "serialShell.h"
+#include "nvsIndex.h"
 
 /**
  * @brief 현재 ESP32 장치의 플래시 파티션 정보를 조회하여 출력합니다.
@@ -166,169 +168,20 @@ void testNVS() {
   nvs_close(my_handle);
 }
 
-void listAllNVSContents() {
-  // Initialize Serial if not already done
-  if (!Serial) {
-    Serial.begin(115200);
-    while (!Serial) { ; }
-  }
-  
-  Serial.println("\n📋 NVS 전체 내용 나열:");
-  Serial.println("========================");
-  
-  // Maps for tracking entries per namespace
-  std::map<String, int> namespace_entries;
-  std::map<String, int> actual_entry_counts;
-  
-  // Initialize NVS iterator
-  nvs_iterator_t it = NULL;
-  esp_err_t res = nvs_entry_find("nvs", NULL, NVS_TYPE_ANY, &it);
-  
-  if (res != ESP_OK) {
-    Serial.println("❌ NVS 엔트리를 찾을 수 없습니다.");
-    return;
-  }
-  
-  // First pass: collect all namespaces
-  while (res == ESP_OK) {
-    nvs_entry_info_t info;
-    nvs_entry_info(it, &info);
-    String ns_name = String(info.namespace_name);
-    namespace_entries[ns_name] = 0;
-    actual_entry_counts[ns_name] = 0;
-    res = nvs_entry_next(&it);
-  }
-  nvs_release_iterator(it);
-  
-  // Process each namespace
-  size_t namespace_index = 0;
-  for (auto& ns : namespace_entries) {
-    const char* namespace_name = ns.first.c_str();
-    int entry_count = 0;
-    
-    Serial.printf("\n📁 네임스페이스: %s\n", namespace_name);
-    
-    // Find all entries in this namespace
-    nvs_iterator_t ns_it = NULL;
-    esp_err_t ns_res = nvs_entry_find("nvs", namespace_name, NVS_TYPE_ANY, &ns_it);
-    
-    while (ns_res == ESP_OK) {
-      nvs_entry_info_t info;
-      nvs_entry_info(ns_it, &info);
-      
-      // Only process entries in the current namespace
-      if (strcmp(namespace_name, info.namespace_name) != 0) {
-        ns_res = nvs_entry_next(&ns_it);
-        continue;
-      }
-      
-      // Open the namespace
-      nvs_handle_t handle;
-      if (nvs_open(info.namespace_name, NVS_READONLY, &handle) != ESP_OK) {
-        Serial.printf("  ❌ Failed to open namespace: %s\n", info.namespace_name);
-        ns_res = nvs_entry_next(&ns_it);
-        continue;
-      }
-      
-      // Count and display the entry
-      actual_entry_counts[String(info.namespace_name)]++;
-      entry_count++;
-      
-      // Display the entry based on its type
-      esp_err_t err = ESP_OK;
-      switch (info.type) {
-        case NVS_TYPE_I8: {
-          int8_t val;
-          err = nvs_get_i8(handle, info.key, &val);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: int8   | 값: %d\n", info.key, val);
-          break;
-        }
-        case NVS_TYPE_U8: {
-          uint8_t val;
-          err = nvs_get_u8(handle, info.key, &val);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: uint8  | 값: %u\n", info.key, val);
-          break;
-        }
-        case NVS_TYPE_I16: {
-          int16_t val;
-          err = nvs_get_i16(handle, info.key, &val);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: int16  | 값: %d\n", info.key, val);
-          break;
-        }
-        case NVS_TYPE_U16: {
-          uint16_t val;
-          err = nvs_get_u16(handle, info.key, &val);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: uint16 | 값: %u\n", info.key, val);
-          break;
-        }
-        case NVS_TYPE_I32: {
-          int32_t val;
-          err = nvs_get_i32(handle, info.key, &val);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: int32  | 값: %d\n", info.key, val);
-          break;
-        }
-        case NVS_TYPE_U32: {
-          uint32_t val;
-          err = nvs_get_u32(handle, info.key, &val);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: uint32 | 값: %u\n", info.key, val);
-          break;
-        }
-        case NVS_TYPE_STR: {
-          size_t len;
-          err = nvs_get_str(handle, info.key, NULL, &len);
-          if (err == ESP_OK) {
-            char* str = (char*)malloc(len);
-            if (str) {
-              nvs_get_str(handle, info.key, str, &len);
-              Serial.printf("  🔑 %-20s | 타입: string | 값: %s\n", info.key, str);
-              free(str);
-            }
-          }
-          break;
-        }
-        case NVS_TYPE_BLOB: {
-          size_t len;
-          err = nvs_get_blob(handle, info.key, NULL, &len);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: blob   | 크기: %d bytes\n", info.key, len);
-          break;
-        }
-        default:
-          Serial.printf("  🔑 %-20s | 알 수 없는 타입: %d\n", info.key, info.type);
-      }
-      
-      if (err != ESP_OK) {
-        Serial.printf("  ❌ %-20s | 읽기 실패: %s\n", info.key, esp_err_to_name(err));
-      }
-      
-      nvs_close(handle);
-      ns_res = nvs_entry_next(&ns_it);
-    }
-    // Clean up the iterator
-    if (ns_it) {
-      nvs_release_iterator(ns_it);
-      ns_it = NULL;
-    }
-    
-    // Print entry count for this namespace
-    Serial.printf("  └── 총 %d개 엔트리\n", entry_count);
-    
-    // Print separator if not the last namespace
-    if (++namespace_index < namespace_entries.size()) {
-      Serial.println("------------------------");
-    }
-  }
-  
-  // Print summary
-  Serial.println("\n📊 네임스페이스 요약:");
-  int total_entries = 0;
-  for (auto const& ns : actual_entry_counts) {
-    Serial.printf("  - %-15s: %d개 엔트리\n", ns.first.c_str(), ns.second);
-    total_entries += ns.second;
+// NVS 전체를 한 번 읽어 둔 색인. show는 플래시를 다시 읽지 않고 여기서 찾는다
+NvsIndex nvsIndex;
+
+// 색인을 다시 읽는다 (NVS를 바꾼 뒤에 호출)
+void rescanNVS() {
+  esp_err_t err = nvsIndex.scan();
+  if (err != ESP_OK) {
+    Serial.printf("⚠️ 일부 엔트리를 읽지 못했습니다: %s\n", esp_err_to_name(err));
   }
-  
-  Serial.printf("\n✅ 총 %d개의 네임스페이스, %d개의 엔트리가 조회되었습니다.\n", 
-               (int)actual_entry_counts.size(), total_entries);
-  Serial.println("========================");
+}
+
+void listAllNVSContents() {
+  rescanNVS();
+  nvsIndex.printAll(Serial);
 }
 
 void dumpNVS() {
@@ -448,184 +301,80 @@ void dumpEEPROM() {
   Serial.println("==========================");
 }
 
-void showNVSValue(String keyPath) {
-  int firstDotIndex = keyPath.indexOf('.');
-  if (firstDotIndex == -1) {
+void showNVSValue(const char* keyPath) {
+  if (strchr(keyPath, '.') == NULL) {
     Serial.println("❌ 잘못된 형식입니다. '네임스페이스.키' 형식으로 입력해주세요 (예: phy.cal_mac)");
-    Serial.println("⚠️  참고: nvs.net80211.* 네임스페이스는 보안상 직접 접근이 제한될 수 있습니다.");
     return;
   }
 
-  String namespaceName = keyPath.substring(0, firstDotIndex);
-  String keyName = keyPath.substring(firstDotIndex + 1);
-  
-  nvs_handle_t handle;
-  esp_err_t err;
-  
-  // For PHY and other standard namespaces
-  if (namespaceName == "phy" || namespaceName == "nvs") {
-    // Try opening with default partition first
-    err = nvs_open(namespaceName.c_str(), NVS_READONLY, &handle);
-    
-    // If that fails, try with explicit partition
-    if (err != ESP_OK) {
-      err = nvs_open_from_partition("nvs", namespaceName.c_str(), NVS_READONLY, &handle);
-    }
-    
-    // Special case for WiFi settings (just show a helpful message)
-    if (namespaceName == "nvs" && keyName.startsWith("net80211")) {
-      Serial.println("⚠️  WiFi 설정(nvs.net80211.*)은 보안상 직접 접근이 제한됩니다.");
-      Serial.println("    대신 WiFi.SSID(), WiFi.BSSIDstr() 등의 API를 사용해주세요.");
-      return;
-    }
-  } 
-  // For other namespaces
-  else {
-    err = nvs_open(namespaceName.c_str(), NVS_READONLY, &handle);
-  }
-  if (err != ESP_OK) {
-    // Only show error if this is a direct user request (not during scanning)
-    Serial.printf("❌ 네임스페이스 '%s'을(를) 찾을 수 없습니다.\n", namespaceName.c_str());
+  const NvsIndex::Entry* entry = nvsIndex.find(keyPath);
+  if (entry == NULL) {
+    Serial.printf("❌ 키 '%s'이(가) 존재하지 않습니다. (dump nvs 로 목록 확인)\n", keyPath);
     return;
   }
 
-  // Try to determine the key type by attempting to read with different types
-  esp_err_t read_err;
-  
-  // Try reading as string first
-  size_t str_len;
-  read_err = nvs_get_str(handle, keyName.c_str(), NULL, &str_len);
-  if (read_err == ESP_OK) {
-    char* str = (char*)malloc(str_len);
-    if (str) {
-      read_err = nvs_get_str(handle, keyName.c_str(), str, &str_len);
-      if (read_err == ESP_OK) {
-        Serial.printf("📌 %s.%s (string): %s\n", namespaceName.c_str(), keyName.c_str(), str);
-      }
-      free(str);
-      nvs_close(handle);
-      return;
-    }
-  }
-  
-  // Try reading as blob
-  size_t blob_len;
-  read_err = nvs_get_blob(handle, keyName.c_str(), NULL, &blob_len);
-  if (read_err == ESP_OK) {
-    uint8_t* blob = (uint8_t*)malloc(blob_len);
-    if (blob) {
-      read_err = nvs_get_blob(handle, keyName.c_str(), blob, &blob_len);
-      if (read_err == ESP_OK) {
-        Serial.printf("📌 %s.%s (blob, %d bytes): ", namespaceName.c_str(), keyName.c_str(), blob_len);
-        for (size_t i = 0; i < blob_len && i < 32; i++) {
-          Serial.printf("%02X ", blob[i]);
-        }
-        if (blob_len > 32) Serial.print("...");
-        Serial.println();
-      }
-      free(blob);
-      nvs_close(handle);
-      return;
-    }
-  }
-  
-  // Try reading as different numeric types
-  int8_t i8_val;
-  read_err = nvs_get_i8(handle, keyName.c_str(), &i8_val);
-  if (read_err == ESP_OK) {
-    Serial.printf("📌 %s.%s (int8): %d\n", namespaceName.c_str(), keyName.c_str(), i8_val);
-    nvs_close(handle);
-    return;
-  }
-  
-  uint8_t u8_val;
-  read_err = nvs_get_u8(handle, keyName.c_str(), &u8_val);
-  if (read_err == ESP_OK) {
-    Serial.printf("📌 %s.%s (uint8): %u\n", namespaceName.c_str(), keyName.c_str(), u8_val);
-    nvs_close(handle);
-    return;
-  }
-  
-  int16_t i16_val;
-  read_err = nvs_get_i16(handle, keyName.c_str(), &i16_val);
-  if (read_err == ESP_OK) {
-    Serial.printf("📌 %s.%s (int16): %d\n", namespaceName.c_str(), keyName.c_str(), i16_val);
-    nvs_close(handle);
-    return;
-  }
-  
-  uint16_t u16_val;
-  read_err = nvs_get_u16(handle, keyName.c_str(), &u16_val);
-  if (read_err == ESP_OK) {
-    Serial.printf("📌 %s.%s (uint16): %u\n", namespaceName.c_str(), keyName.c_str(), u16_val);
-    nvs_close(handle);
-    return;
+  nvsIndex.printDetail(Serial, *entry);
+}
+
+// "stats stream <ms>" 주기 (0 = 끔)
+uint32_t statsStreamMs = 0;
+uint32_t lastStatsMs = 0;
+
+SerialShell shell(Serial);
+
+void cmdDump(SerialShell& shell, uint8_t argc, char* argv[]) {
+  if (argc == 2 && strcmp(argv[1], "nvs") == 0) {
+    dumpNVS();
+  } else if (argc == 2 && strcmp(argv[1], "eeprom") == 0) {
+    dumpEEPROM();
+  } else {
+    shell.out().println("❌ 사용법: dump nvs | dump eeprom");
   }
-  
-  int32_t i32_val;
-  read_err = nvs_get_i32(handle, keyName.c_str(), &i32_val);
-  if (read_err == ESP_OK) {
-    Serial.printf("📌 %s.%s (int32): %d\n", namespaceName.c_str(), keyName.c_str(), i32_val);
-    nvs_close(handle);
+}
+
+void cmdDelete(SerialShell& shell, uint8_t argc, char* argv[]) {
+  if (argc < 2) {
+    shell.out().println("❌ 삭제할 네임스페이스 이름을 입력해주세요. 예: delete wifi_config");
     return;
   }
-  
-  uint32_t u32_val;
-  read_err = nvs_get_u32(handle, keyName.c_str(), &u32_val);
-  if (read_err == ESP_OK) {
-    Serial.printf("📌 %s.%s (uint32): %u\n", namespaceName.c_str(), keyName.c_str(), u32_val);
-    nvs_close(handle);
+  deleteNamespace(argv[1]);
+  rescanNVS();
+}
+
+void cmdShow(SerialShell& shell, uint8_t argc, char* argv[]) {
+  if (argc < 2) {
+    shell.out().println("❌ 조회할 키를 입력해주세요. 예: show nvs.net80211.sta.ssid");
     return;
   }
-  
-  // If we get here, we couldn't determine the key type
-  Serial.printf("❌ 키 '%s'의 타입을 확인할 수 없거나 존재하지 않습니다.\n", keyName.c_str());
-  nvs_close(handle);
-  return;
+  showNVSValue(argv[1]);
+}
 
+void cmdTable(SerialShell&, uint8_t, char*[]) {
+  printFlashPartitionInfo();
 }
 
-void handleSerialCommands() {
-  if (Serial.available() > 0) {
-    String command = Serial.readStringUntil('\n');
-    command.trim();
-    
-    if (command == "dump nvs") {
-      dumpNVS();
-    } 
-    else if (command == "dump eeprom") {
-      dumpEEPROM();
-    }
-    else if (command.startsWith("delete ")) {
-      String ns_to_delete = command.substring(7);
-      if (ns_to_delete.length() > 0) {
-        deleteNamespace(ns_to_delete.c_str());
-      } else {
-        Serial.println("❌ 삭제할 네임스페이스 이름을 입력해주세요. 예: delete wifi_config");
-      }
-    }
-    else if (command.startsWith("show ")) {
-      String keyPath = command.substring(5);
-      if (keyPath.length() > 0) {
-        showNVSValue(keyPath);
-      } else {
-        Serial.println("❌ 조회할 키를 입력해주세요. 예: show nvs.net80211.sta.ssid");
-      }
-    }
-    else if (command.startsWith("table")){
-      printFlashPartitionInfo();
-    }
-    else if (command == "help") {
-      Serial.println("\n사용 가능한 명령어:");
-      Serial.println("  dump nvs          - NVS 내용 조회");
-      Serial.println("  dump eeprom       - EEPROM 내용 조회");
-      Serial.println("  delete <네임스페이스> - 특정 네임스페이스 삭제");
-      Serial.println("  show <키경로>     - 특정 키의 값 조회 (예: show nvs.net80211.sta.ssid)");
-      Serial.println("  help              - 도움말 보기");
-    }
-    else if (command != "") {
-      Serial.println("❌ Unknown command. Type 'help' for available commands.");
-    }
+void cmdStats(SerialShell& shell, uint8_t argc, char* argv[]) {
+  Print& out = shell.out();
+  if (argc == 1) {
+    Metrics.printStats(out);
+  }
+  else if (strcmp(argv[1], "reset") == 0) {
+    Metrics.resetHistograms();
+    out.println("✅ 히스토그램을 초기화했습니다.");
+  }
+  else if (strcmp(argv[1], "stream") == 0 && argc > 2 && strcmp(argv[2], "off") == 0) {
+    statsStreamMs = 0;
+    out.println("✅ stats 스트리밍 중지");
+  }
+  else if (strcmp(argv[1], "stream") == 0) {
+    long period = argc > 2 ? atol(argv[2]) : 1000;
+    if (period < 100) period = 100;  // 시리얼 출력이 루프를 잡아먹지 않도록
+    statsStreamMs = uint32_t(period);
+    lastStatsMs = millis() - statsStreamMs;  // 바로 한 줄 출력
+    out.printf("✅ stats 스트리밍 %lu ms 간격 (중지: stats stream off)\n", (unsigned long)statsStreamMs);
+  }
+  else {
+    out.println("❌ 사용법: stats | stats stream [ms] | stats stream off | stats reset");
   }
 }
 
@@ -635,10 +384,19 @@ void setup() {
   
   // Initialize NVS first
   initNVS();
+  rescanNVS();
   
   // Initialize EEPROM with the defined size
   EEPROM.begin(EEPROM_SIZE);
   
+  Metrics.watchTask("loopTask", xTaskGetCurrentTaskHandle());
+
+  shell.add("dump", "nvs|eeprom", "NVS/EEPROM 내용 조회", cmdDump);
+  shell.add("delete", "<네임스페이스>", "특정 네임스페이스 삭제", cmdDelete);
+  shell.add("show", "<키경로>", "특정 키의 값 조회 (예: show nvs.net80211.sta.ssid)", cmdShow);
+  shell.add("table", "", "플래시 파티션 구성 조회", cmdTable);
+  shell.add("stats", "[stream <ms>|off|reset]", "성능 지표 조회, 주기 출력, 히스토그램 초기화", cmdStats);
+
   Serial.println("\n🔧 System started. Type 'help' for available commands.");
   
   WiFi.persistent(false);             // 자동 저장 막기
@@ -664,8 +422,12 @@ void setup() {
 }
 
 void loop() {
-  handleSerialCommands();
-  delay(100);
+  shell.poll();
+  if (statsStreamMs > 0 && millis() - lastStatsMs >= statsStreamMs) {
+    lastStatsMs += statsStreamMs;
+    Metrics.printSnapshot(Serial);
+  }
+  delay(10);
 }
 
 
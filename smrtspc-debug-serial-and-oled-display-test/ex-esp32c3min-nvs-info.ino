@@ -3,11 +3,23 @@
 #include <EEPROM.h>
 #include <nvs_flash.h>
 #include <nvs.h>
-#include <map>
 #include <numeric>
+#include "serialShell.h"
+#include "nvsIndex.h"
+#include "settingsStore.h"
 
 #define EEPROM_SIZE 512  // EEPROM size
 
+// 자주 바뀌는 설정은 SettingsStore로: 읽기는 RAM 사본, 쓰기는 모아서 한 번에 commit
+#define DEVICE_SETTINGS(FIELD) \
+  FIELD(int32_t, testValue, 0) \
+  FIELD(uint8_t, contrast, 150) \
+  FIELD(int8_t, motorTrim, 0) \
+  FIELD(uint32_t, refreshMs, 60000)
+SETTINGS_SCHEMA(DeviceSettings, DEVICE_SETTINGS, 1)
+
+SettingsRecord<DeviceSettings> deviceSettings("device");
+
 void initNVS() {
   esp_err_t ret = nvs_flash_init();
   
@@ -39,204 +51,56 @@ void initNVS() {
   Serial.println("✅ NVS initialized successfully");
 }
 
+// 예전 testNVS()는 storage/test_key(i32)에 값을 따로 썼다. 지금은 device 설정 묶음의 testValue가
+// 그 자리를 대신하므로, 남아 있는 예전 키는 한 번 옮겨 담고 지운다
+void migrateOldTestKey() {
+  nvs_handle_t handle;
+  if (nvs_open("storage", NVS_READWRITE, &handle) != ESP_OK) return;
+
+  int32_t oldValue = 0;
+  if (nvs_get_i32(handle, "test_key", &oldValue) == ESP_OK) {
+    if (!deviceSettings.isStored()) {
+      deviceSettings.set(&DeviceSettings::testValue, oldValue);
+    }
+    if (Settings.commit() == ESP_OK && nvs_erase_key(handle, "test_key") == ESP_OK) {
+      nvs_commit(handle);
+      Serial.printf("ℹ️ storage/test_key (%d) → settings/device.testValue 로 옮겼습니다\n", oldValue);
+    }
+  }
+  nvs_close(handle);
+}
+
 void testNVS() {
   Serial.println("\n🧪 Testing NVS...");
-  
-  // Test writing and reading a value
-  nvs_handle_t my_handle;
-  esp_err_t err;
-  
-  // Open NVS
-  err = nvs_open("storage", NVS_READWRITE, &my_handle);
-  if (err != ESP_OK) {
-    Serial.printf("❌ Error opening NVS: %s\n", esp_err_to_name(err));
-    return;
-  }
-  
-  // Try to read a test value
-  int32_t test_value = 0;
-  err = nvs_get_i32(my_handle, "test_key", &test_value);
-  
-  if (err == ESP_ERR_NVS_NOT_FOUND) {
+  migrateOldTestKey();
+
+  // 값이 0이어도 저장된 것일 수 있으므로 값이 아니라 저장 여부로 판단 (읽기는 RAM 사본)
+  if (!deviceSettings.isStored()) {
     Serial.println("ℹ️ No test value found, writing one...");
-    test_value = 1234;
-    err = nvs_set_i32(my_handle, "test_key", test_value);
-    if (err == ESP_OK) {
-      err = nvs_commit(my_handle);
-      if (err == ESP_OK) {
-        Serial.println("✅ Test value written successfully");
-      }
+    deviceSettings.set(&DeviceSettings::testValue, int32_t(1234));
+    // 보통은 자동 commit에 맡기지만 여기서는 바로 확인하려고 직접 commit
+    if (Settings.commit() == ESP_OK) {
+      Serial.println("✅ Test value written successfully");
     }
-  } else if (err == ESP_OK) {
-    Serial.printf("✅ Read test value: %d\n", test_value);
+  } else {
+    Serial.printf("✅ Read test value: %d\n", (int)deviceSettings.get().testValue);
   }
-  
-  nvs_close(my_handle);
 }
 
-void listAllNVSContents() {
-  // Initialize Serial if not already done
-  if (!Serial) {
-    Serial.begin(115200);
-    while (!Serial) { ; }
-  }
-  
-  Serial.println("\n📋 NVS 전체 내용 나열:");
-  Serial.println("========================");
-  
-  // Maps for tracking entries per namespace
-  std::map<String, int> namespace_entries;
-  std::map<String, int> actual_entry_counts;
-  
-  // Initialize NVS iterator
-  nvs_iterator_t it = NULL;
-  esp_err_t res = nvs_entry_find("nvs", NULL, NVS_TYPE_ANY, &it);
-  
-  if (res != ESP_OK) {
-    Serial.println("❌ NVS 엔트리를 찾을 수 없습니다.");
-    return;
-  }
-  
-  // First pass: collect all namespaces
-  while (res == ESP_OK) {
-    nvs_entry_info_t info;
-    nvs_entry_info(it, &info);
-    String ns_name = String(info.namespace_name);
-    namespace_entries[ns_name] = 0;
-    actual_entry_counts[ns_name] = 0;
-    res = nvs_entry_next(&it);
-  }
-  nvs_release_iterator(it);
-  
-  // Process each namespace
-  size_t namespace_index = 0;
-  for (auto& ns : namespace_entries) {
-    const char* namespace_name = ns.first.c_str();
-    int entry_count = 0;
-    
-    Serial.printf("\n📁 네임스페이스: %s\n", namespace_name);
-    
-    // Find all entries in this namespace
-    nvs_iterator_t ns_it = NULL;
-    esp_err_t ns_res = nvs_entry_find("nvs", namespace_name, NVS_TYPE_ANY, &ns_it);
-    
-    while (ns_res == ESP_OK) {
-      nvs_entry_info_t info;
-      nvs_entry_info(ns_it, &info);
-      
-      // Only process entries in the current namespace
-      if (strcmp(namespace_name, info.namespace_name) != 0) {
-        ns_res = nvs_entry_next(&ns_it);
-        continue;
-      }
-      
-      // Open the namespace
-      nvs_handle_t handle;
-      if (nvs_open(info.namespace_name, NVS_READONLY, &handle) != ESP_OK) {
-        Serial.printf("  ❌ Failed to open namespace: %s\n", info.namespace_name);
-        ns_res = nvs_entry_next(&ns_it);
-        continue;
-      }
-      
-      // Count and display the entry
-      actual_entry_counts[String(info.namespace_name)]++;
-      entry_count++;
-      
-      // Display the entry based on its type
-      esp_err_t err = ESP_OK;
-      switch (info.type) {
-        case NVS_TYPE_I8: {
-          int8_t val;
-          err = nvs_get_i8(handle, info.key, &val);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: int8   | 값: %d\n", info.key, val);
-          break;
-        }
-        case NVS_TYPE_U8: {
-          uint8_t val;
-          err = nvs_get_u8(handle, info.key, &val);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: uint8  | 값: %u\n", info.key, val);
-          break;
-        }
-        case NVS_TYPE_I16: {
-          int16_t val;
-          err = nvs_get_i16(handle, info.key, &val);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: int16  | 값: %d\n", info.key, val);
-          break;
-        }
-        case NVS_TYPE_U16: {
-          uint16_t val;
-          err = nvs_get_u16(handle, info.key, &val);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: uint16 | 값: %u\n", info.key, val);
-          break;
-        }
-        case NVS_TYPE_I32: {
-          int32_t val;
-          err = nvs_get_i32(handle, info.key, &val);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: int32  | 값: %d\n", info.key, val);
-          break;
-        }
-        case NVS_TYPE_U32: {
-          uint32_t val;
-          err = nvs_get_u32(handle, info.key, &val);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: uint32 | 값: %u\n", info.key, val);
-          break;
-        }
-        case NVS_TYPE_STR: {
-          size_t len;
-          err = nvs_get_str(handle, info.key, NULL, &len);
-          if (err == ESP_OK) {
-            char* str = (char*)malloc(len);
-            if (str) {
-              nvs_get_str(handle, info.key, str, &len);
-              Serial.printf("  🔑 %-20s | 타입: string | 값: %s\n", info.key, str);
-              free(str);
-            }
-          }
-          break;
-        }
-        case NVS_TYPE_BLOB: {
-          size_t len;
-          err = nvs_get_blob(handle, info.key, NULL, &len);
-          if (err == ESP_OK) Serial.printf("  🔑 %-20s | 타입: blob   | 크기: %d bytes\n", info.key, len);
-          break;
-        }
-        default:
-          Serial.printf("  🔑 %-20s | 알 수 없는 타입: %d\n", info.key, info.type);
-      }
-      
-      if (err != ESP_OK) {
-        Serial.printf("  ❌ %-20s | 읽기 실패: %s\n", info.key, esp_err_to_name(err));
-      }
-      
-      nvs_close(handle);
-      ns_res = nvs_entry_next(&ns_it);
-    }
-    // Clean up the iterator
-    if (ns_it) {
-      nvs_release_iterator(ns_it);
-      ns_it = NULL;
-    }
-    
-    // Print entry count for this namespace
-    Serial.printf("  └── 총 %d개 엔트리\n", entry_count);
-    
-    // Print separator if not the last namespace
-    if (++namespace_index < namespace_entries.size()) {
-      Serial.println("------------------------");
-    }
-  }
-  
-  // Print summary
-  Serial.println("\n📊 네임스페이스 요약:");
-  int total_entries = 0;
-  for (auto const& ns : actual_entry_counts) {
-    Serial.printf("  - %-15s: %d개 엔트리\n", ns.first.c_str(), ns.second);
-    total_entries += ns.second;
+// NVS 전체를 한 번 읽어 둔 색인. show는 플래시를 다시 읽지 않고 여기서 찾는다
+NvsIndex nvsIndex;
+
+// 색인을 다시 읽는다 (NVS를 바꾼 뒤에 호출)
+void rescanNVS() {
+  esp_err_t err = nvsIndex.scan();
+  if (err != ESP_OK) {
+    Serial.printf("⚠️ 일부 엔트리를 읽지 못했습니다: %s\n", esp_err_to_name(err));
   }
-  
-  Serial.printf("\n✅ 총 %d개의 네임스페이스, %d개의 엔트리가 조회되었습니다.\n", 
-               (int)actual_entry_counts.size(), total_entries);
-  Serial.println("========================");
+}
+
+void listAllNVSContents() {
+  rescanNVS();
+  nvsIndex.printAll(Serial);
 }
 
 void dumpNVS() {
@@ -356,194 +220,234 @@ void dumpEEPROM() {
   Serial.println("==========================");
 }
 
-void showNVSValue(String keyPath) {
-  int firstDotIndex = keyPath.indexOf('.');
-  if (firstDotIndex == -1) {
+void showNVSValue(const char* keyPath) {
+  if (strchr(keyPath, '.') == NULL) {
     Serial.println("❌ 잘못된 형식입니다. '네임스페이스.키' 형식으로 입력해주세요 (예: phy.cal_mac)");
-    Serial.println("⚠️  참고: nvs.net80211.* 네임스페이스는 보안상 직접 접근이 제한될 수 있습니다.");
     return;
   }
 
-  String namespaceName = keyPath.substring(0, firstDotIndex);
-  String keyName = keyPath.substring(firstDotIndex + 1);
-  
-  nvs_handle_t handle;
-  esp_err_t err;
-  
-  // For PHY and other standard namespaces
-  if (namespaceName == "phy" || namespaceName == "nvs") {
-    // Try opening with default partition first
-    err = nvs_open(namespaceName.c_str(), NVS_READONLY, &handle);
-    
-    // If that fails, try with explicit partition
-    if (err != ESP_OK) {
-      err = nvs_open_from_partition("nvs", namespaceName.c_str(), NVS_READONLY, &handle);
-    }
-    
-    // Special case for WiFi settings (just show a helpful message)
-    if (namespaceName == "nvs" && keyName.startsWith("net80211")) {
-      Serial.println("⚠️  WiFi 설정(nvs.net80211.*)은 보안상 직접 접근이 제한됩니다.");
-      Serial.println("    대신 WiFi.SSID(), WiFi.BSSIDstr() 등의 API를 사용해주세요.");
-      return;
-    }
-  } 
-  // For other namespaces
-  else {
-    err = nvs_open(namespaceName.c_str(), NVS_READONLY, &handle);
-  }
-  if (err != ESP_OK) {
-    // Only show error if this is a direct user request (not during scanning)
-    Serial.printf("❌ 네임스페이스 '%s'을(를) 찾을 수 없습니다.\n", namespaceName.c_str());
+  const NvsIndex::Entry* entry = nvsIndex.find(keyPath);
+  if (entry == NULL) {
+    Serial.printf("❌ 키 '%s'이(가) 존재하지 않습니다. (dump nvs 로 목록 확인)\n", keyPath);
     return;
   }
 
-  // Try to determine the key type by attempting to read with different types
-  esp_err_t read_err;
-  
-  // Try reading as string first
-  size_t str_len;
-  read_err = nvs_get_str(handle, keyName.c_str(), NULL, &str_len);
-  if (read_err == ESP_OK) {
-    char* str = (char*)malloc(str_len);
-    if (str) {
-      read_err = nvs_get_str(handle, keyName.c_str(), str, &str_len);
-      if (read_err == ESP_OK) {
-        Serial.printf("📌 %s.%s (string): %s\n", namespaceName.c_str(), keyName.c_str(), str);
-      }
-      free(str);
-      nvs_close(handle);
-      return;
-    }
-  }
-  
-  // Try reading as blob
-  size_t blob_len;
-  read_err = nvs_get_blob(handle, keyName.c_str(), NULL, &blob_len);
-  if (read_err == ESP_OK) {
-    uint8_t* blob = (uint8_t*)malloc(blob_len);
-    if (blob) {
-      read_err = nvs_get_blob(handle, keyName.c_str(), blob, &blob_len);
-      if (read_err == ESP_OK) {
-        Serial.printf("📌 %s.%s (blob, %d bytes): ", namespaceName.c_str(), keyName.c_str(), blob_len);
-        for (size_t i = 0; i < blob_len && i < 32; i++) {
-          Serial.printf("%02X ", blob[i]);
-        }
-        if (blob_len > 32) Serial.print("...");
-        Serial.println();
-      }
-      free(blob);
-      nvs_close(handle);
-      return;
-    }
-  }
-  
-  // Try reading as different numeric types
-  int8_t i8_val;
-  read_err = nvs_get_i8(handle, keyName.c_str(), &i8_val);
-  if (read_err == ESP_OK) {
-    Serial.printf("📌 %s.%s (int8): %d\n", namespaceName.c_str(), keyName.c_str(), i8_val);
-    nvs_close(handle);
-    return;
-  }
-  
-  uint8_t u8_val;
-  read_err = nvs_get_u8(handle, keyName.c_str(), &u8_val);
-  if (read_err == ESP_OK) {
-    Serial.printf("📌 %s.%s (uint8): %u\n", namespaceName.c_str(), keyName.c_str(), u8_val);
-    nvs_close(handle);
-    return;
+  nvsIndex.printDetail(Serial, *entry);
+}
+
+SerialShell shell(Serial);
+
+void cmdDump(SerialShell& shell, uint8_t argc, char* argv[]) {
+  if (argc == 2 && strcmp(argv[1], "nvs") == 0) {
+    dumpNVS();
+  } else if (argc == 2 && strcmp(argv[1], "eeprom") == 0) {
+    dumpEEPROM();
+  } else {
+    shell.out().println("❌ 사용법: dump nvs | dump eeprom");
   }
-  
-  int16_t i16_val;
-  read_err = nvs_get_i16(handle, keyName.c_str(), &i16_val);
-  if (read_err == ESP_OK) {
-    Serial.printf("📌 %s.%s (int16): %d\n", namespaceName.c_str(), keyName.c_str(), i16_val);
-    nvs_close(handle);
+}
+
+void cmdDelete(SerialShell& shell, uint8_t argc, char* argv[]) {
+  if (argc < 2) {
+    shell.out().println("❌ 삭제할 네임스페이스 이름을 입력해주세요. 예: delete wifi_config");
     return;
   }
-  
-  uint16_t u16_val;
-  read_err = nvs_get_u16(handle, keyName.c_str(), &u16_val);
-  if (read_err == ESP_OK) {
-    Serial.printf("📌 %s.%s (uint16): %u\n", namespaceName.c_str(), keyName.c_str(), u16_val);
-    nvs_close(handle);
+  deleteNamespace(argv[1]);
+  rescanNVS();
+}
+
+void cmdShow(SerialShell& shell, uint8_t argc, char* argv[]) {
+  if (argc < 2) {
+    shell.out().println("❌ 조회할 키를 입력해주세요. 예: show nvs.net80211.sta.ssid");
     return;
   }
-  
-  int32_t i32_val;
-  read_err = nvs_get_i32(handle, keyName.c_str(), &i32_val);
-  if (read_err == ESP_OK) {
-    Serial.printf("📌 %s.%s (int32): %d\n", namespaceName.c_str(), keyName.c_str(), i32_val);
-    nvs_close(handle);
+  showNVSValue(argv[1]);
+}
+
+// 스냅샷은 "import ..." 줄로 출력한다. 출력을 그대로 다른 보드의 시리얼 창에 붙여 넣으면
+// 같은 설정이 복원된다 (import begin -> 16진수 줄들 -> import end).
+const size_t SNAPSHOT_LINE_BYTES = 48;        // 한 줄 96자, 셸 줄 버퍼(128) 안에 들어가도록
+const size_t SNAPSHOT_MAX_SIZE = 32 * 1024;
+
+// 네임스페이스 필터 인자: 없으면 칩마다 다른 데이터(phy, nvs.net80211) 제외, "all"이면 전부,
+// 그 밖에는 "a,b"(이것만) 또는 "-a,-b"(이것 빼고) 형식
+const char* namespaceFilter(const char* arg) {
+  if (arg == NULL) return NvsIndex::PER_CHIP_FILTER;
+  if (strcmp(arg, "all") == 0) return NULL;
+  return arg;
+}
+
+uint8_t* importBuffer = NULL;
+size_t importSize = 0;
+size_t importReceived = 0;
+
+void cmdExport(SerialShell& shell, uint8_t argc, char* argv[]) {
+  Print& out = shell.out();
+  const char* filter = namespaceFilter(argc > 1 ? argv[1] : NULL);
+  rescanNVS();
+
+  const size_t size = nvsIndex.getSnapshotSize(filter);
+  uint8_t* snapshot = (uint8_t*)malloc(size);
+  if (snapshot == NULL) {
+    out.printf("❌ 스냅샷 버퍼(%u bytes)를 할당할 수 없습니다.\n", (unsigned)size);
     return;
   }
-  
-  uint32_t u32_val;
-  read_err = nvs_get_u32(handle, keyName.c_str(), &u32_val);
-  if (read_err == ESP_OK) {
-    Serial.printf("📌 %s.%s (uint32): %u\n", namespaceName.c_str(), keyName.c_str(), u32_val);
-    nvs_close(handle);
-    return;
+  nvsIndex.exportSnapshot(snapshot, size, filter);
+
+  out.printf("import begin %u\n", (unsigned)size);
+  char line[SNAPSHOT_LINE_BYTES * 2 + 1];
+  for (size_t offset = 0; offset < size; offset += SNAPSHOT_LINE_BYTES) {
+    const size_t count = min(SNAPSHOT_LINE_BYTES, size - offset);
+    for (size_t i = 0; i < count; i++) {
+      sprintf(line + i * 2, "%02x", snapshot[offset + i]);
+    }
+    out.printf("import %s\n", line);
   }
-  
-  // If we get here, we couldn't determine the key type
-  Serial.printf("❌ 키 '%s'의 타입을 확인할 수 없거나 존재하지 않습니다.\n", keyName.c_str());
-  nvs_close(handle);
-  return;
+  out.println("import end");
+  free(snapshot);
+}
 
+void abortImport() {
+  free(importBuffer);
+  importBuffer = NULL;
+  importSize = importReceived = 0;
 }
 
-void handleSerialCommands() {
-  if (Serial.available() > 0) {
-    String command = Serial.readStringUntil('\n');
-    command.trim();
-    
-    if (command == "dump nvs") {
-      dumpNVS();
-    } 
-    else if (command == "dump eeprom") {
-      dumpEEPROM();
+int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+void cmdImport(SerialShell& shell, uint8_t argc, char* argv[]) {
+  Print& out = shell.out();
+  if (argc < 2) {
+    out.println("❌ 사용법: import begin <크기> | import <16진수> | import end [필터] | import abort");
+    return;
+  }
+
+  if (strcmp(argv[1], "begin") == 0) {
+    abortImport();
+    const size_t size = argc > 2 ? strtoul(argv[2], NULL, 10) : 0;
+    if (size == 0 || size > SNAPSHOT_MAX_SIZE) {
+      out.printf("❌ 스냅샷 크기가 잘못되었습니다 (최대 %u bytes).\n", (unsigned)SNAPSHOT_MAX_SIZE);
+      return;
     }
-    else if (command.startsWith("delete ")) {
-      String ns_to_delete = command.substring(7);
-      if (ns_to_delete.length() > 0) {
-        deleteNamespace(ns_to_delete.c_str());
-      } else {
-        Serial.println("❌ 삭제할 네임스페이스 이름을 입력해주세요. 예: delete wifi_config");
-      }
+    importBuffer = (uint8_t*)malloc(size);
+    if (importBuffer == NULL) {
+      out.println("❌ 스냅샷 버퍼를 할당할 수 없습니다.");
+      return;
     }
-    else if (command.startsWith("show ")) {
-      String keyPath = command.substring(5);
-      if (keyPath.length() > 0) {
-        showNVSValue(keyPath);
-      } else {
-        Serial.println("❌ 조회할 키를 입력해주세요. 예: show nvs.net80211.sta.ssid");
-      }
+    importSize = size;
+    out.printf("📥 스냅샷 수신 시작 (%u bytes)\n", (unsigned)size);
+  }
+  else if (strcmp(argv[1], "abort") == 0) {
+    abortImport();
+    out.println("✅ 스냅샷 수신을 취소했습니다.");
+  }
+  else if (strcmp(argv[1], "end") == 0) {
+    if (importBuffer == NULL || importReceived != importSize) {
+      out.printf("❌ 스냅샷이 완전하지 않습니다 (%u / %u bytes).\n", (unsigned)importReceived, (unsigned)importSize);
+      abortImport();
+      return;
+    }
+    uint16_t written = 0;
+    const esp_err_t err = NvsIndex::importSnapshot(importBuffer, importSize, NVS_DEFAULT_PART_NAME, &written,
+                                                   namespaceFilter(argc > 2 ? argv[2] : NULL));
+    abortImport();
+    if (err == ESP_OK) {
+      out.printf("✅ %u개 엔트리를 복원했습니다.\n", written);
+    } else {
+      out.printf("❌ 복원 실패: %s (%u개 엔트리 기록됨)\n", esp_err_to_name(err), written);
     }
-    else if (command == "help") {
-      Serial.println("\n사용 가능한 명령어:");
-      Serial.println("  dump nvs          - NVS 내용 조회");
-      Serial.println("  dump eeprom       - EEPROM 내용 조회");
-      Serial.println("  delete <네임스페이스> - 특정 네임스페이스 삭제");
-      Serial.println("  show <키경로>     - 특정 키의 값 조회 (예: show nvs.net80211.sta.ssid)");
-      Serial.println("  help              - 도움말 보기");
+    rescanNVS();
+  }
+  else {
+    // 16진수 조각
+    const char* hex = argv[1];
+    const size_t length = strlen(hex);
+    if (importBuffer == NULL) {
+      out.println("❌ import begin 이 먼저 필요합니다.");
+      return;
     }
-    else if (command != "") {
-      Serial.println("❌ Unknown command. Type 'help' for available commands.");
+    if (length % 2 != 0 || importReceived + length / 2 > importSize) {
+      out.println("❌ 스냅샷 데이터가 잘못되었습니다. 수신을 취소합니다.");
+      abortImport();
+      return;
     }
+    for (size_t i = 0; i < length; i += 2) {
+      const int high = hexValue(hex[i]);
+      const int low = hexValue(hex[i + 1]);
+      if (high < 0 || low < 0) {
+        out.println("❌ 16진수가 아닌 문자가 있습니다. 수신을 취소합니다.");
+        abortImport();
+        return;
+      }
+      importBuffer[importReceived++] = uint8_t(high << 4 | low);
+    }
+  }
+}
+
+void cmdSettings(SerialShell& shell, uint8_t, char*[]) {
+  Settings.print(shell.out());
+}
+
+void cmdSet(SerialShell& shell, uint8_t argc, char* argv[]) {
+  Print& out = shell.out();
+  if (argc < 4) {
+    out.println("❌ 사용법: set <묶음> <필드> <값>   예: set device contrast 200");
+    return;
+  }
+  SettingsRecordBase* record = Settings.find(argv[1]);
+  if (record == NULL) {
+    out.printf("❌ '%s' 설정 묶음이 없습니다.\n", argv[1]);
+  } else if (!record->setByName(argv[2], argv[3])) {
+    out.printf("❌ '%s' 필드가 없거나 값이 범위를 벗어났습니다.\n", argv[2]);
+  } else {
+    out.println("✅ 변경됨 (잠시 후 자동 저장, 바로 저장하려면 save)");
   }
 }
 
+void cmdSave(SerialShell& shell, uint8_t, char*[]) {
+  const esp_err_t err = Settings.commit();
+  if (err == ESP_OK) {
+    shell.out().println("✅ 설정을 저장했습니다.");
+  } else {
+    shell.out().printf("❌ 설정 저장 실패: %s\n", esp_err_to_name(err));
+  }
+}
+
+void cmdTest(SerialShell&, uint8_t, char*[]) {
+  testNVS();
+}
+
 void setup() {
   Serial.begin(115200);
   delay(1000);  // Give serial time to initialize
   
   // Initialize NVS first
   initNVS();
+  rescanNVS();
+
+  // 설정 읽기, 이후 변경은 2초 동안 조용해지면(최대 10초) 모아서 저장
+  if (!Settings.begin() || !Settings.beginAutoCommit()) {
+    Serial.println("❌ 설정 저장소를 시작할 수 없습니다.");
+  }
   
   // Initialize EEPROM with the defined size
   EEPROM.begin(EEPROM_SIZE);
   
+  shell.add("dump", "nvs|eeprom", "NVS/EEPROM 내용 조회", cmdDump);
+  shell.add("delete", "<네임스페이스>", "특정 네임스페이스 삭제", cmdDelete);
+  shell.add("show", "<키경로>", "특정 키의 값 조회 (예: show nvs.net80211.sta.ssid)", cmdShow);
+  shell.add("export", "[all|ns,...|-ns,...]", "NVS를 스냅샷으로 출력 (기본: phy, nvs.net80211 제외)", cmdExport);
+  shell.add("import", "begin <크기>|<16진수>|end [필터]", "스냅샷 받아서 NVS에 복원 (기본: phy, nvs.net80211 제외)", cmdImport);
+  shell.add("settings", "", "설정 값과 저장 통계 조회", cmdSettings);
+  shell.add("set", "<묶음> <필드> <값>", "설정 변경 (예: set device contrast 200)", cmdSet);
+  shell.add("save", "", "대기 중인 설정 변경을 바로 저장", cmdSave);
+  shell.add("test", "", "NVS 쓰기/읽기 확인 (settings/device.testValue)", cmdTest);
+
   Serial.println("\n🔧 System started. Type 'help' for available commands.");
   
   WiFi.persistent(false);             // 자동 저장 막기
@@ -569,8 +473,8 @@ void setup() {
 }
 
 void loop() {
-  handleSerialCommands();
-  delay(100);
+  shell.poll();
+  delay(10);
 }
 
 
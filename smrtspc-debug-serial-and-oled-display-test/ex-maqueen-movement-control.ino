@@ -2,6 +2,7 @@
 #include <Wire.h>
 #include "DebugSerial.h"
 #include "maqueenWheelManager.h"
+#include "motionController.h"
 
 // Wheel speed (0-255)
 #define WHEEL_SPEED 150
@@ -12,28 +13,16 @@
 #define LED_OFF HIGH
 
 // Movement timing
-unsigned long lastStateChange = 0;
-const unsigned long MOVE_DURATION = 2000;  // 2 seconds per movement
-
-// Movement states
-enum class MovementState {
-  STOP,
-  FORWARD,
-  BACKWARD,
-  TURN_LEFT,
-  TURN_RIGHT,
-  ROTATE_LEFT,
-  ROTATE_RIGHT
-};
-
-MovementState currentState = MovementState::STOP;
+const uint16_t MOVE_DURATION = 2000;  // 2 seconds per movement (ramps included)
+const int16_t ARC_RADIUS_MM = 150;    // 원호 회전 반경
+unsigned long lastStatsPrint = 0;
 
 void setup() {
   // Initialize serial
   DebugSerial::begin(115200, -1);
   
   if (!DebugSerial::waitForConnection(10000)) {
-    DebugSerial::printlnDebug("[DEBUG] No serial connection, entering blink mode");
+    DEBUG_PRINTLN("[DEBUG] No serial connection, entering blink mode");
     while (true) {
       for (int i = 0; i < 3; i++) {
         digitalWrite(LED_PIN, LED_ON);
@@ -55,72 +44,51 @@ void setup() {
   // I2C address: 0x10, SDA: 5, SCL: 6 for ESP32-C3
   Maqueen.begin(0x10, 5, 6);
   
-  DebugSerial::printlnDebug("Maqueen Wheel Manager initialized");
-  
-  // Initial delay to ensure everything is ready
-  delay(1000);
+  DEBUG_PRINTLN("Maqueen Wheel Manager initialized");
   
-  // Start with stop state
-  currentState = MovementState::STOP;
-  lastStateChange = millis();
+  // Motion controller: 50 Hz control task with acceleration-limited ramps
+  Motion.begin();
+  DEBUG_PRINTLN("Motion controller started");
+}
+
+// 한 바퀴 동작을 큐에 넣는다 (모두 즉시 반환, 실제 주행은 제어 태스크가 담당)
+void queueMovementCycle() {
+  DEBUG_PRINTLN("Queueing movement cycle: FORWARD, BACKWARD, ARC LEFT/RIGHT, SPIN LEFT/RIGHT, STOP");
+  Motion.line(WHEEL_SPEED, MOVE_DURATION);
+  Motion.line(-WHEEL_SPEED, MOVE_DURATION);
+  Motion.arc(WHEEL_SPEED, ARC_RADIUS_MM, MOVE_DURATION);
+  Motion.arc(WHEEL_SPEED, -ARC_RADIUS_MM, MOVE_DURATION);
+  Motion.spin(WHEEL_SPEED, MOVE_DURATION);
+  Motion.spin(-WHEEL_SPEED, MOVE_DURATION);
+  Motion.pause(1000);  // Pause at stop state
 }
 
 void loop() {
   unsigned long currentTime = millis();
   
-  // Change movement state every MOVE_DURATION milliseconds
-  if (currentTime - lastStateChange >= MOVE_DURATION) {
-    lastStateChange = currentTime;
+  // 큐가 비고 로봇이 멈추면 다음 사이클
+  if (Motion.isIdle()) {
+    queueMovementCycle();
+  }
+  
+  // LED: 주행 중이면 켬
+  MotionPlanner::WheelSpeeds speeds = Motion.getSpeeds();
+  digitalWrite(LED_PIN, (speeds.left != 0 || speeds.right != 0) ? LED_ON : LED_OFF);
+  
+  if (currentTime - lastStatsPrint >= MOVE_DURATION) {
+    lastStatsPrint = currentTime;
     
-    // Move to next state
-    switch (currentState) {
-      case MovementState::STOP:
-        DebugSerial::printlnDebug("Moving FORWARD");
-        Maqueen.forward(WHEEL_SPEED);
-        currentState = MovementState::FORWARD;
-        digitalWrite(LED_PIN, LED_ON);
-        break;
-        
-      case MovementState::FORWARD:
-        DebugSerial::printlnDebug("Moving BACKWARD");
-        Maqueen.backward(WHEEL_SPEED);
-        currentState = MovementState::BACKWARD;
-        break;
-        
-      case MovementState::BACKWARD:
-        DebugSerial::printlnDebug("Turning LEFT");
-        Maqueen.turnLeft(WHEEL_SPEED);
-        currentState = MovementState::TURN_LEFT;
-        break;
-        
-      case MovementState::TURN_LEFT:
-        DebugSerial::printlnDebug("Turning RIGHT");
-        Maqueen.turnRight(WHEEL_SPEED);
-        currentState = MovementState::TURN_RIGHT;
-        break;
-        
-      case MovementState::TURN_RIGHT:
-        DebugSerial::printlnDebug("Rotating LEFT");
-        Maqueen.rotateLeft(WHEEL_SPEED);
-        currentState = MovementState::ROTATE_LEFT;
-        break;
-        
-      case MovementState::ROTATE_LEFT:
-        DebugSerial::printlnDebug("Rotating RIGHT");
-        Maqueen.rotateRight(WHEEL_SPEED);
-        currentState = MovementState::ROTATE_RIGHT;
-        digitalWrite(LED_PIN, LED_OFF);
-        break;
-        
-      case MovementState::ROTATE_RIGHT:
-        DebugSerial::printlnDebug("STOPPING");
-        Maqueen.stop();
-        currentState = MovementState::STOP;
-        delay(1000);  // Pause at stop state
-        break;
-    }
+    // 모터 명령 전송 통계 (지연, 버스 점유, 오류)
+    const MaqueenBusStats& stats = Maqueen.getBusStats();
+    DEBUG_PRINTF("[MOTION] wheels %d/%d, queued %u, command failures %lu\n",
+                 speeds.left, speeds.right, Motion.getQueuedCount(),
+                 (unsigned long)Motion.getCommandFailures());
+    DEBUG_PRINTF("[I2C] latency %lu us (max %lu), bus %lu us, sent %lu, skipped %lu, errors %lu, failed %lu\n",
+                 (unsigned long)stats.lastLatencyMicros, (unsigned long)stats.maxLatencyMicros,
+                 (unsigned long)stats.busMicros, (unsigned long)stats.commandsSent,
+                 (unsigned long)stats.commandsSkipped, (unsigned long)stats.busErrors,
+                 (unsigned long)stats.failedCommands);
   }
   
-  // Small delay to prevent watchdog issues
   delay(10);
-}
\ No newline at end of file
+}
@@ -0,0 +1,41 @@
+// 화면/모터 드라이버 마이크로 벤치마크 예제
+// esp32-c3 (160MHz), 72x40 I2C OLED, Maqueen 모터 보드(선택)
+// 각 연산을 N번 반복해서 사이클 카운터와 esp_timer로 재고, 결과를 CSV로 시리얼에 출력한다.
+// 시리얼 출력에서 "name,"으로 시작하는 줄부터 빈 줄 전까지를 그대로 CSV 파일로 저장하면 된다.
+// 라이브러리 버전이나 최적화 전후를 비교할 때는 ticks_min 열을 보면 가장 흔들림이 적다.
+//
+// 같은 목록을 PC에서 돌리려면 sim/ 의 sim_micro_bench (호스트 시간 ns 기준).
+// 시리얼로 아무 글자나 보내면 다시 측정한다.
+
+#include <Arduino.h>
+#include "miniDisplayManager.h"
+#include "maqueenWheelManager.h"
+#include "driverBenchSuite.h"
+
+// 연산당 반복 횟수
+const uint32_t BENCH_ITERATIONS = 200;
+
+void runBenchmarks() {
+  Serial.printf("\n# micro benchmark: %s rev %u, %lu MHz, %lu iterations\n", ESP.getChipModel(),
+                ESP.getChipRevision(), (unsigned long)ESP.getCpuFreqMHz(), (unsigned long)BENCH_ITERATIONS);
+  runDriverBenchSuite(Serial, BENCH_ITERATIONS);
+  Serial.println();
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(1000);
+
+  Display.begin();
+  Maqueen.begin();  // 모터 보드가 없으면 모터 항목은 NACK 재시도 시간까지 포함해서 측정됨
+
+  runBenchmarks();
+}
+
+void loop() {
+  if (Serial.available()) {
+    while (Serial.available()) Serial.read();
+    runBenchmarks();
+  }
+  delay(50);
+}
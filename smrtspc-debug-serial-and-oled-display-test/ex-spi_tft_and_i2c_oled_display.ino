@@ -17,16 +17,21 @@ const int POT_PIN = 0; // GPIO0 (ADC1_CH0)에 연결
 #define TFT_RST   1    // RST (Reset)
 #define TFT_DC    2    // DC (Data/Command)
 #define TFT_CS    7    // CS (Chip Select)
-#define TFT_MOSI  8    // SDA (Software SPI MOSI)
-#define TFT_SCLK  9    // SCL (Software SPI Clock)
+#define TFT_MOSI  8    // SDA (SPI MOSI)
+#define TFT_SCLK  9    // SCL (SPI Clock)
 #define TFT_BLK   10   // BLK (Backlight)
 
+// SPI 클럭 속도 설정 (40MHz)
+#define SPI_FREQ_HZ 40000000
+
 // 디스플레이 해상도
 #define TFT_WIDTH  76
 #define TFT_HEIGHT 284
 
-// ST7789 객체 생성 (소프트웨어 SPI 모드)
-Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_MOSI, TFT_SCLK, TFT_RST);
+// ST7789 객체 생성 (하드웨어 SPI 모드)
+// MOSI/SCLK 핀을 생성자에 넘기면 소프트웨어(비트뱅잉) SPI가 되므로, SPI 객체를 넘기고
+// 핀은 initSPI_TFTDisplay()의 SPI.begin()에서 지정한다
+Adafruit_ST7789 tft = Adafruit_ST7789(&SPI, TFT_CS, TFT_DC, TFT_RST);
 
 // U8g2 하드웨어 I2C 생성자 (reset 핀 없음)
 U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE);
@@ -82,8 +87,12 @@ void initSPI_TFTDisplay() {
   pinMode(TFT_BLK, OUTPUT);
   digitalWrite(TFT_BLK, LOW); // 백라이트 켜기, 내가 가진 oled supermini 보드에서는 LOW로 설정해야 백라이트 켜짐
   
-  // 소프트웨어 SPI로 TFT 디스플레이 초기화
+  // 하드웨어 SPI 핀 지정 (MISO는 사용하지 않음). tft.init()보다 먼저 해야 이 핀이 유지된다
+  SPI.begin(TFT_SCLK, -1, TFT_MOSI, TFT_CS);
+  
+  // TFT 디스플레이 초기화
   tft.init(TFT_WIDTH, TFT_HEIGHT);
+  tft.setSPISpeed(SPI_FREQ_HZ);  // init()이 기본 클럭으로 되돌리므로 그 다음에 설정
   tft.setRotation(1); // 가로 방향
   
   // 화면 초기화
@@ -6,6 +6,7 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/queue.h>
+#include "taskRuntime.h"
 
 // 가변 저항이 연결된 아날로그 핀 번호
 const int POT_PIN = 0; // GPIO0 (ADC1_CH0)에 연결
@@ -14,13 +15,17 @@ const int POT_PIN = 0; // GPIO0 (ADC1_CH0)에 연결
 #define TFT_RST   1    // RST (Reset)
 #define TFT_DC    2    // DC (Data/Command)
 #define TFT_CS    7    // CS (Chip Select)
-#define TFT_MOSI  8    // SDA (Software SPI MOSI)
-#define TFT_SCLK  9    // SCL (Software SPI Clock)
+#define TFT_MOSI  8    // SDA (SPI MOSI)
+#define TFT_SCLK  9    // SCL (SPI Clock)
 #define TFT_BLK   10   // BLK (Backlight)
 
 // SPI 클럭 속도 설정 (40MHz)
 #define SPI_FREQ_HZ 40000000
 
+// 가변 저항 읽기 주기, 태스크 상태 보고 주기
+const uint32_t POT_SAMPLE_MS = 100;
+const uint32_t TASK_REPORT_MS = 10000;
+
 // 태스크 핸들
 TaskHandle_t oledTaskHandle = NULL;
 TaskHandle_t tftTaskHandle = NULL;
@@ -31,15 +36,19 @@ typedef struct {
   int percentage;
 } DisplayData_t;
 
-// 디스플레이 업데이트 큐
-QueueHandle_t displayQueue;
+// 디스플레이 상태 우편함: 최신 값만 유지, 각 디스플레이는 밀린 중간 값 없이 가장 최근 값만 그린다
+Mailbox<DisplayData_t> displayState;
+Mailbox<DisplayData_t>::Reader oledReader;
+Mailbox<DisplayData_t>::Reader tftReader;
 
 // 디스플레이 해상도
 #define TFT_WIDTH  76
 #define TFT_HEIGHT 284
 
-// ST7789 객체 생성 (소프트웨어 SPI 모드)
-Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_MOSI, TFT_SCLK, TFT_RST);
+// ST7789 객체 생성 (하드웨어 SPI 모드)
+// MOSI/SCLK 핀을 생성자에 넘기면 소프트웨어(비트뱅잉) SPI가 되므로, SPI 객체를 넘기고
+// 핀은 initSPI_TFTDisplay()의 SPI.begin()에서 지정한다
+Adafruit_ST7789 tft = Adafruit_ST7789(&SPI, TFT_CS, TFT_DC, TFT_RST);
 
 // U8g2 하드웨어 I2C 생성자 (reset 핀 없음)
 U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE);
@@ -83,16 +92,15 @@ void initSPI_TFTDisplay() {
   pinMode(TFT_BLK, OUTPUT);
   digitalWrite(TFT_BLK, LOW); // 백라이트 켜기
   
-  // SPI 초기화 및 고속 설정
-  SPI.begin(TFT_SCLK, -1, TFT_MOSI, TFT_CS);  // MISO는 사용하지 않음
-  SPI.setFrequency(SPI_FREQ_HZ);
+  // 하드웨어 SPI 핀 지정 (MISO는 사용하지 않음). tft.init()보다 먼저 해야 이 핀이 유지된다
+  SPI.begin(TFT_SCLK, -1, TFT_MOSI, TFT_CS);
   
   // TFT 디스플레이 초기화
   tft.init(TFT_WIDTH, TFT_HEIGHT);
+  tft.setSPISpeed(SPI_FREQ_HZ);  // init()이 기본 클럭으로 되돌리므로 그 다음에 설정
   tft.setRotation(1); // 가로 방향
   
-  // SPI 트랜잭션 설정 (고속 모드)
-  SPI.beginTransaction(SPISettings(SPI_FREQ_HZ, MSBFIRST, SPI_MODE0));
+  // SPI 트랜잭션은 드라이버가 그릴 때마다 시작/종료한다 (여기서 열어 두면 다른 태스크의 그리기가 막힘)
   
   // 화면 초기화
   tft.invertDisplay(false);
@@ -172,8 +180,9 @@ void oledTask(void *parameter) {
   DisplayData_t displayData;
   
   while(1) {
-    // 큐에서 데이터를 받아옴
-    if (xQueueReceive(displayQueue, &displayData, portMAX_DELAY) == pdPASS) {
+    // 새 값이 올 때까지 블록, 최신 값만 받아옴
+    if (oledReader.wait(displayData)) {
+      WorkTimer work;
       // OLED 디스플레이 업데이트
       char valueStr[32];
       snprintf(valueStr, sizeof(valueStr), "Value: %d", displayData.potValue);
@@ -192,7 +201,6 @@ void oledTask(void *parameter) {
       u8g2.drawStr(xOffset, yOffset + 40, valueStr);
       u8g2.sendBuffer();
     }
-    vTaskDelay(10 / portTICK_PERIOD_MS); // 짧은 딜레이
   }
 }
 
@@ -203,8 +211,9 @@ void tftTask(void *parameter) {
   static int lastPercentage = -1;
   
   while(1) {
-    // 큐에서 데이터를 받아옴
-    if (xQueueReceive(displayQueue, &displayData, portMAX_DELAY) == pdPASS) {
+    // 새 값이 올 때까지 블록, 최신 값만 받아옴
+    if (tftReader.wait(displayData)) {
+      WorkTimer work;
       // 값이 변경된 경우에만 TFT 업데이트
       if (displayData.potValue != lastPotValue || displayData.percentage != lastPercentage) {
         lastPotValue = displayData.potValue;
@@ -212,7 +221,6 @@ void tftTask(void *parameter) {
         updateSPIDisplay(displayData.potValue, displayData.percentage);
       }
     }
-    vTaskDelay(1 / portTICK_PERIOD_MS); // 매우 짧은 딜레이
   }
 }
 
@@ -225,46 +233,31 @@ void setup() {
   initSPI_TFTDisplay();
   initI2C_OLEDDisplay();
   
-  // 디스플레이 업데이트 큐 생성 (10개 항목 저장 가능)
-  displayQueue = xQueueCreate(10, sizeof(DisplayData_t));
-  
-  if (displayQueue == NULL) {
-    Serial.println("Error creating the queue");
-    while(1); // 큐 생성 실패 시 정지
+  // 디스플레이 상태 우편함 생성, 디스플레이별 reader 등록
+  if (!displayState.begin()) {
+    Serial.println("Error creating the display mailbox");
+    while(1); // 생성 실패 시 정지
   }
+  oledReader = displayState.reader();
+  tftReader = displayState.reader();
   
-  // 태스크 생성
-  xTaskCreatePinnedToCore(
-    oledTask,      // 태스크 함수
-    "OLED_Task",   // 태스크 이름
-    4096,          // 스택 크기
-    NULL,          // 파라미터
-    1,             // 우선순위
-    &oledTaskHandle, // 태스크 핸들
-    0              // 코어 0에서 실행
-  );
-  
-  xTaskCreatePinnedToCore(
-    tftTask,       // 태스크 함수
-    "TFT_Task",    // 태스크 이름
-    4096,          // 스택 크기
-    NULL,          // 파라미터
-    1,             // 우선순위
-    &tftTaskHandle, // 태스크 핸들
-    0              // 코어 0에서 실행
-  );
+  // 태스크 생성 (스택 크기는 Tasks.printReport()의 MinFree를 보고 조정)
+  oledTaskHandle = Tasks.spawn("OLED_Task", oledTask, NULL, 4096, TaskPriority::Screen);
+  tftTaskHandle = Tasks.spawn("TFT_Task", tftTask, NULL, 4096, TaskPriority::Screen);
+  Tasks.adopt("loop", NULL, 8192);  // Arduino loop 태스크 (가변 저항 읽기)
   
   // 메인 루프는 가변 저항 값을 읽어서 큐에 전달
   Serial.println("FreeRTOS tasks started");
 }
 
 void loop() {
-  static unsigned long lastReadTime = 0;
   static int lastPotValue = -1;
+  static unsigned long lastReportTime = 0;
   
-  // 100ms마다 가변 저항 값을 읽음
-  if (millis() - lastReadTime > 100) {
-    lastReadTime = millis();
+  // 100ms마다 가변 저항 값을 읽음 (기다리는 동안은 블록되어 CPU를 쓰지 않음)
+  vTaskDelay(pdMS_TO_TICKS(POT_SAMPLE_MS));
+  {
+    WorkTimer work;
     
     // 가변 저항 값을 읽음 (0~4095)
     int potValue = analogRead(POT_PIN);
@@ -282,13 +275,16 @@ void loop() {
         .percentage = percentage
       };
       
-      // 큐에 데이터 전송 (non-blocking)
-      if (xQueueSend(displayQueue, &displayData, 10 / portTICK_PERIOD_MS) != pdPASS) {
-        Serial.println("Queue full, dropped display update");
-      }
+      // 최신 값으로 덮어씀 (기다리지 않음, 디스플레이가 느리면 중간 값은 건너뜀)
+      displayState.publish(displayData);
     }
   }
   
-  // 다른 태스크에 CPU 양보
-  vTaskDelay(1);
+  // 태스크별 스택 여유와 CPU 사용률
+  if (millis() - lastReportTime >= TASK_REPORT_MS) {
+    lastReportTime = millis();
+    Tasks.printReport(Serial);
+    Serial.printf("Display updates skipped - OLED: %lu, TFT: %lu\n",
+                  (unsigned long)oledReader.getSkipped(), (unsigned long)tftReader.getSkipped());
+  }
 }
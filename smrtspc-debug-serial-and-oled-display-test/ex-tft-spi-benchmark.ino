@@ -0,0 +1,225 @@
+// ST7789 TFT (284x76) 전송 속도 측정 예제
+// esp32-c3, ST7789 SPI TFT
+// 소프트웨어(비트뱅잉) SPI, 하드웨어 SPI(Adafruit_ST7789), esp_lcd DMA 전송(TftDmaPanel)으로
+// 같은 그리기를 반복하고 걸린 시간을 시리얼로 출력한다.
+//  - fillScreen: 화면 전체 채우기
+//  - blit: 화면 전체 무늬. Adafruit는 창(address window)을 한 번 열고 한 줄씩 계산해 writePixels()로 전송,
+//          DMA는 16줄 띠마다 계산해 큐에 넣는다 (앞 띠가 DMA로 나가는 동안 다음 띠를 계산)
+//  - text: 배경색을 지정한 글자 출력 (글자 칸 전체를 덮어씀)
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_ST7789.h>
+#include "tftDmaPanel.h"
+
+// ST7789 SPI 디스플레이 핀 설정
+#define TFT_RST   1    // RST (Reset)
+#define TFT_DC    2    // DC (Data/Command)
+#define TFT_CS    7    // CS (Chip Select)
+#define TFT_MOSI  8    // SDA (SPI MOSI)
+#define TFT_SCLK  9    // SCL (SPI Clock)
+#define TFT_BLK   10   // BLK (Backlight)
+
+// SPI 클럭 속도 설정 (40MHz)
+#define SPI_FREQ_HZ 40000000
+
+// TFT 디스플레이 해상도 (90도 회전 고려)
+#define TFT_WIDTH  284
+#define TFT_HEIGHT 76
+
+// 1이면 소프트웨어 SPI도 측정 (느리므로 반복 횟수를 줄여서)
+#define BENCH_SOFTWARE_SPI 1
+
+const int HARDWARE_RUNS = 20;
+const int SOFTWARE_RUNS = 2;
+const int TEXT_CHARS = 400;
+
+uint16_t lineBuffer[TFT_WIDTH];
+
+struct BenchResult {
+  uint32_t fillMicros;
+  uint32_t blitMicros;
+  uint32_t textMicros;
+};
+
+void initPanel(Adafruit_ST7789& panel) {
+  panel.init(TFT_HEIGHT, TFT_WIDTH);  // swap width/height for rotation
+  panel.setRotation(1);
+  panel.invertDisplay(false);
+  panel.setTextSize(1);
+}
+
+// blit 무늬 (두 전송 방식이 같은 계산을 하도록)
+uint16_t patternColor(int x, int y, uint16_t seed) {
+  const uint8_t r = x + seed;
+  const uint8_t g = y * 3;
+  const uint8_t b = (x ^ y) + seed;
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+// 화면 전체를 창 하나로 열고 한 줄씩 전송
+void blitFrame(Adafruit_ST7789& panel, uint16_t seed) {
+  panel.startWrite();
+  panel.setAddrWindow(0, 0, TFT_WIDTH, TFT_HEIGHT);
+  for (int y = 0; y < TFT_HEIGHT; y++) {
+    for (int x = 0; x < TFT_WIDTH; x++) {
+      lineBuffer[x] = patternColor(x, y, seed);
+    }
+    panel.writePixels(lineBuffer, TFT_WIDTH);
+  }
+  panel.endWrite();
+}
+
+// DMA 띠 하나 (TftDmaPanel::drawFrame), 픽셀은 패널 바이트 순서
+void renderBand(uint16_t* pixels, int16_t y, int16_t lines, void* context) {
+  const uint16_t seed = *static_cast<const uint16_t*>(context);
+  for (int16_t row = 0; row < lines; row++) {
+    for (int x = 0; x < TFT_WIDTH; x++) {
+      *pixels++ = TftDmaPanel::toPanel(patternColor(x, y + row, seed));
+    }
+  }
+}
+
+BenchResult runBenchmark(Adafruit_ST7789& panel, int runs) {
+  static const uint16_t colors[] = {ST77XX_RED, ST77XX_GREEN, ST77XX_BLUE, ST77XX_BLACK};
+  BenchResult result;
+
+  uint32_t start = micros();
+  for (int i = 0; i < runs; i++) {
+    panel.fillScreen(colors[i % 4]);
+  }
+  result.fillMicros = (micros() - start) / runs;
+
+  start = micros();
+  for (int i = 0; i < runs; i++) {
+    blitFrame(panel, i * 16);
+  }
+  result.blitMicros = (micros() - start) / runs;
+
+  panel.fillScreen(ST77XX_BLACK);
+  panel.setTextColor(ST77XX_WHITE, ST77XX_BLACK);
+  start = micros();
+  for (int i = 0; i < runs; i++) {
+    panel.setCursor(0, 0);
+    for (int c = 0; c < TEXT_CHARS; c++) {
+      panel.write('0' + (c + i) % 10);
+    }
+  }
+  result.textMicros = (micros() - start) / runs;
+
+  return result;
+}
+
+// TftDmaPanel로 같은 측정. 글자는 Adafruit 출력과 같은 배치 (한 줄 47글자, 8픽셀 간격)
+BenchResult runDmaBenchmark(TftDmaPanel& panel, int runs) {
+  static const uint16_t colors[] = {ST77XX_RED, ST77XX_GREEN, ST77XX_BLUE, ST77XX_BLACK};
+  const int charsPerRow = TFT_WIDTH / 6;
+  BenchResult result;
+
+  // 마지막 전송이 끝날 때까지 포함해서 잰다
+  uint32_t start = micros();
+  for (int i = 0; i < runs; i++) {
+    panel.fillScreen(colors[i % 4]);
+  }
+  panel.waitIdle();
+  result.fillMicros = (micros() - start) / runs;
+
+  start = micros();
+  for (int i = 0; i < runs; i++) {
+    uint16_t seed = i * 16;
+    panel.drawFrame(renderBand, &seed);
+  }
+  panel.waitIdle();
+  result.blitMicros = (micros() - start) / runs;
+
+  panel.fillScreen(ST77XX_BLACK);
+  panel.waitIdle();
+  char row[TFT_WIDTH / 6 + 1];
+  start = micros();
+  for (int i = 0; i < runs; i++) {
+    for (int c = 0; c < TEXT_CHARS; c += charsPerRow) {
+      const int count = TEXT_CHARS - c < charsPerRow ? TEXT_CHARS - c : charsPerRow;
+      for (int k = 0; k < count; k++) row[k] = '0' + (c + k + i) % 10;
+      row[count] = '\0';
+      panel.drawText(0, (c / charsPerRow) * 8, row, ST77XX_WHITE, ST77XX_BLACK);
+    }
+  }
+  panel.waitIdle();
+  result.textMicros = (micros() - start) / runs;
+
+  return result;
+}
+
+// blit 무늬 계산만 (전송 없음). DMA blit이 이 값과 전송 시간 중 큰 쪽에 가까우면 겹쳐서 돈 것
+uint32_t renderOnlyMicros(int runs) {
+  static uint16_t band[TFT_WIDTH * TftDmaPanel::BAND_LINES];
+  const uint32_t start = micros();
+  for (int i = 0; i < runs; i++) {
+    uint16_t seed = i * 16;
+    for (int16_t y = 0; y < TFT_HEIGHT; y += TftDmaPanel::BAND_LINES) {
+      const int16_t lines = TFT_HEIGHT - y < TftDmaPanel::BAND_LINES ? TFT_HEIGHT - y : TftDmaPanel::BAND_LINES;
+      renderBand(band, y, lines, &seed);
+    }
+  }
+  return (micros() - start) / runs;
+}
+
+void printResult(const char* name, const BenchResult& result) {
+  const uint32_t pixels = uint32_t(TFT_WIDTH) * TFT_HEIGHT;
+  Serial.printf("[%s]\n", name);
+  Serial.printf("  fillScreen: %lu us (%lu kpixel/s)\n", (unsigned long)result.fillMicros,
+                (unsigned long)(result.fillMicros ? uint64_t(pixels) * 1000 / result.fillMicros : 0));
+  Serial.printf("  blit      : %lu us (%lu kpixel/s)\n", (unsigned long)result.blitMicros,
+                (unsigned long)(result.blitMicros ? uint64_t(pixels) * 1000 / result.blitMicros : 0));
+  Serial.printf("  text      : %lu us for %d chars (%lu chars/s)\n", (unsigned long)result.textMicros, TEXT_CHARS,
+                (unsigned long)(result.textMicros ? uint64_t(TEXT_CHARS) * 1000000 / result.textMicros : 0));
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(1000);
+  Serial.println("ST7789 SPI benchmark");
+
+  // 백라이트 켜기 (LOW일 때 켜지는 타입)
+  pinMode(TFT_BLK, OUTPUT);
+  digitalWrite(TFT_BLK, LOW);
+
+#if BENCH_SOFTWARE_SPI
+  // 소프트웨어 SPI: 생성자에 MOSI/SCLK 핀을 넘김
+  {
+    Adafruit_ST7789 softwarePanel(TFT_CS, TFT_DC, TFT_MOSI, TFT_SCLK, TFT_RST);
+    initPanel(softwarePanel);
+    printResult("software SPI", runBenchmark(softwarePanel, SOFTWARE_RUNS));
+  }
+#endif
+
+  // 하드웨어 SPI: 핀은 SPI.begin()으로 지정 (init()보다 먼저), 클럭은 init() 다음에
+  SPI.begin(TFT_SCLK, -1, TFT_MOSI, TFT_CS);
+  Adafruit_ST7789 hardwarePanel(&SPI, TFT_CS, TFT_DC, TFT_RST);
+  initPanel(hardwarePanel);
+  hardwarePanel.setSPISpeed(SPI_FREQ_HZ);
+  printResult("hardware SPI 40MHz", runBenchmark(hardwarePanel, HARDWARE_RUNS));
+
+  // esp_lcd DMA: 같은 SPI 버스를 쓰므로 Arduino SPI를 놓은 뒤 시작
+  SPI.end();
+  TftDmaPanel dmaPanel;
+  const TftDmaPanel::Pins pins = {TFT_SCLK, TFT_MOSI, TFT_CS, TFT_DC, TFT_RST};
+  const esp_err_t err = dmaPanel.begin(pins, TFT_WIDTH, TFT_HEIGHT, SPI_FREQ_HZ);
+  if (err == ESP_OK) {
+    printResult("esp_lcd DMA 40MHz", runDmaBenchmark(dmaPanel, HARDWARE_RUNS));
+    Serial.printf("  render    : %lu us per frame (blit pattern only, no transfer)\n",
+                  (unsigned long)renderOnlyMicros(HARDWARE_RUNS));
+  } else {
+    Serial.printf("esp_lcd DMA init failed: %s\n", esp_err_to_name(err));
+  }
+
+  // 이론값: 284 x 76 x 16bit / 40MHz
+  Serial.printf("  wire time : %lu us per frame at %lu MHz\n",
+                (unsigned long)(uint64_t(TFT_WIDTH) * TFT_HEIGHT * 16 * 1000000 / SPI_FREQ_HZ),
+                (unsigned long)(SPI_FREQ_HZ / 1000000));
+}
+
+void loop() {
+  delay(1000);
+}
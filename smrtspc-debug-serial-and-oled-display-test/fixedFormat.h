@@ -0,0 +1,59 @@
+#ifndef FIXED_FORMAT_H
+#define FIXED_FORMAT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// String이나 printf 없이 호출자의 버퍼에 숫자를 쓰는 고정 폭 포맷터 (힙 할당 없음).
+
+// 천 단위 구분자(,)를 넣고 width 칸에 오른쪽 정렬. 숫자가 더 길면 정렬 없이 전부 쓴다.
+// out은 width + 1 이상, 그리고 15바이트 이상이어야 한다. 쓴 글자 수를 반환
+//   formatGrouped(out, 11, 95000000) -> " 95,000,000"
+inline uint8_t formatGrouped(char* out, uint8_t width, int32_t value) {
+    char digits[14];  // 역순: "-2,147,483,648"
+    uint8_t length = 0;
+    uint32_t magnitude = value < 0 ? uint32_t(-(int64_t)value) : uint32_t(value);
+
+    do {
+        if (length == 3 || length == 7 || length == 11) digits[length++] = ',';
+        digits[length++] = char('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    if (value < 0) digits[length++] = '-';
+
+    uint8_t written = 0;
+    while (written + length < width) out[written++] = ' ';
+    while (length > 0) out[written++] = digits[--length];
+    out[written] = '\0';
+    return written;
+}
+
+// 소수 둘째 자리 고정 (hundredths = 값 x 100). showPlus면 0 이상에 '+'를 붙인다.
+// out은 14바이트 이상. 쓴 글자 수를 반환
+//   formatHundredths(out, 123, true) -> "+1.23",  formatHundredths(out, -5, false) -> "-0.05"
+inline uint8_t formatHundredths(char* out, int32_t hundredths, bool showPlus) {
+    uint8_t written = 0;
+    uint32_t magnitude = hundredths < 0 ? uint32_t(-(int64_t)hundredths) : uint32_t(hundredths);
+    if (hundredths < 0) {
+        out[written++] = '-';
+    } else if (showPlus) {
+        out[written++] = '+';
+    }
+
+    char digits[10];
+    uint8_t length = 0;
+    uint32_t whole = magnitude / 100;
+    do {
+        digits[length++] = char('0' + whole % 10);
+        whole /= 10;
+    } while (whole > 0);
+    while (length > 0) out[written++] = digits[--length];
+
+    out[written++] = '.';
+    out[written++] = char('0' + magnitude / 10 % 10);
+    out[written++] = char('0' + magnitude % 10);
+    out[written] = '\0';
+    return written;
+}
+
+#endif
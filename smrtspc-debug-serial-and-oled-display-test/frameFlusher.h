@@ -0,0 +1,153 @@
+#ifndef FRAME_FLUSHER_H
+#define FRAME_FLUSHER_H
+
+#include <U8g2lib.h>
+#include <string.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "metricsRegistry.h"
+
+// 마지막으로 전송한 프레임을 기억해두고 바뀐 타일(8x8 픽셀)만 I2C로 전송한다.
+// 타일 행(8픽셀 page)마다 변경된 열 범위를 찾아 u8x8_DrawTile 한 번으로 보낸다.
+// 숫자 몇 개만 바뀌는 화면이라면 전체 sendBuffer() 대비 전송량이 크게 줄어든다.
+//
+// beginAsync()를 호출하면 submit()은 프레임을 대기 버퍼에 복사만 하고 바로 반환하며,
+// 전용 FreeRTOS 태스크가 I2C 전송을 맡는다. 전송 중에 새 프레임이 여러 번 들어오면
+// 가장 최근 프레임만 남기고 합쳐서(coalesce) 보낸다.
+template <uint8_t TileWidth, uint8_t TileHeight>
+class FrameFlusher {
+public:
+    static constexpr size_t frameSize = size_t(TileWidth) * TileHeight * 8;
+
+    // 다음 flush()에서 전체 화면을 다시 보내도록 표시 (초기화 직후 등)
+    void invalidate() { shadowValid = false; }
+
+    // frame과 마지막 전송 프레임을 비교하여 변경된 타일만 전송, 전송한 바이트 수 반환
+    size_t flush(u8x8_t* u8x8, const uint8_t* frame) {
+        // 실제로 전송한 프레임의 소요 시간만 기록 (변경 없는 프레임은 비교만 하고 끝남)
+        static MetricsRegistry::Histogram& flushHistogram = Metrics.histogram("oled.flush_us");
+        const uint32_t start = micros();
+        size_t sent = 0;
+        const size_t rowBytes = size_t(TileWidth) * 8;
+
+        for (uint8_t ty = 0; ty < TileHeight; ty++) {
+            const uint8_t* row = frame + ty * rowBytes;
+            uint8_t* shadowRow = shadow + ty * rowBytes;
+
+            int first = -1;
+            int last = -1;
+            for (uint8_t tx = 0; tx < TileWidth; tx++) {
+                if (!shadowValid || memcmp(row + tx * 8, shadowRow + tx * 8, 8) != 0) {
+                    if (first < 0) first = tx;
+                    last = tx;
+                }
+            }
+            if (first < 0) continue;
+
+            const size_t offset = size_t(first) * 8;
+            const uint8_t count = uint8_t(last - first + 1);
+            memcpy(shadowRow + offset, row + offset, count * 8);
+            u8x8_DrawTile(u8x8, uint8_t(first), ty, count, const_cast<uint8_t*>(row + offset));
+            sent += count * 8;
+        }
+
+        if (sent > 0) {
+            u8x8_RefreshDisplay(u8x8);
+            flushHistogram.record(micros() - start);
+        }
+        shadowValid = true;
+        lastFlushBytes = sent;
+        return sent;
+    }
+
+    // 전송 태스크를 시작한다. 이후 submit()은 호출한 태스크를 I2C 전송 동안 막지 않는다.
+    bool beginAsync(u8x8_t* display, UBaseType_t priority = 1, uint32_t stackSize = 3072) {
+        if (asyncTask) return true;
+
+        pending = static_cast<uint8_t*>(malloc(frameSize));
+        sending = static_cast<uint8_t*>(malloc(frameSize));
+        if (!pending || !sending) {
+            releaseBuffers();
+            return false;
+        }
+
+        asyncDisplay = display;
+        if (xTaskCreate(taskEntry, "OLED_Flush", stackSize, this, priority, &asyncTask) != pdPASS) {
+            // 태스크가 없으면 동기 모드 그대로이므로 버퍼도 돌려준다
+            asyncTask = nullptr;
+            asyncDisplay = nullptr;
+            releaseBuffers();
+            return false;
+        }
+        Metrics.watchTask("OLED_Flush", asyncTask);
+        return true;
+    }
+
+    // 동기 모드에서는 바로 flush(), 비동기 모드에서는 대기 버퍼에 복사 후 전송 태스크를 깨운다
+    void submit(u8x8_t* display, const uint8_t* frame) {
+        if (!asyncTask) {
+            flush(display, frame);
+            return;
+        }
+
+        portENTER_CRITICAL(&pendingLock);
+        memcpy(pending, frame, frameSize);
+        if (hasPending) coalescedFrames++;  // 아직 안 보낸 프레임을 덮어씀
+        hasPending = true;
+        portEXIT_CRITICAL(&pendingLock);
+
+        xTaskNotifyGive(asyncTask);
+    }
+
+    // 마지막 flush()에서 전송한 바이트 수 (전체 프레임은 frameSize)
+    size_t getLastFlushBytes() const { return lastFlushBytes; }
+
+    // 전송 태스크가 밀려서 건너뛴(합쳐진) 프레임 수
+    uint32_t getCoalescedFrames() const { return coalescedFrames; }
+
+    bool isAsync() const { return asyncTask != nullptr; }
+
+private:
+    uint8_t shadow[frameSize];
+    bool shadowValid = false;
+    size_t lastFlushBytes = 0;
+
+    // 비동기 모드 상태
+    TaskHandle_t asyncTask = nullptr;
+    u8x8_t* asyncDisplay = nullptr;
+    uint8_t* pending = nullptr;   // 생산자가 마지막으로 제출한 프레임
+    uint8_t* sending = nullptr;   // 전송 태스크가 보내는 중인 프레임
+    bool hasPending = false;
+    volatile uint32_t coalescedFrames = 0;
+    portMUX_TYPE pendingLock = portMUX_INITIALIZER_UNLOCKED;
+
+    void releaseBuffers() {
+        free(pending);
+        free(sending);
+        pending = sending = nullptr;
+    }
+
+    static void taskEntry(void* arg) {
+        static_cast<FrameFlusher*>(arg)->run();
+    }
+
+    void run() {
+        while (true) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+            portENTER_CRITICAL(&pendingLock);
+            bool ready = hasPending;
+            if (ready) {
+                memcpy(sending, pending, frameSize);
+                hasPending = false;
+            }
+            portEXIT_CRITICAL(&pendingLock);
+
+            if (ready) {
+                flush(asyncDisplay, sending);
+            }
+        }
+    }
+};
+
+#endif
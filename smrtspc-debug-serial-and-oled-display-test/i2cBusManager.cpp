@@ -0,0 +1,160 @@
+#include "i2cBusManager.h"
+#include "metricsRegistry.h"
+
+bool I2cBusManager::begin(int sdaPin, int sclPin) {
+    if (mutex) return true;
+
+    mutex = xSemaphoreCreateMutex();
+    if (!mutex) return false;
+
+    currentClock = DEFAULT_CLOCK;
+    return Wire.begin(sdaPin, sclPin, currentClock);
+}
+
+void I2cBusManager::setDeviceClock(uint8_t address, uint32_t clockHz) {
+    Device* device = getDevice(address);
+    if (device) device->clockHz = clockHz;
+}
+
+bool I2cBusManager::acquire(uint8_t address, I2cPriority priority) {
+    if (!mutex) return false;
+
+    const uint32_t start = micros();
+    if (priority == I2cPriority::URGENT) {
+        highWaiting++;
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        highWaiting--;
+    } else {
+        while (true) {
+            while (highWaiting.load() > 0) {
+                vTaskDelay(1);
+            }
+            xSemaphoreTake(mutex, portMAX_DELAY);
+            if (highWaiting.load() == 0) break;
+            xSemaphoreGive(mutex);  // 그 사이 도착한 URGENT 요청에 양보
+        }
+    }
+
+    acquiredAt = micros();
+    static MetricsRegistry::Histogram& waitHistogram = Metrics.histogram("i2c.wait_us");
+    waitHistogram.record(acquiredAt - start);
+    active = getDevice(address);
+    if (active) {
+        I2cDeviceStats& stats = active->stats;
+        stats.lastWaitMicros = acquiredAt - start;
+        stats.totalWaitMicros += stats.lastWaitMicros;
+        if (stats.lastWaitMicros > stats.maxWaitMicros) stats.maxWaitMicros = stats.lastWaitMicros;
+
+        // 장치마다 다른 클럭이면 전송 전에 바꾼다
+        if (active->clockHz != currentClock) {
+            Wire.setClock(active->clockHz);
+            currentClock = active->clockHz;
+        }
+    }
+    return true;
+}
+
+void I2cBusManager::release(uint8_t error) {
+    if (!mutex) return;  // acquire()가 실패했으면 잡은 적 없는 잠금
+
+    // 장치 등록 여부와 관계없이 버스 전체 오류 수
+    static MetricsRegistry::Counter& errorCounter = Metrics.counter("i2c.errors");
+    if (error != 0) errorCounter.add();
+    if (active) {
+        I2cDeviceStats& stats = active->stats;
+        stats.transactions++;
+        if (error != 0) stats.errors++;
+        stats.lastBusyMicros = micros() - acquiredAt;
+        stats.totalBusyMicros += stats.lastBusyMicros;
+        if (stats.lastBusyMicros > stats.maxBusyMicros) stats.maxBusyMicros = stats.lastBusyMicros;
+        active = nullptr;
+    }
+    xSemaphoreGive(mutex);
+}
+
+uint8_t I2cBusManager::write(uint8_t address, const uint8_t* data, size_t length, I2cPriority priority) {
+    if (!acquire(address, priority)) return 4;  // Wire의 "other error"
+
+    Wire.beginTransmission(address);
+    Wire.write(data, length);
+    const uint8_t error = Wire.endTransmission();
+    release(error);
+    return error;
+}
+
+const I2cDeviceStats* I2cBusManager::getStats(uint8_t address) const {
+    for (uint8_t i = 0; i < deviceCount; i++) {
+        if (devices[i].address == address) return &devices[i].stats;
+    }
+    return nullptr;
+}
+
+void I2cBusManager::resetStats() {
+    portENTER_CRITICAL(&tableLock);
+    for (uint8_t i = 0; i < deviceCount; i++) {
+        devices[i].stats = I2cDeviceStats();
+    }
+    portEXIT_CRITICAL(&tableLock);
+}
+
+I2cBusManager::Device* I2cBusManager::getDevice(uint8_t address) {
+    Device* device = nullptr;
+    portENTER_CRITICAL(&tableLock);
+    for (uint8_t i = 0; i < deviceCount; i++) {
+        if (devices[i].address == address) {
+            device = &devices[i];
+            break;
+        }
+    }
+    if (!device && deviceCount < MAX_DEVICES) {
+        device = &devices[deviceCount++];
+        device->address = address;
+        device->clockHz = DEFAULT_CLOCK;
+        device->stats = I2cDeviceStats();
+    }
+    portEXIT_CRITICAL(&tableLock);
+    return device;
+}
+
+// u8x8_byte_arduino_hw_i2c와 같은 동작을 하되 Wire 사용을 버스 관리자로 감싼다.
+// START_TRANSFER ~ END_TRANSFER 한 묶음이 하나의 트랜잭션이다.
+// u8x8은 START_TRANSFER의 반환값을 보지 않으므로, 버스를 얻지 못한 전송은 SEND/END_TRANSFER를 건너뛴다.
+uint8_t I2cBusManager::u8x8ByteCallback(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+    const uint8_t address = u8x8_GetI2CAddress(u8x8) >> 1;
+
+    switch (msg) {
+        case U8X8_MSG_BYTE_INIT: {
+            // U8g2 생성자에 넘긴 핀을 사용 (지정하지 않으면 보드 기본 핀)
+            const uint8_t clock = u8x8->pins[U8X8_PIN_I2C_CLOCK];
+            const uint8_t data = u8x8->pins[U8X8_PIN_I2C_DATA];
+            I2cBus.begin(data == U8X8_PIN_NONE ? 5 : data, clock == U8X8_PIN_NONE ? 6 : clock);
+            break;
+        }
+        case U8X8_MSG_BYTE_SET_DC:
+            break;
+        case U8X8_MSG_BYTE_START_TRANSFER: {
+            // setBusClock()으로 정한 값, 없으면 드라이버 기본 클럭
+            if (u8x8->bus_clock == 0) {
+                u8x8->bus_clock = u8x8->display_info->i2c_bus_clock_100kHz * 100000UL;
+            }
+            I2cBus.setDeviceClock(address, u8x8->bus_clock);
+            if (!I2cBus.acquire(address, I2cPriority::NORMAL)) return 0;
+            I2cBus.u8x8Owner = u8x8;
+            Wire.beginTransmission(address);
+            break;
+        }
+        case U8X8_MSG_BYTE_SEND:
+            if (I2cBus.u8x8Owner != u8x8) return 0;
+            Wire.write(static_cast<const uint8_t*>(arg_ptr), arg_int);
+            break;
+        case U8X8_MSG_BYTE_END_TRANSFER: {
+            if (I2cBus.u8x8Owner != u8x8) return 0;
+            I2cBus.u8x8Owner = nullptr;
+            I2cBus.release(Wire.endTransmission());
+            break;
+        }
+        default:
+            return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,100 @@
+#ifndef I2C_BUS_MANAGER_H
+#define I2C_BUS_MANAGER_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <U8g2lib.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <atomic>
+
+// 하나의 I2C 버스(Wire)를 OLED, 모터 보드 등 여러 드라이버가 나눠 쓰도록 관리한다.
+//  - 버스 초기화(Wire.begin)는 여기서 한 번만 한다. (ESP32-C3 Super Mini: SDA=5, SCL=6)
+//  - 트랜잭션 단위로 뮤텍스를 잡고, 장치마다 등록한 클럭으로 바꿔서 전송한다.
+//  - URGENT 우선순위(모터 명령)가 기다리고 있으면 NORMAL(화면 전송)은 다음 트랜잭션을 양보한다.
+//    화면은 u8x8 전송 단위(수십 바이트)로 나뉘어 있으므로 프레임 전송 중에도 모터 명령이 끼어든다.
+//  - 장치별로 대기 시간과 버스 점유 시간을 기록한다.
+enum class I2cPriority : uint8_t {
+    NORMAL,  // 화면 프레임 등 대량 전송
+    URGENT   // 모터 명령 등 짧고 급한 전송
+};
+
+struct I2cDeviceStats {
+    uint32_t transactions = 0;
+    uint32_t errors = 0;            // endTransmission() 오류
+    uint32_t lastWaitMicros = 0;    // 버스를 얻기까지 기다린 시간
+    uint32_t maxWaitMicros = 0;
+    uint64_t totalWaitMicros = 0;
+    uint32_t lastBusyMicros = 0;    // 버스를 잡고 있던 시간
+    uint32_t maxBusyMicros = 0;
+    uint64_t totalBusyMicros = 0;
+};
+
+class I2cBusManager {
+public:
+    // 싱글톤 인스턴스 반환
+    static I2cBusManager& getInstance() {
+        static I2cBusManager instance;
+        return instance;
+    }
+
+    // 버스 초기화. 이미 초기화되었으면 핀 인자는 무시한다.
+    bool begin(int sdaPin = 5, int sclPin = 6);
+
+    // 장치(7비트 주소)별 버스 클럭. 등록하지 않은 장치는 DEFAULT_CLOCK
+    void setDeviceClock(uint8_t address, uint32_t clockHz);
+
+    // 트랜잭션 시작/끝. acquire()와 release() 사이에서 Wire를 직접 사용한다.
+    bool acquire(uint8_t address, I2cPriority priority = I2cPriority::NORMAL);
+    void release(uint8_t error = 0);
+
+    // 한 번의 쓰기 트랜잭션. endTransmission() 결과(0 = 성공)를 반환, 버스를 못 얻으면 4
+    uint8_t write(uint8_t address, const uint8_t* data, size_t length,
+                  I2cPriority priority = I2cPriority::NORMAL);
+
+    // 장치 통계 (등록된 적 없는 주소면 nullptr)
+    const I2cDeviceStats* getStats(uint8_t address) const;
+    void resetStats();
+
+    // U8g2 HW I2C 바이트 콜백 대신 쓰는 콜백. 화면 전송도 이 버스 관리자를 거친다.
+    static uint8_t u8x8ByteCallback(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr);
+
+    static constexpr uint32_t DEFAULT_CLOCK = 100000;
+
+private:
+    // 생성자/소멸자 private로 선언하여 싱글톤 패턴 유지
+    I2cBusManager() = default;
+    ~I2cBusManager() = default;
+    I2cBusManager(const I2cBusManager&) = delete;
+    I2cBusManager& operator=(const I2cBusManager&) = delete;
+
+    static constexpr uint8_t MAX_DEVICES = 8;
+
+    struct Device {
+        uint8_t address;
+        uint32_t clockHz;
+        I2cDeviceStats stats;
+    };
+
+    Device devices[MAX_DEVICES];
+    uint8_t deviceCount = 0;
+
+    SemaphoreHandle_t mutex = nullptr;
+    std::atomic<uint32_t> highWaiting{0};  // 버스를 기다리는 URGENT 우선순위 요청 수
+    portMUX_TYPE tableLock = portMUX_INITIALIZER_UNLOCKED;
+    uint32_t currentClock = 0;
+
+    // 현재 트랜잭션
+    Device* active = nullptr;
+    uint32_t acquiredAt = 0;
+    u8x8_t* u8x8Owner = nullptr;   // 버스를 얻은 u8x8 전송 (START_TRANSFER가 실패했으면 nullptr)
+
+    // 장치 테이블에서 찾고 없으면 등록 (테이블이 가득 차면 nullptr)
+    Device* getDevice(uint8_t address);
+};
+
+// 전역 인스턴스 참조
+inline I2cBusManager& I2cBus = I2cBusManager::getInstance();
+
+#endif
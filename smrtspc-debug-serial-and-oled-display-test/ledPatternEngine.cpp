@@ -0,0 +1,118 @@
+#include "ledPatternEngine.h"
+
+bool LedPatternEngine::begin(uint8_t pin, bool activeLow) {
+    if (!mutex) {
+        mutex = xSemaphoreCreateMutex();
+        if (!mutex) return false;
+    }
+    if (!timer) {
+        esp_timer_create_args_t args = {};
+        args.callback = timerCallback;
+        args.arg = this;
+        args.dispatch_method = ESP_TIMER_TASK;
+        args.name = "led_pattern";
+        if (esp_timer_create(&args, &timer) != ESP_OK) {
+            timer = nullptr;
+            return false;
+        }
+    }
+
+    if (attached) end();
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    this->pin = pin;
+    this->activeLow = activeLow;
+    attached = ledcAttach(pin, PWM_FREQUENCY, PWM_RESOLUTION);
+    lastLevel = -1;
+    if (attached) write(0);
+    xSemaphoreGive(mutex);
+    return attached;
+}
+
+void LedPatternEngine::end() {
+    if (!mutex) return;
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (running) {
+        esp_timer_stop(timer);
+        running = false;
+    }
+    sequencer.clear();
+    if (attached) {
+        write(0);
+        ledcDetach(pin);
+        attached = false;
+    }
+    xSemaphoreGive(mutex);
+}
+
+bool LedPatternEngine::blink(uint16_t times, uint16_t onMs, uint16_t offMs, uint8_t peak) {
+    return enqueue({LedSequencer::Shape::BLINK, times, onMs, offMs, peak});
+}
+
+bool LedPatternEngine::pulse(uint16_t times, uint16_t periodMs, uint8_t peak) {
+    return enqueue({LedSequencer::Shape::PULSE, times, periodMs, 0, peak});
+}
+
+bool LedPatternEngine::breathe(uint16_t times, uint16_t periodMs, uint8_t peak) {
+    return enqueue({LedSequencer::Shape::BREATHE, times, periodMs, 0, peak});
+}
+
+void LedPatternEngine::clear() {
+    if (!mutex) return;
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    sequencer.clear();
+    if (running) {
+        esp_timer_stop(timer);
+        running = false;
+    }
+    write(0);
+    xSemaphoreGive(mutex);
+}
+
+bool LedPatternEngine::isIdle() {
+    if (!mutex) return true;
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    bool idle = sequencer.isIdle();
+    xSemaphoreGive(mutex);
+    return idle;
+}
+
+bool LedPatternEngine::enqueue(const LedSequencer::Pattern& pattern) {
+    if (!attached) return false;
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    bool queued = sequencer.enqueue(pattern);
+    if (queued && !running) {
+        // 첫 밝기는 바로 적용하고 이후는 타이머가 진행
+        write(sequencer.tick(0));
+        running = esp_timer_start_periodic(timer, TICK_MS * 1000) == ESP_OK;
+    }
+    xSemaphoreGive(mutex);
+    return queued;
+}
+
+// 밝기가 바뀔 때만 LEDC 듀티를 갱신
+void LedPatternEngine::write(uint8_t level) {
+    if (!attached || level == lastLevel) return;
+    ledcWrite(pin, activeLow ? 255 - level : level);
+    lastLevel = level;
+}
+
+void LedPatternEngine::onTick() {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (running) {
+        write(sequencer.tick(TICK_MS));
+        if (sequencer.isIdle()) {
+            esp_timer_stop(timer);
+            running = false;
+        }
+    }
+    xSemaphoreGive(mutex);
+}
+
+void LedPatternEngine::timerCallback(void* arg) {
+    static_cast<LedPatternEngine*>(arg)->onTick();
+}
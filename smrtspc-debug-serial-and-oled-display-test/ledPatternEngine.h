@@ -0,0 +1,69 @@
+#ifndef LED_PATTERN_ENGINE_H
+#define LED_PATTERN_ENGINE_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "ledSequencer.h"
+
+// LedSequencer를 esp_timer 주기 콜백과 LEDC PWM으로 백그라운드에서 재생한다.
+// blink()/pulse()/breathe()는 큐에 넣고 바로 반환하므로 호출한 태스크는 delay() 없이 계속 진행한다.
+// 재생할 패턴이 없으면 타이머를 멈추므로 대기 중에는 CPU를 쓰지 않는다.
+//
+// 주의: 같은 핀에 pinMode()/digitalWrite()를 쓰려면 먼저 end()로 LEDC 연결을 해제할 것.
+class LedPatternEngine {
+public:
+    // 싱글톤 인스턴스 반환
+    static LedPatternEngine& getInstance() {
+        static LedPatternEngine instance;
+        return instance;
+    }
+
+    // 핀을 LEDC에 연결. activeLow = true 이면 LOW가 켜짐 (ESP32-C3 내장 LED)
+    bool begin(uint8_t pin, bool activeLow = false);
+
+    // 재생을 멈추고 LED를 끈 뒤 LEDC 연결 해제
+    void end();
+
+    // 패턴 추가 (times = 0 이면 다음 패턴이 들어올 때까지 반복). 큐가 가득 차면 false
+    bool blink(uint16_t times, uint16_t onMs, uint16_t offMs, uint8_t peak = 255);
+    bool pulse(uint16_t times, uint16_t periodMs, uint8_t peak = 255);
+    bool breathe(uint16_t times, uint16_t periodMs, uint8_t peak = 255);
+
+    // 대기 중인 패턴까지 모두 취소하고 끔
+    void clear();
+
+    bool isIdle();
+    bool isAttached() const { return attached; }
+
+private:
+    // 생성자/소멸자 private로 선언하여 싱글톤 패턴 유지
+    LedPatternEngine() = default;
+    ~LedPatternEngine() = default;
+    LedPatternEngine(const LedPatternEngine&) = delete;
+    LedPatternEngine& operator=(const LedPatternEngine&) = delete;
+
+    static constexpr uint32_t TICK_MS = 10;
+    static constexpr uint32_t PWM_FREQUENCY = 5000;
+    static constexpr uint8_t PWM_RESOLUTION = 8;
+
+    LedSequencer sequencer;
+    SemaphoreHandle_t mutex = nullptr;   // 큐 조작과 타이머 시작/정지를 직렬화
+    esp_timer_handle_t timer = nullptr;
+    bool running = false;
+    uint8_t pin = 0;
+    bool activeLow = false;
+    bool attached = false;
+    int lastLevel = -1;
+
+    bool enqueue(const LedSequencer::Pattern& pattern);
+    void write(uint8_t level);
+    void onTick();
+    static void timerCallback(void* arg);
+};
+
+// 전역 인스턴스 참조
+inline LedPatternEngine& StatusLed = LedPatternEngine::getInstance();
+
+#endif
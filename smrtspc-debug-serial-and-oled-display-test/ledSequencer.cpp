@@ -0,0 +1,87 @@
+#include "ledSequencer.h"
+
+bool LedSequencer::blink(uint16_t times, uint16_t onMs, uint16_t offMs, uint8_t peak) {
+    return enqueue({Shape::BLINK, times, onMs, offMs, peak});
+}
+
+bool LedSequencer::pulse(uint16_t times, uint16_t periodMs, uint8_t peak) {
+    return enqueue({Shape::PULSE, times, periodMs, 0, peak});
+}
+
+bool LedSequencer::breathe(uint16_t times, uint16_t periodMs, uint8_t peak) {
+    return enqueue({Shape::BREATHE, times, periodMs, 0, peak});
+}
+
+bool LedSequencer::enqueue(const Pattern& pattern) {
+    if (count >= queueCapacity || periodOf(pattern) == 0) return false;
+    queue[(head + count) % queueCapacity] = pattern;
+    count++;
+    return true;
+}
+
+void LedSequencer::clear() {
+    head = 0;
+    count = 0;
+    playing = false;
+    level = 0;
+}
+
+uint8_t LedSequencer::tick(uint32_t elapsedMs) {
+    if (!playing && !startNext()) {
+        level = 0;
+        return level;
+    }
+
+    phaseMs += elapsedMs;
+    uint32_t period = periodOf(current);
+    while (phaseMs >= period) {
+        phaseMs -= period;
+        cyclesDone++;
+
+        // 정해진 횟수를 채웠거나, 무한 패턴인데 다음 패턴이 기다리고 있으면 넘어간다
+        const bool finished = current.times ? cyclesDone >= current.times : count > 0;
+        if (!finished) continue;
+
+        const uint32_t carry = phaseMs;
+        if (!startNext()) {
+            level = 0;
+            return level;
+        }
+        phaseMs = carry;
+        period = periodOf(current);
+    }
+
+    level = levelAt(current, phaseMs);
+    return level;
+}
+
+bool LedSequencer::startNext() {
+    playing = count > 0;
+    if (!playing) return false;
+
+    current = queue[head];
+    head = (head + 1) % queueCapacity;
+    count--;
+    phaseMs = 0;
+    cyclesDone = 0;
+    return true;
+}
+
+uint32_t LedSequencer::periodOf(const Pattern& pattern) {
+    return uint32_t(pattern.onMs) + pattern.offMs;
+}
+
+uint8_t LedSequencer::levelAt(const Pattern& pattern, uint32_t phaseMs) {
+    if (pattern.shape == Shape::BLINK) {
+        return phaseMs < pattern.onMs ? pattern.peak : 0;
+    }
+
+    // 주기의 앞 절반은 밝아지고 뒤 절반은 어두워지는 삼각파 (0~255)
+    const uint32_t half = pattern.onMs / 2 ? pattern.onMs / 2 : 1;
+    const uint32_t distance = phaseMs < half ? phaseMs : pattern.onMs - phaseMs;
+    uint32_t ramp = distance >= half ? 255 : distance * 255 / half;
+    if (pattern.shape == Shape::BREATHE) {
+        ramp = ramp * ramp / 255;
+    }
+    return uint8_t(ramp * pattern.peak / 255);
+}
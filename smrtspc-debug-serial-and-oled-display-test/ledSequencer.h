@@ -0,0 +1,60 @@
+#ifndef LED_SEQUENCER_H
+#define LED_SEQUENCER_H
+
+#include <stdint.h>
+
+// LED 패턴(깜빡임, 펄스, 숨쉬기)을 큐에 쌓아두고 경과 시간에 따라 밝기(0~255)를 계산하는 순수 로직.
+// 하드웨어(타이머, LEDC)에 의존하지 않으므로 호스트에서도 그대로 빌드해 검증할 수 있다.
+// 실제 구동은 ledPatternEngine이 주기적으로 tick()을 호출하여 맡는다.
+//
+// times = 0 이면 무한 반복. 무한 패턴 뒤에 다른 패턴이 들어오면 현재 주기를 마치고 넘어간다.
+class LedSequencer {
+public:
+    enum class Shape : uint8_t {
+        BLINK,    // onMs 동안 켜고 offMs 동안 끔
+        PULSE,    // 직선으로 밝아졌다 어두워짐
+        BREATHE   // 제곱 곡선으로 부드럽게 밝아졌다 어두워짐 (사람 눈에 자연스러움)
+    };
+
+    struct Pattern {
+        Shape shape;
+        uint16_t times;
+        uint16_t onMs;    // PULSE/BREATHE 는 주기 전체 (offMs = 0)
+        uint16_t offMs;
+        uint8_t peak;
+    };
+
+    static constexpr uint8_t queueCapacity = 8;
+
+    // 패턴 추가. 큐가 가득 차면 false
+    bool blink(uint16_t times, uint16_t onMs, uint16_t offMs, uint8_t peak = 255);
+    bool pulse(uint16_t times, uint16_t periodMs, uint8_t peak = 255);
+    bool breathe(uint16_t times, uint16_t periodMs, uint8_t peak = 255);
+    bool enqueue(const Pattern& pattern);
+
+    // 재생 중인 패턴과 대기 중인 패턴을 모두 버리고 끔
+    void clear();
+
+    // elapsedMs 만큼 시간을 진행하고 현재 밝기를 반환
+    uint8_t tick(uint32_t elapsedMs);
+
+    uint8_t getLevel() const { return level; }
+    bool isIdle() const { return !playing && count == 0; }
+
+private:
+    Pattern queue[queueCapacity];
+    uint8_t head = 0;
+    uint8_t count = 0;
+
+    Pattern current;
+    bool playing = false;
+    uint32_t phaseMs = 0;      // 현재 주기 안에서의 위치
+    uint16_t cyclesDone = 0;
+    uint8_t level = 0;
+
+    bool startNext();
+    static uint32_t periodOf(const Pattern& pattern);
+    static uint8_t levelAt(const Pattern& pattern, uint32_t phaseMs);
+};
+
+#endif
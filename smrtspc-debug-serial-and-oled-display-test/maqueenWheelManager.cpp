@@ -8,114 +8,112 @@
 
 void MaqueenWheelManager::begin(uint8_t i2cAddress, uint8_t sdaPin, uint8_t sclPin) {
     this->i2cAddress = i2cAddress;
-    Wire.begin(sdaPin, sclPin);
+    I2cBus.begin(sdaPin, sclPin);
+    I2cBus.setDeviceClock(i2cAddress, I2C_CLOCK);
     currentState = MotorState::STOP;
     currentSpeed = 0;
     isInitialized = true;
+    lastAppliedValid = false;
     stop();  // 초기 정지
 }
 
-void MaqueenWheelManager::stop() {
-    if (!isInitialized) return;
+bool MaqueenWheelManager::stop() {
+    if (!isInitialized) return false;
     
-    sendMotorCommand(MOTOR_LEFT, MOTOR_STOP, 0);
-    sendMotorCommand(MOTOR_RIGHT, MOTOR_STOP, 0);
-    currentState = MotorState::STOP;
-    currentSpeed = 0;
+    return drive(MotorState::STOP, 0, {MOTOR_STOP, 0, MOTOR_STOP, 0});
 }
 
-void MaqueenWheelManager::forward(uint8_t speed) {
-    if (!isInitialized) return;
+bool MaqueenWheelManager::forward(uint8_t speed) {
+    if (!isInitialized) return false;
     
-    sendMotorCommand(MOTOR_LEFT, MOTOR_MOVE, speed);
-    sendMotorCommand(MOTOR_RIGHT, MOTOR_MOVE, speed);
-    currentState = MotorState::FORWARD;
-    currentSpeed = speed;
+    return drive(MotorState::FORWARD, speed, {MOTOR_MOVE, speed, MOTOR_MOVE, speed});
 }
 
-void MaqueenWheelManager::backward(uint8_t speed) {
-    if (!isInitialized) return;
+bool MaqueenWheelManager::backward(uint8_t speed) {
+    if (!isInitialized) return false;
     
-    sendMotorCommand(MOTOR_LEFT, MOTOR_MOVE | 0x01, speed);
-    sendMotorCommand(MOTOR_RIGHT, MOTOR_MOVE | 0x01, speed);
-    currentState = MotorState::BACKWARD;
-    currentSpeed = speed;
+    return drive(MotorState::BACKWARD, speed, {MOTOR_MOVE | 0x01, speed, MOTOR_MOVE | 0x01, speed});
 }
 
-void MaqueenWheelManager::turnLeft(uint8_t speed) {
-    if (!isInitialized) return;
+bool MaqueenWheelManager::turnLeft(uint8_t speed) {
+    if (!isInitialized) return false;
     
-    sendMotorCommand(MOTOR_LEFT, MOTOR_MOVE, speed / 2);
-    sendMotorCommand(MOTOR_RIGHT, MOTOR_MOVE, speed);
-    currentState = MotorState::TURN_LEFT;
-    currentSpeed = speed;
+    return drive(MotorState::TURN_LEFT, speed, {MOTOR_MOVE, uint8_t(speed / 2), MOTOR_MOVE, speed});
 }
 
-void MaqueenWheelManager::turnRight(uint8_t speed) {
-    if (!isInitialized) return;
+bool MaqueenWheelManager::turnRight(uint8_t speed) {
+    if (!isInitialized) return false;
     
-    sendMotorCommand(MOTOR_LEFT, MOTOR_MOVE, speed);
-    sendMotorCommand(MOTOR_RIGHT, MOTOR_MOVE, speed / 2);
-    currentState = MotorState::TURN_RIGHT;
-    currentSpeed = speed;
+    return drive(MotorState::TURN_RIGHT, speed, {MOTOR_MOVE, speed, MOTOR_MOVE, uint8_t(speed / 2)});
 }
 
-void MaqueenWheelManager::rotateLeft(uint8_t speed) {
-    if (!isInitialized) return;
+bool MaqueenWheelManager::rotateLeft(uint8_t speed) {
+    if (!isInitialized) return false;
     
-    sendMotorCommand(MOTOR_LEFT, MOTOR_MOVE | 0x01, speed);
-    sendMotorCommand(MOTOR_RIGHT, MOTOR_MOVE, speed);
-    currentState = MotorState::ROTATE_LEFT;
-    currentSpeed = speed;
+    return drive(MotorState::ROTATE_LEFT, speed, {MOTOR_MOVE | 0x01, speed, MOTOR_MOVE, speed});
 }
 
-void MaqueenWheelManager::rotateRight(uint8_t speed) {
-    if (!isInitialized) return;
+bool MaqueenWheelManager::rotateRight(uint8_t speed) {
+    if (!isInitialized) return false;
     
-    sendMotorCommand(MOTOR_LEFT, MOTOR_MOVE, speed);
-    sendMotorCommand(MOTOR_RIGHT, MOTOR_MOVE | 0x01, speed);
-    currentState = MotorState::ROTATE_RIGHT;
-    currentSpeed = speed;
+    return drive(MotorState::ROTATE_RIGHT, speed, {MOTOR_MOVE, speed, MOTOR_MOVE | 0x01, speed});
 }
 
-void MaqueenWheelManager::setState(MotorState state, uint8_t speed) {
-    if (!isInitialized) return;
+bool MaqueenWheelManager::setWheelSpeeds(int16_t left, int16_t right) {
+    if (!isInitialized) return false;
+    
+    left = constrain(left, -255, 255);
+    right = constrain(right, -255, 255);
+    const uint8_t leftSpeed = uint8_t(abs(left));
+    const uint8_t rightSpeed = uint8_t(abs(right));
+    
+    // 가장 가까운 기존 상태로 기록 (getState()용)
+    MotorState state;
+    if (left == 0 && right == 0) state = MotorState::STOP;
+    else if (left >= 0 && right >= 0) state = left == right ? MotorState::FORWARD : (left < right ? MotorState::TURN_LEFT : MotorState::TURN_RIGHT);
+    else if (left <= 0 && right <= 0) state = MotorState::BACKWARD;
+    else state = left < 0 ? MotorState::ROTATE_LEFT : MotorState::ROTATE_RIGHT;
+    
+    if (state == MotorState::STOP) {
+        return drive(state, 0, {MOTOR_STOP, 0, MOTOR_STOP, 0});
+    }
+    return drive(state, leftSpeed > rightSpeed ? leftSpeed : rightSpeed,
+                 {uint8_t(left < 0 ? MOTOR_MOVE | 0x01 : MOTOR_MOVE), leftSpeed,
+                  uint8_t(right < 0 ? MOTOR_MOVE | 0x01 : MOTOR_MOVE), rightSpeed});
+}
+
+bool MaqueenWheelManager::setState(MotorState state, uint8_t speed) {
+    if (!isInitialized) return false;
     
     switch (state) {
         case MotorState::STOP:
-            stop();
-            break;
+            return stop();
         case MotorState::FORWARD:
-            forward(speed);
-            break;
+            return forward(speed);
         case MotorState::BACKWARD:
-            backward(speed);
-            break;
+            return backward(speed);
         case MotorState::TURN_LEFT:
-            turnLeft(speed);
-            break;
+            return turnLeft(speed);
         case MotorState::TURN_RIGHT:
-            turnRight(speed);
-            break;
+            return turnRight(speed);
         case MotorState::ROTATE_LEFT:
-            rotateLeft(speed);
-            break;
+            return rotateLeft(speed);
         case MotorState::ROTATE_RIGHT:
-            rotateRight(speed);
-            break;
+            return rotateRight(speed);
     }
+    return false;
 }
 
 MotorState MaqueenWheelManager::getState() const {
     return currentState;
 }
 
-void MaqueenWheelManager::setSpeed(uint8_t speed) {
-    if (!isInitialized || currentState == MotorState::STOP) return;
+bool MaqueenWheelManager::setSpeed(uint8_t speed) {
+    if (!isInitialized || currentState == MotorState::STOP) return false;
+    if (speed == currentSpeed) return true;
     
-    currentSpeed = speed;
     // 현재 상태 유지하면서 속도만 업데이트
-    setState(currentState, speed);
+    return setState(currentState, speed);
 }
 
 uint8_t MaqueenWheelManager::getSpeed() const {
@@ -125,15 +123,56 @@ uint8_t MaqueenWheelManager::getSpeed() const {
 void MaqueenWheelManager::setI2CAddress(uint8_t address) {
     if (address != i2cAddress) {
         i2cAddress = address;
+        lastAppliedValid = false;
+        I2cBus.setDeviceClock(address, I2C_CLOCK);
         // 주소가 변경되면 모터 정지
         stop();
     }
 }
 
-void MaqueenWheelManager::sendMotorCommand(uint8_t motor, uint8_t dir, uint8_t speed) {
-    Wire.beginTransmission(i2cAddress);
-    Wire.write(motor);
-    Wire.write(dir);
-    Wire.write(speed);
-    Wire.endTransmission();
+bool MaqueenWheelManager::drive(MotorState state, uint8_t speed, const WheelCommand& command) {
+    if (!sendWheelCommand(command)) return false;
+    
+    currentState = state;
+    currentSpeed = speed;
+    return true;
+}
+
+bool MaqueenWheelManager::sendWheelCommand(const WheelCommand& command) {
+    if (lastAppliedValid && command == lastApplied) {
+        stats.commandsSkipped++;
+        return true;
+    }
+    
+    const uint32_t requested = micros();
+    for (uint8_t attempt = 0; attempt <= MAX_RETRIES; attempt++) {
+        if (attempt > 0) stats.retries++;
+        
+        // 레지스터 0x00(왼쪽)부터 0x03(오른쪽 속도)까지 한 번에 기록.
+        // 화면 프레임 전송보다 먼저 버스를 얻도록 URGENT 우선순위로 보낸다.
+        const uint8_t data[] = {MOTOR_LEFT, command.leftDir, command.leftSpeed,
+                                command.rightDir, command.rightSpeed};
+        const uint8_t error = I2cBus.write(i2cAddress, data, sizeof(data), I2cPriority::URGENT);
+        const uint32_t end = micros();
+        const I2cDeviceStats* busStats = I2cBus.getStats(i2cAddress);
+        if (busStats) stats.busMicros += busStats->lastBusyMicros;
+        
+        if (error == 0) {
+            lastApplied = command;
+            lastAppliedValid = true;
+            stats.commandsSent++;
+            stats.lastLatencyMicros = end - requested;
+            if (stats.lastLatencyMicros > stats.maxLatencyMicros) {
+                stats.maxLatencyMicros = stats.lastLatencyMicros;
+            }
+            return true;
+        }
+        stats.busErrors++;
+        stats.lastError = error;
+    }
+    
+    // 모터 보드 상태를 알 수 없으므로 다음 명령은 생략하지 않고 보낸다
+    lastAppliedValid = false;
+    stats.failedCommands++;
+    return false;
 }
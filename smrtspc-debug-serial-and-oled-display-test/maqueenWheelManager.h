@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include <Wire.h>
+#include "i2cBusManager.h"
 
 // 모터 상태 열거형
 enum class MotorState {
@@ -15,6 +16,19 @@ enum class MotorState {
     ROTATE_RIGHT
 };
 
+// I2C 전송 통계 (명령 지연과 버스 점유 시간 측정용)
+struct MaqueenBusStats {
+    uint32_t commandsSent = 0;      // 성공한 전송 수
+    uint32_t commandsSkipped = 0;   // 마지막 상태와 같아서 생략한 명령 수
+    uint32_t retries = 0;           // 재시도 횟수
+    uint32_t busErrors = 0;         // endTransmission() 오류 횟수 (재시도 포함)
+    uint32_t failedCommands = 0;    // 재시도까지 실패한 명령 수
+    uint8_t lastError = 0;          // 마지막 endTransmission() 오류 코드
+    uint32_t lastLatencyMicros = 0; // 마지막 명령: 호출부터 전송 완료까지
+    uint32_t maxLatencyMicros = 0;
+    uint64_t busMicros = 0;         // I2C 버스를 잡고 있던 누적 시간 (점유율 = busMicros / 경과 시간)
+};
+
 class MaqueenWheelManager {
 public:
     // 싱글톤 인스턴스 반환
@@ -23,26 +37,33 @@ public:
         return instance;
     }
 
-    // 초기화
-    void begin(uint8_t i2cAddress = 0x10, uint8_t sdaPin = 6, uint8_t sclPin = 5);
+    // 초기화 (I2C 버스는 I2cBus가 관리, 이미 초기화되었으면 핀 인자는 무시된다)
+    void begin(uint8_t i2cAddress = 0x10, uint8_t sdaPin = 5, uint8_t sclPin = 6);
     
-    // 기본 제어
-    void stop();
-    void forward(uint8_t speed);
-    void backward(uint8_t speed);
-    void turnLeft(uint8_t speed);
-    void turnRight(uint8_t speed);
-    void rotateLeft(uint8_t speed);
-    void rotateRight(uint8_t speed);
+    // 기본 제어 (두 바퀴를 한 번의 I2C 전송으로 설정, 재시도까지 실패하면 false)
+    bool stop();
+    bool forward(uint8_t speed);
+    bool backward(uint8_t speed);
+    bool turnLeft(uint8_t speed);
+    bool turnRight(uint8_t speed);
+    bool rotateLeft(uint8_t speed);
+    bool rotateRight(uint8_t speed);
+    
+    // 좌우 바퀴 속도 직접 지정 (-255 ~ 255, 음수 = 후진). 모션 컨트롤러가 사용
+    bool setWheelSpeeds(int16_t left, int16_t right);
     
     // 상태 기반 제어
-    void setState(MotorState state, uint8_t speed);
+    bool setState(MotorState state, uint8_t speed);
     MotorState getState() const;
     
-    // 모터 속도 설정
-    void setSpeed(uint8_t speed);
+    // 모터 속도 설정 (속도가 같으면 전송하지 않음)
+    bool setSpeed(uint8_t speed);
     uint8_t getSpeed() const;
     
+    // 전송 통계
+    const MaqueenBusStats& getBusStats() const { return stats; }
+    void resetBusStats() { stats = MaqueenBusStats(); }
+    
     // I2C 주소 설정
     void setI2CAddress(uint8_t address);
     
@@ -53,14 +74,37 @@ private:
     MaqueenWheelManager(const MaqueenWheelManager&) = delete;
     MaqueenWheelManager& operator=(const MaqueenWheelManager&) = delete;
     
-    // I2C 명령 전송
-    void sendMotorCommand(uint8_t motor, uint8_t dir, uint8_t speed);
+    // 두 바퀴의 방향/속도. 레지스터 0x00부터 [왼쪽 방향, 왼쪽 속도, 오른쪽 방향, 오른쪽 속도] 순서
+    struct WheelCommand {
+        uint8_t leftDir;
+        uint8_t leftSpeed;
+        uint8_t rightDir;
+        uint8_t rightSpeed;
+        
+        bool operator==(const WheelCommand& other) const {
+            return leftDir == other.leftDir && leftSpeed == other.leftSpeed &&
+                   rightDir == other.rightDir && rightSpeed == other.rightSpeed;
+        }
+    };
+    
+    static constexpr uint8_t MAX_RETRIES = 2;
+    static constexpr uint32_t I2C_CLOCK = 100000;
+    
+    // 상태 변경 후 명령 전송, 성공해야 현재 상태를 바꾼다
+    bool drive(MotorState state, uint8_t speed, const WheelCommand& command);
+    
+    // 마지막으로 적용된 명령과 같으면 생략, 아니면 한 번의 I2C 전송 (실패 시 재시도)
+    bool sendWheelCommand(const WheelCommand& command);
     
     // 모터 상태
     MotorState currentState;
     uint8_t currentSpeed;
     uint8_t i2cAddress;
     bool isInitialized;
+    
+    WheelCommand lastApplied = {};
+    bool lastAppliedValid = false;   // false면 다음 명령은 무조건 전송
+    MaqueenBusStats stats;
 };
 
 // 전역 인스턴스 참조
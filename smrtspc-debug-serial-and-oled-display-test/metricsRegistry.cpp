@@ -0,0 +1,180 @@
+#include "metricsRegistry.h"
+#include <string.h>
+
+namespace {
+
+// 이름 복사 (길면 잘림)
+void copyName(char* dest, const char* name) {
+    strncpy(dest, name, MetricsRegistry::NAME_LENGTH - 1);
+    dest[MetricsRegistry::NAME_LENGTH - 1] = '\0';
+}
+
+// 값이 들어갈 구간: 0~1 -> 0, 2~3 -> 1, 4~7 -> 2, ...
+uint8_t bucketOf(uint32_t value) {
+    uint8_t bucket = value < 2 ? 0 : uint8_t(31 - __builtin_clz(value));
+    return bucket < MetricsRegistry::BUCKETS ? bucket : MetricsRegistry::BUCKETS - 1;
+}
+
+int32_t sampleFreeHeap(void*) { return int32_t(ESP.getFreeHeap()); }
+int32_t sampleMinFreeHeap(void*) { return int32_t(ESP.getMinFreeHeap()); }
+int32_t sampleLargestBlock(void*) { return int32_t(ESP.getMaxAllocHeap()); }
+
+// ESP-IDF의 high-water mark는 바이트 단위
+int32_t sampleStackHighWater(void* handle) {
+    return int32_t(uxTaskGetStackHighWaterMark(static_cast<TaskHandle_t>(handle)));
+}
+
+}  // namespace
+
+void MetricsRegistry::Histogram::record(uint32_t value) {
+    const uint8_t bucket = bucketOf(value);
+    portENTER_CRITICAL(&lock);
+    buckets[bucket]++;
+    count++;
+    sum += value;
+    if (value > max) max = value;
+    portEXIT_CRITICAL(&lock);
+}
+
+uint32_t MetricsRegistry::Histogram::percentile(uint8_t percent) const {
+    if (count == 0) return 0;
+    // 순위 = ceil(count * percent / 100), 최소 1
+    uint32_t rank = uint32_t((uint64_t(count) * percent + 99) / 100);
+    if (rank == 0) rank = 1;
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            const uint32_t upper = i == BUCKETS - 1 ? UINT32_MAX : (uint32_t(2) << i) - 1;
+            return upper < max ? upper : max;
+        }
+    }
+    return max;
+}
+
+void MetricsRegistry::Histogram::reset() {
+    portENTER_CRITICAL(&lock);
+    memset(buckets, 0, sizeof(buckets));
+    count = 0;
+    sum = 0;
+    max = 0;
+    portEXIT_CRITICAL(&lock);
+}
+
+MetricsRegistry::MetricsRegistry() {
+    gauge("heap.free", sampleFreeHeap);
+    gauge("heap.min_free", sampleMinFreeHeap);
+    gauge("heap.largest_block", sampleLargestBlock);
+}
+
+MetricsRegistry::Counter& MetricsRegistry::counter(const char* name) {
+    Counter* found = &spareCounter;
+    portENTER_CRITICAL(&tableLock);
+    uint8_t i = 0;
+    while (i < counterCount && strncmp(counters[i].name, name, NAME_LENGTH - 1) != 0) i++;
+    if (i < counterCount) {
+        found = &counters[i];
+    } else if (counterCount < MAX_COUNTERS) {
+        found = &counters[counterCount++];
+        copyName(found->name, name);
+    }
+    portEXIT_CRITICAL(&tableLock);
+    return *found;
+}
+
+MetricsRegistry::Gauge& MetricsRegistry::gauge(const char* name) {
+    return gauge(name, nullptr, nullptr);
+}
+
+MetricsRegistry::Gauge& MetricsRegistry::gauge(const char* name, Sampler sampler, void* context) {
+    Gauge* found = &spareGauge;
+    portENTER_CRITICAL(&tableLock);
+    uint8_t i = 0;
+    while (i < gaugeCount && strncmp(gauges[i].name, name, NAME_LENGTH - 1) != 0) i++;
+    if (i < gaugeCount) {
+        found = &gauges[i];
+    } else if (gaugeCount < MAX_GAUGES) {
+        found = &gauges[gaugeCount++];
+        copyName(found->name, name);
+    }
+    // 같은 이름으로 다시 등록하면 sampler를 바꾼다 (태스크를 다시 만든 경우 등)
+    if (sampler && found != &spareGauge) {
+        found->sampler = sampler;
+        found->context = context;
+    }
+    portEXIT_CRITICAL(&tableLock);
+    return *found;
+}
+
+MetricsRegistry::Histogram& MetricsRegistry::histogram(const char* name) {
+    Histogram* found = &spareHistogram;
+    portENTER_CRITICAL(&tableLock);
+    uint8_t i = 0;
+    while (i < histogramCount && strncmp(histograms[i].name, name, NAME_LENGTH - 1) != 0) i++;
+    if (i < histogramCount) {
+        found = &histograms[i];
+    } else if (histogramCount < MAX_HISTOGRAMS) {
+        found = &histograms[histogramCount++];
+        copyName(found->name, name);
+    }
+    portEXIT_CRITICAL(&tableLock);
+    return *found;
+}
+
+bool MetricsRegistry::watchTask(const char* name, TaskHandle_t handle) {
+    if (!handle) return false;
+    char gaugeName[NAME_LENGTH];
+    snprintf(gaugeName, sizeof(gaugeName), "stack.%s", name);
+    return &gauge(gaugeName, sampleStackHighWater, handle) != &spareGauge;
+}
+
+void MetricsRegistry::sampleGauges() {
+    for (uint8_t i = 0; i < gaugeCount; i++) {
+        if (gauges[i].sampler) gauges[i].set(gauges[i].sampler(gauges[i].context));
+    }
+}
+
+void MetricsRegistry::printStats(Print& out) {
+    sampleGauges();
+    out.printf("=== Metrics (uptime %lu s) ===\n", (unsigned long)(millis() / 1000));
+
+    out.println("Counter                      Value");
+    for (uint8_t i = 0; i < counterCount; i++) {
+        out.printf("%-24s %10lu\n", counters[i].name, (unsigned long)counters[i].get());
+    }
+
+    out.println("Gauge                        Value");
+    for (uint8_t i = 0; i < gaugeCount; i++) {
+        out.printf("%-24s %10ld\n", gauges[i].name, (long)gauges[i].get());
+    }
+
+    out.println("Histogram                    Count     Avg     p50     p90     p99     Max");
+    for (uint8_t i = 0; i < histogramCount; i++) {
+        const Histogram& h = histograms[i];
+        out.printf("%-24s %10lu %7lu %7lu %7lu %7lu %7lu\n", h.name, (unsigned long)h.getCount(),
+                   (unsigned long)h.getAverage(), (unsigned long)h.percentile(50),
+                   (unsigned long)h.percentile(90), (unsigned long)h.percentile(99), (unsigned long)h.getMax());
+    }
+}
+
+void MetricsRegistry::printSnapshot(Print& out) {
+    sampleGauges();
+    const uint32_t now = millis();
+    out.printf("[stats] t=%lu.%03lu", (unsigned long)(now / 1000), (unsigned long)(now % 1000));
+    for (uint8_t i = 0; i < counterCount; i++) {
+        out.printf(" %s=%lu", counters[i].name, (unsigned long)counters[i].get());
+    }
+    for (uint8_t i = 0; i < gaugeCount; i++) {
+        out.printf(" %s=%ld", gauges[i].name, (long)gauges[i].get());
+    }
+    for (uint8_t i = 0; i < histogramCount; i++) {
+        const Histogram& h = histograms[i];
+        out.printf(" %s=%lu/%lu/%lu/%lu", h.name, (unsigned long)h.getCount(), (unsigned long)h.percentile(50),
+                   (unsigned long)h.percentile(99), (unsigned long)h.getMax());
+    }
+    out.println();
+}
+
+void MetricsRegistry::resetHistograms() {
+    for (uint8_t i = 0; i < histogramCount; i++) histograms[i].reset();
+}
@@ -0,0 +1,125 @@
+#ifndef METRICS_REGISTRY_H
+#define METRICS_REGISTRY_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+
+// 실행 중 성능 지표(카운터, 게이지, 지연 히스토그램)를 모아 두는 레지스트리.
+//  - 모듈은 이름으로 지표를 한 번 얻어 참조를 보관하고, 그 뒤로는 이름 찾기 없이 갱신한다.
+//      static MetricsRegistry::Counter& errors = Metrics.counter("i2c.errors");
+//      errors.add();
+//  - 카운터/게이지 갱신은 atomic 하나, 히스토그램 기록은 짧은 임계 구역 하나라서 어느 태스크에서나 쓸 수 있다.
+//  - 히스토그램은 2의 거듭제곱 구간(0~1, 2~3, 4~7, ...)으로 세므로 백분위수는 구간 상한(근사값)이다.
+//  - 힙(빈 힙, 최저 빈 힙, 가장 큰 블록)은 출력할 때 읽는 기본 게이지로 들어 있다.
+//    watchTask()로 등록한 태스크는 스택 high-water mark가 게이지(stack.<이름>)로 나온다.
+// 자리가 없으면 출력되지 않는 예비 지표를 돌려주므로 호출하는 쪽은 실패를 확인할 필요가 없다.
+class MetricsRegistry {
+public:
+    static constexpr uint8_t MAX_COUNTERS = 16;
+    static constexpr uint8_t MAX_GAUGES = 20;
+    static constexpr uint8_t MAX_HISTOGRAMS = 8;
+    static constexpr uint8_t NAME_LENGTH = 24;
+    static constexpr uint8_t BUCKETS = 24;  // 마지막 구간은 2^23 이상 전부
+
+    // 싱글톤 인스턴스 반환
+    static MetricsRegistry& getInstance() {
+        static MetricsRegistry instance;
+        return instance;
+    }
+
+    class Counter {
+    public:
+        void add(uint32_t amount = 1) { value.fetch_add(amount, std::memory_order_relaxed); }
+        uint32_t get() const { return value.load(std::memory_order_relaxed); }
+
+    private:
+        friend class MetricsRegistry;
+        std::atomic<uint32_t> value{0};
+        char name[NAME_LENGTH] = {};
+    };
+
+    // 출력할 때마다 값을 읽어 오는 게이지용 함수
+    using Sampler = int32_t (*)(void* context);
+
+    class Gauge {
+    public:
+        void set(int32_t newValue) { value.store(newValue, std::memory_order_relaxed); }
+        int32_t get() const { return value.load(std::memory_order_relaxed); }
+
+    private:
+        friend class MetricsRegistry;
+        std::atomic<int32_t> value{0};
+        Sampler sampler = nullptr;
+        void* context = nullptr;
+        char name[NAME_LENGTH] = {};
+    };
+
+    class Histogram {
+    public:
+        void record(uint32_t value);
+
+        uint32_t getCount() const { return count; }
+        uint32_t getMax() const { return max; }
+        uint32_t getAverage() const { return count ? uint32_t(sum / count) : 0; }
+        // 백분위수 근사 (percent = 0~100). 그 순위가 들어 있는 구간의 상한, 최대값을 넘지 않음
+        uint32_t percentile(uint8_t percent) const;
+
+    private:
+        friend class MetricsRegistry;
+        uint32_t buckets[BUCKETS] = {};
+        uint32_t count = 0;
+        uint64_t sum = 0;
+        uint32_t max = 0;
+        portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+        char name[NAME_LENGTH] = {};
+
+        void reset();
+    };
+
+    // 이름으로 지표 얻기 (없으면 등록). 반환한 참조는 계속 유효하다
+    Counter& counter(const char* name);
+    Gauge& gauge(const char* name);
+    Gauge& gauge(const char* name, Sampler sampler, void* context = nullptr);
+    Histogram& histogram(const char* name);
+
+    // 태스크 스택 high-water mark(바이트)를 stack.<name> 게이지로 내보낸다
+    bool watchTask(const char* name, TaskHandle_t handle);
+
+    // 전체 표 ("stats" 명령)
+    void printStats(Print& out);
+    // 한 줄 요약 (스트리밍 모드): "[stats] t=12.345 name=value ... hist=count/p50/p99/max"
+    void printSnapshot(Print& out);
+
+    // 히스토그램만 비우기 (부하 구간을 새로 재고 싶을 때)
+    void resetHistograms();
+
+private:
+    // 생성자/소멸자 private로 선언하여 싱글톤 패턴 유지
+    MetricsRegistry();
+    ~MetricsRegistry() = default;
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    Counter counters[MAX_COUNTERS];
+    Gauge gauges[MAX_GAUGES];
+    Histogram histograms[MAX_HISTOGRAMS];
+    uint8_t counterCount = 0;
+    uint8_t gaugeCount = 0;
+    uint8_t histogramCount = 0;
+
+    // 자리가 없을 때 돌려주는 예비 지표 (출력하지 않음)
+    Counter spareCounter;
+    Gauge spareGauge;
+    Histogram spareHistogram;
+
+    portMUX_TYPE tableLock = portMUX_INITIALIZER_UNLOCKED;
+
+    void sampleGauges();
+};
+
+// 전역 인스턴스 참조
+inline MetricsRegistry& Metrics = MetricsRegistry::getInstance();
+
+#endif
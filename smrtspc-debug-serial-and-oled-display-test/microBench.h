@@ -0,0 +1,75 @@
+#ifndef MICRO_BENCH_H
+#define MICRO_BENCH_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <stdint.h>
+#ifdef SIM_HOST
+#include <chrono>
+#endif
+
+// 작은 연산을 N번 반복해서 재고 결과를 CSV 한 줄로 출력하는 마이크로 벤치마크.
+//  - 반복 한 번마다 사이클 카운터로 재서 최소/평균/최대를 낸다. 인터럽트나 다른 태스크가
+//    끼어든 반복은 최대값만 키우므로 비교에는 최소값이 가장 안정적이다.
+//  - 전체 반복 시간은 esp_timer로 따로 잰다 (I2C 대기처럼 CPU가 놀고 있는 시간 포함).
+//  - 실행 전후의 빈 힙과 최저 빈 힙(low-water mark)을 기록한다.
+// 첫 호출 한 번은 캐시/지연 초기화를 빼기 위해 측정하지 않는다.
+//
+// 호스트 시뮬레이션(sim/, SIM_HOST)에서는 사이클 대신 호스트 시간(ns)을 재고,
+// esp_timer는 가상 시계라 I2C 전송 시간만 반영된다. 단위는 tick_unit 열에 적는다.
+//
+// CSV 열: name,iterations,ticks_min,ticks_avg,ticks_max,tick_unit,timer_ns_per_op,heap_before,heap_after,heap_min
+class MicroBench {
+public:
+    explicit MicroBench(Print& out) : out(out) {}
+
+    void printHeader() {
+        out.println("name,iterations,ticks_min,ticks_avg,ticks_max,tick_unit,timer_ns_per_op,"
+                    "heap_before,heap_after,heap_min");
+    }
+
+    // fn(i)를 iterations번 호출 (i = 0 ~ iterations-1)
+    template <typename Fn>
+    void run(const char* name, uint32_t iterations, Fn&& fn) {
+        if (iterations == 0) return;
+        fn(uint32_t(0));  // 준비 호출 (측정 제외)
+
+        const uint32_t heapBefore = ESP.getFreeHeap();
+        uint32_t minTicks = UINT32_MAX;
+        uint32_t maxTicks = 0;
+        uint64_t totalTicks = 0;
+
+        const int64_t start = esp_timer_get_time();
+        for (uint32_t i = 0; i < iterations; i++) {
+            const uint32_t begin = ticks();
+            fn(i);
+            const uint32_t elapsed = ticks() - begin;
+            totalTicks += elapsed;
+            if (elapsed < minTicks) minTicks = elapsed;
+            if (elapsed > maxTicks) maxTicks = elapsed;
+        }
+        const int64_t elapsedMicros = esp_timer_get_time() - start;
+
+        out.printf("%s,%lu,%lu,%lu,%lu,%s,%lu,%lu,%lu,%lu\n", name, (unsigned long)iterations,
+                   (unsigned long)minTicks, (unsigned long)(totalTicks / iterations), (unsigned long)maxTicks,
+                   tickUnit(), (unsigned long)(elapsedMicros * 1000 / iterations), (unsigned long)heapBefore,
+                   (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap());
+    }
+
+private:
+    Print& out;
+
+#ifdef SIM_HOST
+    static uint32_t ticks() {
+        return uint32_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+    static const char* tickUnit() { return "ns"; }
+#else
+    // 160 MHz에서 약 26초마다 한 바퀴 돌지만 반복 한 번의 차이는 부호 없는 뺄셈으로 맞다
+    static uint32_t ticks() { return ESP.getCycleCount(); }
+    static const char* tickUnit() { return "cycles"; }
+#endif
+};
+
+#endif
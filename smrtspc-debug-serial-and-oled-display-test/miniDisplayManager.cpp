@@ -4,8 +4,6 @@
 // Initialize static member variables
 constexpr int DisplayManager::width;
 constexpr int DisplayManager::height;
-constexpr int DisplayManager::xOffset;
-constexpr int DisplayManager::yOffset;
 
 // Font definitions
 static const uint8_t* FONT_SMALL_FONT = u8g2_font_6x10_tf;       // 6x10 픽셀 폰트 (더 작음)
@@ -24,7 +22,7 @@ void DisplayManager::begin() {
     
     // Configure display
     u8g2.setContrast(150);
-    u8g2.setBusClock(100000);  // 100kHz I2C clock
+    u8g2.setBusClock(400000);  // 400kHz, 화면 전송에만 적용 (I2cBus가 장치별로 클럭 전환)
     u8g2.setFontMode(1);       // Transparent mode
     
     // Apply default font
@@ -38,15 +36,18 @@ void DisplayManager::begin() {
 }
 
 void DisplayManager::clear() {
-    u8g2.clearBuffer();
-    u8g2.setDrawColor(1);
-    u8g2.drawBox(0, 0, 128, 64);
-    u8g2.setDrawColor(0);
-    u8g2.sendBuffer();
+    prepareFrame();
+    update();
 }
 
 void DisplayManager::update() {
-    u8g2.sendBuffer();
+    uint32_t start = micros();
+    flusher.submit(u8g2.getU8x8(), u8g2.getBufferPtr());
+    lastUpdateMicros = micros() - start;
+}
+
+bool DisplayManager::beginAsync(UBaseType_t priority) {
+    return flusher.beginAsync(u8g2.getU8x8(), priority);
 }
 
 void DisplayManager::setFont(FontSize size) {
@@ -59,7 +60,7 @@ void DisplayManager::setFont(FontSize size) {
 void DisplayManager::print(const char* text, int x, int y, TextAlign align) {
     if (!text) return;
     
-    int drawX = xOffset + x;
+    int drawX = x;
     if (align != ALIGN_LEFT) {
         int textWidth = getTextWidth(text);
         if (align == ALIGN_CENTER) {
@@ -69,8 +70,7 @@ void DisplayManager::print(const char* text, int x, int y, TextAlign align) {
         }
     }
     
-    u8g2.setCursor(drawX, yOffset + y + getFontHeight() - 2);
-    u8g2.print(text);
+    textCache.drawStr(u8g2, drawX, y + getFontHeight() - 2, text);
 }
 
 void DisplayManager::printCenter(const char* text, int y) {
@@ -81,34 +81,52 @@ void DisplayManager::printRight(const char* text, int y) {
     print(text, width, y, ALIGN_RIGHT);
 }
 
-void DisplayManager::displayText(const std::vector<std::string>& lines, TextAlign align) {
-    if (lines.empty()) return;
+void DisplayManager::displayText(const char* const* lines, size_t count, TextAlign align) {
+    // Null entries are skipped and do not take up a line
+    size_t lineCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (lines[i]) lineCount++;
+    }
+    if (lineCount == 0) return;
     
-    clear();
+    prepareFrame();
     
     int fontHeight = getFontHeight();
     int lineSpacing = 1;  // Reduced from 2px to 1px for better fit
-    int totalTextHeight = (fontHeight * lines.size()) + (lineSpacing * (lines.size() - 1));
+    int totalTextHeight = (fontHeight * lineCount) + (lineSpacing * (lineCount - 1));
     int startY = (height - totalTextHeight) / 2 + fontHeight - 2;  // Adjusted for better vertical centering
     
     // For 4 lines, adjust the starting position to prevent top/bottom cutoff
-    if (lines.size() == 4) {
+    if (lineCount == 4) {
         // 더 작은 폰트를 사용하므로 여백을 더 줄일 수 있음
         startY = 1;
     }
     
-    for (size_t i = 0; i < lines.size(); i++) {
-        int y = startY + (i * (fontHeight + lineSpacing));
-        print(lines[i].c_str(), 0, y, align);
+    size_t line = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (!lines[i]) continue;
+        int y = startY + (line * (fontHeight + lineSpacing));
+        print(lines[i], 0, y, align);
+        line++;
     }
     
     update();
 }
 
+void DisplayManager::displayText(const std::vector<std::string>& lines, TextAlign align) {
+    // Compatibility overload: borrows the strings' buffers, no copies
+    const char* ptrs[maxLines];
+    size_t count = lines.size() < maxLines ? lines.size() : maxLines;
+    for (size_t i = 0; i < count; i++) {
+        ptrs[i] = lines[i].c_str();
+    }
+    displayText(ptrs, count, align);
+}
+
 void DisplayManager::display2Lines(const char* line1, const char* line2, TextAlign align) {
     if (!line1 && !line2) return;
     
-    clear();
+    prepareFrame();
     
     int fontHeight = getFontHeight();
     int lineSpacing = 1;
@@ -129,36 +147,51 @@ void DisplayManager::display2Lines(const char* line1, const char* line2, TextAli
 
 void DisplayManager::display4Lines(const char* line1, const char* line2, 
                                  const char* line3, const char* line4, TextAlign align) {
-    std::vector<std::string> lines;
-    if (line1) lines.push_back(line1);
-    if (line2) lines.push_back(line2);
-    if (line3) lines.push_back(line3);
-    if (line4) lines.push_back(line4);
+    const char* lines[] = {line1, line2, line3, line4};
     displayText(lines, align);
 }
 
 // Graphics functions
 void DisplayManager::drawFrame(int x, int y, int w, int h) {
-    u8g2.drawFrame(xOffset + x, yOffset + y, w, h);
+    u8g2.drawFrame(x, y, w, h);
 }
 
 void DisplayManager::drawRect(int x, int y, int w, int h, bool filled) {
     if (filled) {
-        u8g2.drawBox(xOffset + x, yOffset + y, w, h);
+        u8g2.drawBox(x, y, w, h);
     } else {
-        u8g2.drawFrame(xOffset + x, yOffset + y, w, h);
+        u8g2.drawFrame(x, y, w, h);
     }
 }
 
 void DisplayManager::drawHLine(int x, int y, int w) {
-    u8g2.drawHLine(xOffset + x, yOffset + y, w);
+    u8g2.drawHLine(x, y, w);
 }
 
 void DisplayManager::drawVLine(int x, int y, int h) {
-    u8g2.drawVLine(xOffset + x, yOffset + y, h);
+    u8g2.drawVLine(x, y, h);
+}
+
+void DisplayManager::drawLine(int x0, int y0, int x1, int y1) {
+    u8g2.drawLine(x0, y0, x1, y1);
+}
+
+void DisplayManager::clearRect(int x, int y, int w, int h) {
+    u8g2.setDrawColor(1);
+    u8g2.drawBox(x, y, w, h);
+    u8g2.setDrawColor(0);
 }
 
 // Helper functions
+// Reset the buffer to the white background without sending it; the caller's
+// update() then flushes the finished frame once instead of twice
+void DisplayManager::prepareFrame() {
+    u8g2.clearBuffer();
+    u8g2.setDrawColor(1);
+    u8g2.drawBox(0, 0, width, height);
+    u8g2.setDrawColor(0);
+}
+
 void DisplayManager::applyFont() {
     switch (currentFontSize) {
         case FONT_SMALL:  u8g2.setFont(FONT_SMALL_FONT); break;
@@ -168,7 +201,7 @@ void DisplayManager::applyFont() {
 }
 
 int DisplayManager::getTextWidth(const char* text) {
-    return text ? u8g2.getStrWidth(text) : 0;
+    return text ? textCache.getWidth(u8g2, text) : 0;
 }
 
 int DisplayManager::getFontHeight() {
@@ -2,6 +2,9 @@
 #define MINI_DISPLAY_MANAGER_H
 
 #include <U8g2lib.h>
+#include "frameFlusher.h"
+#include "oledPanel.h"
+#include "textRunCache.h"
 #include <vector>
 #include <string>
 
@@ -21,6 +24,9 @@ enum FontSize {
 
 class DisplayManager {
 public:
+    // Panel geometry (swap for Ssd1306Panel128x64 on a 0.96" module)
+    using Panel = Ssd1306Panel72x40;
+
     // Singleton instance
     static DisplayManager& getInstance() {
         static DisplayManager instance;
@@ -31,6 +37,9 @@ public:
     void begin();
     void clear();
     void update();
+
+    // Hand flushing to a background task so update() returns immediately (call after begin())
+    bool beginAsync(UBaseType_t priority = 1);
     
     // Text display functions
     void setFont(FontSize size);
@@ -38,7 +47,13 @@ public:
     void printCenter(const char* text, int y);
     void printRight(const char* text, int y);
     
-    // Multi-line display
+    // Multi-line display (allocation-free; null entries are skipped)
+    static constexpr size_t maxLines = 8;
+    void displayText(const char* const* lines, size_t count, TextAlign align = ALIGN_LEFT);
+    template <size_t N>
+    void displayText(const char* const (&lines)[N], TextAlign align = ALIGN_LEFT) {
+        displayText(lines, N, align);
+    }
     void displayText(const std::vector<std::string>& lines, TextAlign align = ALIGN_LEFT);
     void display2Lines(const char* line1, const char* line2, TextAlign align = ALIGN_LEFT);
     void display4Lines(const char* line1, const char* line2 = "", 
@@ -50,26 +65,45 @@ public:
     void drawRect(int x, int y, int w, int h, bool filled = false);
     void drawHLine(int x, int y, int w);
     void drawVLine(int x, int y, int h);
+    void drawLine(int x0, int y0, int x1, int y1);
+
+    // Restore the background in a region (for redrawing one area of the frame)
+    void clearRect(int x, int y, int w, int h);
     
     // Display properties
-    static constexpr int width = 72;
-    static constexpr int height = 40;
-    static constexpr int xOffset = 28;
-    static constexpr int yOffset = 24;
+    static constexpr int width = Panel::width;
+    static constexpr int height = Panel::height;
     
     // Get text width for the current font
     int getTextWidth(const char* text);
     int getFontHeight();
 
+    // Bytes sent over I2C by the last update (full frame = Panel buffer size)
+    size_t getLastFlushBytes() const { return flusher.getLastFlushBytes(); }
+
+    // Time the caller spent blocked in the last update(), in microseconds
+    uint32_t getLastUpdateMicros() const { return lastUpdateMicros; }
+
+    // Frames merged because the flush task was still busy (async mode only)
+    uint32_t getCoalescedFrames() const { return flusher.getCoalescedFrames(); }
+
+    // Text run cache counters, for sizing the cache
+    uint32_t getTextCacheHits() const { return textCache.getHits(); }
+    uint32_t getTextCacheMisses() const { return textCache.getMisses(); }
+
 private:
     DisplayManager();
     ~DisplayManager() = default;
     DisplayManager(const DisplayManager&) = delete;
     DisplayManager& operator=(const DisplayManager&) = delete;
     
-    U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2;
+    Panel u8g2;  // Framebuffer sized to the visible glass
+    FrameFlusher<Panel::tileWidth, Panel::tileHeight> flusher;  // Sends only changed tiles
+    TextRunCache<width> textCache;  // Widths and glyph strips of recently drawn strings
     FontSize currentFontSize;
+    uint32_t lastUpdateMicros = 0;
     
+    void prepareFrame();
     void applyFont();
     int calculateAlignedX(const char* text, int x, int maxWidth, TextAlign align);
 };
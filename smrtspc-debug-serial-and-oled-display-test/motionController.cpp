@@ -0,0 +1,104 @@
+#include "motionController.h"
+
+bool MotionController::begin(uint16_t rateHz, UBaseType_t priority, const MotionPlanner::Config& config) {
+    if (task) return true;
+
+    periodMs = rateHz ? 1000 / rateHz : 20;
+    if (periodMs == 0) periodMs = 1;
+    planner.setConfig(config);
+
+    if (xTaskCreate(taskEntry, "Motion", 3072, this, priority, &task) != pdPASS) {
+        task = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool MotionController::line(int16_t speed, uint16_t durationMs) {
+    return enqueue({MotionPlanner::Kind::LINE, speed, 0, durationMs});
+}
+
+bool MotionController::arc(int16_t speed, int16_t radiusMm, uint16_t durationMs) {
+    return enqueue({MotionPlanner::Kind::ARC, speed, radiusMm, durationMs});
+}
+
+bool MotionController::spin(int16_t speed, uint16_t durationMs) {
+    return enqueue({MotionPlanner::Kind::SPIN, speed, 0, durationMs});
+}
+
+bool MotionController::pause(uint16_t durationMs) {
+    return enqueue({MotionPlanner::Kind::PAUSE, 0, 0, durationMs});
+}
+
+void MotionController::stop() {
+    portENTER_CRITICAL(&lock);
+    planner.stop();
+    portEXIT_CRITICAL(&lock);
+}
+
+void MotionController::halt() {
+    portENTER_CRITICAL(&lock);
+    planner.halt();
+    portEXIT_CRITICAL(&lock);
+    // 다음 제어 주기를 기다리지 않고 바로 정지
+    Maqueen.setWheelSpeeds(0, 0);
+}
+
+bool MotionController::isIdle() {
+    portENTER_CRITICAL(&lock);
+    bool idle = planner.isIdle();
+    portEXIT_CRITICAL(&lock);
+    return idle;
+}
+
+uint8_t MotionController::getQueuedCount() {
+    portENTER_CRITICAL(&lock);
+    uint8_t count = planner.getQueuedCount();
+    portEXIT_CRITICAL(&lock);
+    return count;
+}
+
+MotionPlanner::WheelSpeeds MotionController::getSpeeds() {
+    portENTER_CRITICAL(&lock);
+    MotionPlanner::WheelSpeeds speeds = planner.getSpeeds();
+    portEXIT_CRITICAL(&lock);
+    return speeds;
+}
+
+bool MotionController::enqueue(const MotionPlanner::Segment& segment) {
+    portENTER_CRITICAL(&lock);
+    bool queued = planner.enqueue(segment);
+    portEXIT_CRITICAL(&lock);
+    return queued;
+}
+
+void MotionController::taskEntry(void* arg) {
+    static_cast<MotionController*>(arg)->run();
+}
+
+// I2C 전송은 임계 구역 밖에서 한다.
+void MotionController::update() {
+    portENTER_CRITICAL(&lock);
+    MotionPlanner::WheelSpeeds speeds = planner.step(periodMs);
+    portEXIT_CRITICAL(&lock);
+
+    if (sentValid && speeds == sent) return;
+    if (Maqueen.setWheelSpeeds(speeds.left, speeds.right)) {
+        sent = speeds;
+        sentValid = true;
+    } else {
+        commandFailures++;
+        sentValid = false;  // 다음 주기에 다시 보낸다
+    }
+}
+
+// 고정 주기 제어 루프
+void MotionController::run() {
+    TickType_t lastWake = xTaskGetTickCount();
+    const TickType_t period = pdMS_TO_TICKS(periodMs) ? pdMS_TO_TICKS(periodMs) : 1;
+
+    while (true) {
+        vTaskDelayUntil(&lastWake, period);
+        update();
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef MOTION_CONTROLLER_H
+#define MOTION_CONTROLLER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "motionPlanner.h"
+#include "maqueenWheelManager.h"
+
+// 전용 태스크가 고정 주기(기본 50 Hz)로 MotionPlanner를 진행시키고 바퀴 속도를 Maqueen에 보낸다.
+// line()/arc()/spin()/pause()는 구간을 큐에 넣고 바로 반환하므로 loop()에서 delay()로
+// 동작 순서를 맞출 필요가 없다. Maqueen.begin() 이후에 begin()을 호출할 것.
+//
+// 개루프(open-loop) 제어다: Maqueen 모터 보드에는 바퀴 엔코더가 없어 실제 바퀴 속도를 읽을 수 없으므로
+// 명령 속도만 가속도 한계 안에서 바꾼다. 램프, 회전 반경(좌우 속도 비), 정지 시간은 명령 기준으로
+// 정확하지만 실제 이동/정지 거리는 바닥, 배터리 전압, 바퀴 미끄러짐에 따라 달라진다.
+class MotionController {
+public:
+    // 싱글톤 인스턴스 반환
+    static MotionController& getInstance() {
+        static MotionController instance;
+        return instance;
+    }
+
+    // 제어 태스크 시작
+    bool begin(uint16_t rateHz = 50, UBaseType_t priority = 3,
+               const MotionPlanner::Config& config = MotionPlanner::Config());
+
+    // 주행 구간 추가 (속도는 PWM -255 ~ 255, 시간은 가감속 포함). 큐가 가득 차면 false
+    bool line(int16_t speed, uint16_t durationMs);
+    bool arc(int16_t speed, int16_t radiusMm, uint16_t durationMs);
+    bool spin(int16_t speed, uint16_t durationMs);
+    bool pause(uint16_t durationMs);
+
+    // 대기 중인 구간을 취소하고 감속 정지
+    void stop();
+
+    // 즉시 정지 (비상 정지)
+    void halt();
+
+    bool isIdle();
+    uint8_t getQueuedCount();
+    MotionPlanner::WheelSpeeds getSpeeds();
+
+    // 모터 명령 전송 실패 횟수 (재시도까지 실패한 주기)
+    uint32_t getCommandFailures() const { return commandFailures; }
+
+    // 제어 한 주기: 계획기를 한 주기 진행하고 바뀐 속도만 보낸다. 제어 태스크가 주기마다 부르며,
+    // 태스크가 돌지 않는 호스트 시뮬레이션에서는 getPeriodMs()마다 직접 부른다
+    void update();
+    uint32_t getPeriodMs() const { return periodMs; }
+
+private:
+    // 생성자/소멸자 private로 선언하여 싱글톤 패턴 유지
+    MotionController() = default;
+    ~MotionController() = default;
+    MotionController(const MotionController&) = delete;
+    MotionController& operator=(const MotionController&) = delete;
+
+    MotionPlanner planner;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    TaskHandle_t task = nullptr;
+    uint32_t periodMs = 20;
+    volatile uint32_t commandFailures = 0;
+
+    // 마지막으로 보낸 속도 (제어 주기에서만 사용)
+    MotionPlanner::WheelSpeeds sent = {0, 0};
+    bool sentValid = false;
+
+    bool enqueue(const MotionPlanner::Segment& segment);
+    void run();
+    static void taskEntry(void* arg);
+};
+
+// 전역 인스턴스 참조
+inline MotionController& Motion = MotionController::getInstance();
+
+#endif
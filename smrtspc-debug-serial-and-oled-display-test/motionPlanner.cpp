@@ -0,0 +1,107 @@
+#include "motionPlanner.h"
+
+namespace {
+
+int16_t clampSpeed(int32_t speed) {
+    if (speed > 255) return 255;
+    if (speed < -255) return -255;
+    return int16_t(speed);
+}
+
+int32_t absolute(int32_t value) {
+    return value < 0 ? -value : value;
+}
+
+}  // namespace
+
+bool MotionPlanner::enqueue(const Segment& segment) {
+    if (count >= queueCapacity || segment.durationMs == 0) return false;
+    queue[(head + count) % queueCapacity] = segment;
+    count++;
+    return true;
+}
+
+void MotionPlanner::stop() {
+    head = 0;
+    count = 0;
+    active = false;
+}
+
+void MotionPlanner::halt() {
+    stop();
+    left = 0;
+    right = 0;
+}
+
+MotionPlanner::WheelSpeeds MotionPlanner::step(uint32_t dtMs) {
+    if (!active) startNext();
+
+    // 이번 주기는 주기가 시작될 때 실행 중인 구간의 목표로 램프한다
+    // (먼저 시간을 넘기면 구간마다 마지막 한 주기를 다음 구간 목표로 써서 구간이 한 주기 짧아진다)
+    const WheelSpeeds target = active ? targetFor(current) : WheelSpeeds{0, 0};
+
+    // 구간이 끝나면 남은 시간을 다음 구간으로 넘긴다
+    elapsedMs += dtMs;
+    while (active && elapsedMs >= current.durationMs) {
+        const uint32_t carry = elapsedMs - current.durationMs;
+        if (!startNext()) break;
+        elapsedMs = carry;
+    }
+
+    rampTowards(target, dtMs);
+    return getSpeeds();
+}
+
+uint32_t MotionPlanner::getStoppingTimeMs() const {
+    if (config.acceleration == 0) return 0;
+    const int32_t fastest = absolute(left) > absolute(right) ? absolute(left) : absolute(right);
+    return uint32_t(fastest) / config.acceleration;  // (PWM x 1000) / (PWM/s) = ms
+}
+
+MotionPlanner::WheelSpeeds MotionPlanner::targetFor(const Segment& segment) const {
+    switch (segment.kind) {
+        case Kind::LINE:
+            return {clampSpeed(segment.speed), clampSpeed(segment.speed)};
+        case Kind::SPIN:
+            return {clampSpeed(-segment.speed), clampSpeed(segment.speed)};
+        case Kind::ARC: {
+            if (segment.radiusMm == 0) return {clampSpeed(-segment.speed), clampSpeed(segment.speed)};
+            // 반경 R로 돌 때 안쪽/바깥쪽 바퀴 속도 = v * (R -/+ W/2) / R
+            const int32_t radius = segment.radiusMm;
+            const int32_t half = config.trackWidthMm / 2;
+            return {clampSpeed(int32_t(segment.speed) * (radius - half) / radius),
+                    clampSpeed(int32_t(segment.speed) * (radius + half) / radius)};
+        }
+        case Kind::PAUSE:
+        default:
+            return {0, 0};
+    }
+}
+
+bool MotionPlanner::startNext() {
+    active = count > 0;
+    elapsedMs = 0;
+    if (!active) return false;
+
+    current = queue[head];
+    head = (head + 1) % queueCapacity;
+    count--;
+    return true;
+}
+
+// 변화량이 큰 바퀴를 가속도 한계로 제한하고 다른 바퀴는 같은 비율로 움직여
+// 가감속 중에도 좌우 속도 비(= 회전 반경)가 유지되도록 한다
+void MotionPlanner::rampTowards(const WheelSpeeds& target, uint32_t dtMs) {
+    const int32_t deltaLeft = int32_t(target.left) * SCALE - left;
+    const int32_t deltaRight = int32_t(target.right) * SCALE - right;
+    const int32_t largest = absolute(deltaLeft) > absolute(deltaRight) ? absolute(deltaLeft) : absolute(deltaRight);
+    const int32_t limit = int32_t(config.acceleration) * int32_t(dtMs);
+
+    if (largest <= limit || config.acceleration == 0) {
+        left += deltaLeft;
+        right += deltaRight;
+        return;
+    }
+    left += int32_t(int64_t(deltaLeft) * limit / largest);
+    right += int32_t(int64_t(deltaRight) * limit / largest);
+}
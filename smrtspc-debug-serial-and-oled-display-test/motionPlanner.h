@@ -0,0 +1,97 @@
+#ifndef MOTION_PLANNER_H
+#define MOTION_PLANNER_H
+
+#include <stdint.h>
+
+// 시간 단위 주행 구간(직진, 반경 지정 회전, 제자리 회전, 정지)을 큐에 쌓고,
+// 제어 주기마다 가속도 제한(사다리꼴 속도 프로파일)을 적용한 좌우 바퀴 속도를 계산한다.
+// 하드웨어에 의존하지 않으므로 호스트에서 step()을 반복 호출하여 명령 흐름을 그대로 재현할 수 있다.
+//
+// 속도 단위는 모터 보드의 PWM 값(-255 ~ 255, 음수 = 후진), 가속도는 초당 PWM 변화량.
+// 바퀴 엔코더가 없으므로 되먹임 없이 명령 속도만 계획한다 (개루프).
+// 구간 시간은 가감속 시간을 포함한다. 큐가 비면 같은 가속도로 감속하여 정지한다.
+class MotionPlanner {
+public:
+    struct WheelSpeeds {
+        int16_t left;
+        int16_t right;
+
+        bool operator==(const WheelSpeeds& other) const {
+            return left == other.left && right == other.right;
+        }
+        bool operator!=(const WheelSpeeds& other) const { return !(*this == other); }
+    };
+
+    enum class Kind : uint8_t {
+        LINE,   // 직진/후진
+        ARC,    // 중심 속도 speed, 회전 반경 radiusMm (양수 = 왼쪽으로 휨)
+        SPIN,   // 제자리 회전 (speed 양수 = 반시계/왼쪽)
+        PAUSE   // 정지 유지
+    };
+
+    struct Segment {
+        Kind kind;
+        int16_t speed;
+        int16_t radiusMm;
+        uint16_t durationMs;
+    };
+
+    struct Config {
+        uint16_t acceleration = 400;   // 초당 PWM 변화량 (0 -> 200 까지 0.5초)
+        uint16_t trackWidthMm = 80;    // 좌우 바퀴 간격 (Maqueen)
+    };
+
+    static constexpr uint8_t queueCapacity = 16;
+
+    void setConfig(const Config& newConfig) { config = newConfig; }
+    const Config& getConfig() const { return config; }
+
+    // 구간 추가. 큐가 가득 차면 false
+    bool line(int16_t speed, uint16_t durationMs) { return enqueue({Kind::LINE, speed, 0, durationMs}); }
+    bool arc(int16_t speed, int16_t radiusMm, uint16_t durationMs) { return enqueue({Kind::ARC, speed, radiusMm, durationMs}); }
+    bool spin(int16_t speed, uint16_t durationMs) { return enqueue({Kind::SPIN, speed, 0, durationMs}); }
+    bool pause(uint16_t durationMs) { return enqueue({Kind::PAUSE, 0, 0, durationMs}); }
+    bool enqueue(const Segment& segment);
+
+    // 대기 중인 구간을 버리고 감속 정지
+    void stop();
+
+    // 즉시 정지 (가감속 없이 0)
+    void halt();
+
+    // dtMs 만큼 진행하고 이번 주기의 바퀴 속도를 반환
+    WheelSpeeds step(uint32_t dtMs);
+
+    WheelSpeeds getSpeeds() const { return {int16_t(left / SCALE), int16_t(right / SCALE)}; }
+
+    // 현재 속도에서 정지까지 걸리는 시간 (감속 구간 길이)
+    uint32_t getStoppingTimeMs() const;
+
+    // 실행 중인 구간도, 대기 중인 구간도 없고 바퀴가 멈춤
+    bool isIdle() const { return !active && count == 0 && left == 0 && right == 0; }
+
+    uint8_t getQueuedCount() const { return count; }
+
+    // 구간이 만드는 목표 바퀴 속도 (램프 적용 전)
+    WheelSpeeds targetFor(const Segment& segment) const;
+
+private:
+    static constexpr int32_t SCALE = 1000;  // 속도 내부 표현: PWM x 1000 (정수로 가속도 누적)
+
+    Config config = Config();
+    Segment queue[queueCapacity];
+    uint8_t head = 0;
+    uint8_t count = 0;
+
+    Segment current;
+    bool active = false;
+    uint32_t elapsedMs = 0;
+
+    int32_t left = 0;
+    int32_t right = 0;
+
+    bool startNext();
+    void rampTowards(const WheelSpeeds& target, uint32_t dtMs);
+};
+
+#endif
@@ -0,0 +1,529 @@
+#include "nvsIndex.h"
+#include <esp_rom_crc.h>
+#include <string.h>
+#include <algorithm>
+
+namespace {
+
+const uint8_t SNAPSHOT_MAGIC[4] = {'N', 'V', 'S', '1'};
+const size_t SNAPSHOT_HEADER = 8;
+const size_t SNAPSHOT_CRC = 4;
+
+// 정수 타입은 하위 4비트가 바이트 수 (U8=0x01, I16=0x12, U64=0x08 ...), 상위 비트가 부호
+uint8_t integerWidth(nvs_type_t type) { return uint8_t(type) & 0x0F; }
+bool isSigned(nvs_type_t type) { return (uint8_t(type) & 0xF0) == 0x10; }
+bool isKnownType(uint8_t type) {
+    switch (type) {
+        case NVS_TYPE_U8: case NVS_TYPE_I8: case NVS_TYPE_U16: case NVS_TYPE_I16:
+        case NVS_TYPE_U32: case NVS_TYPE_I32: case NVS_TYPE_U64: case NVS_TYPE_I64:
+        case NVS_TYPE_STR: case NVS_TYPE_BLOB:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// 리틀 엔디언 쓰기/읽기
+uint8_t* putLE(uint8_t* out, uint64_t value, uint8_t width) {
+    for (uint8_t i = 0; i < width; i++) *out++ = uint8_t(value >> (8 * i));
+    return out;
+}
+
+uint64_t getLE(const uint8_t* in, uint8_t width) {
+    uint64_t value = 0;
+    for (uint8_t i = 0; i < width; i++) value |= uint64_t(in[i]) << (8 * i);
+    return value;
+}
+
+// 스냅샷 엔트리 하나 (value는 스냅샷 버퍼 안을 가리킴)
+struct SnapshotEntry {
+    uint8_t ns;
+    nvs_type_t type;
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    const uint8_t* value;
+    uint32_t size;
+};
+
+// 엔트리 하나를 읽고 in을 다음 엔트리로 옮긴다. 형식이 맞지 않으면 false
+bool readSnapshotEntry(const uint8_t*& in, const uint8_t* end, uint8_t nsCount, SnapshotEntry& entry) {
+    if (end - in < 3) return false;
+    const uint8_t type = in[1];
+    const uint8_t keyLength = in[2];
+    entry.ns = in[0];
+    in += 3;
+    if (entry.ns >= nsCount || !isKnownType(type) || keyLength >= NVS_KEY_NAME_MAX_SIZE || end - in < keyLength) {
+        return false;
+    }
+    entry.type = nvs_type_t(type);
+    memcpy(entry.key, in, keyLength);
+    entry.key[keyLength] = '\0';
+    in += keyLength;
+
+    if (type == NVS_TYPE_STR || type == NVS_TYPE_BLOB) {
+        if (end - in < 4) return false;
+        entry.size = uint32_t(getLE(in, 4));
+        in += 4;
+    } else {
+        entry.size = integerWidth(entry.type);
+    }
+    if (uint32_t(end - in) < entry.size || (type == NVS_TYPE_STR && (entry.size == 0 || in[entry.size - 1] != '\0'))) {
+        return false;
+    }
+    entry.value = in;
+    in += entry.size;
+    return true;
+}
+
+// 정수 값 읽기 (타입에 맞는 nvs_get_* 하나만 호출)
+esp_err_t readInteger(nvs_handle_t handle, const char* key, nvs_type_t type, int64_t& value) {
+    esp_err_t err = ESP_ERR_NOT_SUPPORTED;
+    switch (type) {
+        case NVS_TYPE_U8:  { uint8_t v;  err = nvs_get_u8(handle, key, &v);  value = v; break; }
+        case NVS_TYPE_I8:  { int8_t v;   err = nvs_get_i8(handle, key, &v);  value = v; break; }
+        case NVS_TYPE_U16: { uint16_t v; err = nvs_get_u16(handle, key, &v); value = v; break; }
+        case NVS_TYPE_I16: { int16_t v;  err = nvs_get_i16(handle, key, &v); value = v; break; }
+        case NVS_TYPE_U32: { uint32_t v; err = nvs_get_u32(handle, key, &v); value = v; break; }
+        case NVS_TYPE_I32: { int32_t v;  err = nvs_get_i32(handle, key, &v); value = v; break; }
+        case NVS_TYPE_U64: { uint64_t v; err = nvs_get_u64(handle, key, &v); value = int64_t(v); break; }
+        case NVS_TYPE_I64: { int64_t v;  err = nvs_get_i64(handle, key, &v); value = v; break; }
+        default: break;
+    }
+    return err;
+}
+
+esp_err_t writeInteger(nvs_handle_t handle, const char* key, nvs_type_t type, uint64_t raw) {
+    switch (type) {
+        case NVS_TYPE_U8:  return nvs_set_u8(handle, key, uint8_t(raw));
+        case NVS_TYPE_I8:  return nvs_set_i8(handle, key, int8_t(raw));
+        case NVS_TYPE_U16: return nvs_set_u16(handle, key, uint16_t(raw));
+        case NVS_TYPE_I16: return nvs_set_i16(handle, key, int16_t(raw));
+        case NVS_TYPE_U32: return nvs_set_u32(handle, key, uint32_t(raw));
+        case NVS_TYPE_I32: return nvs_set_i32(handle, key, int32_t(raw));
+        case NVS_TYPE_U64: return nvs_set_u64(handle, key, raw);
+        case NVS_TYPE_I64: return nvs_set_i64(handle, key, int64_t(raw));
+        default:           return ESP_ERR_NOT_SUPPORTED;
+    }
+}
+
+}  // namespace
+
+void NvsIndex::clear() {
+    free(entries);
+    free(values);
+    free(slots);
+    entries = nullptr;
+    values = nullptr;
+    slots = nullptr;
+    count = capacity = 0;
+    valuesSize = valuesCapacity = 0;
+    namespaceCount = 0;
+    slotMask = 0;
+}
+
+bool NvsIndex::reserveEntry() {
+    if (count < capacity) return true;
+    if (capacity >= 0x7FFF) return false;  // 해시 표 번호가 uint16_t에 들어가도록
+    const uint16_t grown = capacity ? uint16_t(std::min(capacity * 2, 0x7FFF)) : 32;
+    Entry* resized = static_cast<Entry*>(realloc(entries, grown * sizeof(Entry)));
+    if (!resized) return false;
+    entries = resized;
+    capacity = grown;
+    return true;
+}
+
+bool NvsIndex::appendValue(uint32_t size, uint32_t& offset) {
+    if (valuesSize + size > valuesCapacity) {
+        uint32_t grown = valuesCapacity ? valuesCapacity : 512;
+        while (grown < valuesSize + size) grown *= 2;
+        uint8_t* resized = static_cast<uint8_t*>(realloc(values, grown));
+        if (!resized) return false;
+        values = resized;
+        valuesCapacity = grown;
+    }
+    offset = valuesSize;
+    valuesSize += size;
+    return true;
+}
+
+esp_err_t NvsIndex::scan(const char* partition) {
+    clear();
+
+    nvs_handle_t handles[MAX_NAMESPACES];
+    esp_err_t openResult[MAX_NAMESPACES];
+    esp_err_t result = ESP_OK;
+
+    nvs_iterator_t it = nullptr;
+    esp_err_t res = nvs_entry_find(partition, NULL, NVS_TYPE_ANY, &it);
+    // 파티션이 비어 있으면 NOT_FOUND (오류 아님)
+    if (res != ESP_OK && res != ESP_ERR_NVS_NOT_FOUND) return res;
+    while (res == ESP_OK) {
+        nvs_entry_info_t info;
+        nvs_entry_info(it, &info);
+        res = nvs_entry_next(&it);
+
+        // 네임스페이스 번호 찾기, 처음 보면 등록하고 핸들을 연다
+        uint8_t ns = 0;
+        while (ns < namespaceCount && strcmp(namespaces[ns], info.namespace_name) != 0) ns++;
+        if (ns == namespaceCount) {
+            if (namespaceCount >= MAX_NAMESPACES) {
+                result = ESP_ERR_NO_MEM;
+                continue;
+            }
+            memcpy(namespaces[ns], info.namespace_name, NVS_KEY_NAME_MAX_SIZE);
+            openResult[ns] = nvs_open_from_partition(partition, info.namespace_name, NVS_READONLY, &handles[ns]);
+            namespaceCount++;
+        }
+        if (openResult[ns] != ESP_OK) {
+            result = openResult[ns];
+            continue;
+        }
+        if (!reserveEntry()) {
+            result = ESP_ERR_NO_MEM;
+            continue;
+        }
+
+        Entry& entry = entries[count];
+        memcpy(entry.key, info.key, sizeof(entry.key));
+        entry.type = info.type;
+        entry.namespaceId = ns;
+
+        esp_err_t err;
+        if (info.type == NVS_TYPE_STR || info.type == NVS_TYPE_BLOB) {
+            size_t length = 0;
+            err = info.type == NVS_TYPE_STR ? nvs_get_str(handles[ns], info.key, NULL, &length)
+                                            : nvs_get_blob(handles[ns], info.key, NULL, &length);
+            uint32_t offset = 0;
+            if (err == ESP_OK && !appendValue(length, offset)) err = ESP_ERR_NO_MEM;
+            if (err == ESP_OK) {
+                err = info.type == NVS_TYPE_STR
+                          ? nvs_get_str(handles[ns], info.key, reinterpret_cast<char*>(values + offset), &length)
+                          : nvs_get_blob(handles[ns], info.key, values + offset, &length);
+                entry.offset = offset;
+                entry.size = length;
+                if (err != ESP_OK) valuesSize = offset;  // 읽지 못한 값 자리 되돌리기
+            }
+        } else {
+            entry.size = integerWidth(info.type);
+            err = readInteger(handles[ns], info.key, info.type, entry.signedValue);
+        }
+
+        if (err == ESP_OK) {
+            count++;
+        } else {
+            result = err;
+        }
+    }
+    nvs_release_iterator(it);
+
+    for (uint8_t ns = 0; ns < namespaceCount; ns++) {
+        if (openResult[ns] == ESP_OK) nvs_close(handles[ns]);
+    }
+
+    // 네임스페이스, 키 순으로 정렬 (목록 출력과 스냅샷이 네임스페이스별로 모이도록)
+    std::sort(entries, entries + count, [this](const Entry& a, const Entry& b) {
+        const int order = strcmp(namespaces[a.namespaceId], namespaces[b.namespaceId]);
+        return order != 0 ? order < 0 : strcmp(a.key, b.key) < 0;
+    });
+
+    if (!buildSlots()) return ESP_ERR_NO_MEM;
+    return result;
+}
+
+uint32_t NvsIndex::hash(const char* namespaceName, size_t namespaceLength, const char* key) {
+    // FNV-1a
+    uint32_t value = 2166136261u;
+    for (size_t i = 0; i < namespaceLength; i++) value = (value ^ uint8_t(namespaceName[i])) * 16777619u;
+    value = (value ^ 0) * 16777619u;
+    for (; *key; key++) value = (value ^ uint8_t(*key)) * 16777619u;
+    return value;
+}
+
+bool NvsIndex::buildSlots() {
+    free(slots);
+    slots = nullptr;
+    slotMask = 0;
+
+    // 채움 비율 50% 이하
+    uint32_t slotCount = 16;
+    while (slotCount < uint32_t(count) * 2) slotCount *= 2;
+    slots = static_cast<uint16_t*>(calloc(slotCount, sizeof(uint16_t)));
+    if (!slots) return false;
+    slotMask = uint16_t(slotCount - 1);
+
+    for (uint16_t i = 0; i < count; i++) {
+        const char* ns = namespaces[entries[i].namespaceId];
+        uint32_t slot = hash(ns, strlen(ns), entries[i].key) & slotMask;
+        while (slots[slot]) slot = (slot + 1) & slotMask;
+        slots[slot] = uint16_t(i + 1);
+    }
+    return true;
+}
+
+const NvsIndex::Entry* NvsIndex::find(const char* namespaceName, size_t namespaceLength, const char* key) const {
+    if (!slots) return nullptr;
+    uint32_t slot = hash(namespaceName, namespaceLength, key) & slotMask;
+    while (slots[slot]) {
+        const Entry& entry = entries[slots[slot] - 1];
+        const char* ns = namespaces[entry.namespaceId];
+        if (strncmp(ns, namespaceName, namespaceLength) == 0 && ns[namespaceLength] == '\0' &&
+            strcmp(entry.key, key) == 0) {
+            return &entry;
+        }
+        slot = (slot + 1) & slotMask;
+    }
+    return nullptr;
+}
+
+const NvsIndex::Entry* NvsIndex::find(const char* namespaceName, const char* key) const {
+    return find(namespaceName, strlen(namespaceName), key);
+}
+
+const NvsIndex::Entry* NvsIndex::find(const char* path) const {
+    for (const char* dot = strchr(path, '.'); dot; dot = strchr(dot + 1, '.')) {
+        const size_t namespaceLength = size_t(dot - path);
+        if (namespaceLength >= NVS_KEY_NAME_MAX_SIZE) break;
+        const Entry* entry = find(path, namespaceLength, dot + 1);
+        if (entry) return entry;
+    }
+    return nullptr;
+}
+
+const uint8_t* NvsIndex::data(const Entry& entry) const {
+    return isInteger(entry) ? nullptr : values + entry.offset;
+}
+
+const char* NvsIndex::typeName(nvs_type_t type) {
+    switch (type) {
+        case NVS_TYPE_U8:   return "uint8";
+        case NVS_TYPE_I8:   return "int8";
+        case NVS_TYPE_U16:  return "uint16";
+        case NVS_TYPE_I16:  return "int16";
+        case NVS_TYPE_U32:  return "uint32";
+        case NVS_TYPE_I32:  return "int32";
+        case NVS_TYPE_U64:  return "uint64";
+        case NVS_TYPE_I64:  return "int64";
+        case NVS_TYPE_STR:  return "string";
+        case NVS_TYPE_BLOB: return "blob";
+        default:            return "?";
+    }
+}
+
+void NvsIndex::printEntry(Print& out, const Entry& entry) const {
+    out.printf("  🔑 %-20s | 타입: %-6s | ", entry.key, typeName(entry.type));
+    if (entry.type == NVS_TYPE_STR) {
+        out.printf("값: %s\n", reinterpret_cast<const char*>(data(entry)));
+    } else if (entry.type == NVS_TYPE_BLOB) {
+        out.printf("크기: %lu bytes\n", (unsigned long)entry.size);
+    } else if (isSigned(entry.type)) {
+        out.printf("값: %lld\n", (long long)entry.signedValue);
+    } else {
+        out.printf("값: %llu\n", (unsigned long long)entry.unsignedValue);
+    }
+}
+
+void NvsIndex::printDetail(Print& out, const Entry& entry) const {
+    out.printf("📌 %s.%s (%s", namespaceOf(entry), entry.key, typeName(entry.type));
+    if (entry.type == NVS_TYPE_STR) {
+        out.printf("): %s\n", reinterpret_cast<const char*>(data(entry)));
+    } else if (entry.type == NVS_TYPE_BLOB) {
+        out.printf(", %lu bytes): ", (unsigned long)entry.size);
+        const uint8_t* bytes = data(entry);
+        for (uint32_t i = 0; i < entry.size && i < BLOB_PREVIEW_BYTES; i++) out.printf("%02X ", bytes[i]);
+        if (entry.size > BLOB_PREVIEW_BYTES) out.print("...");
+        out.println();
+    } else if (isSigned(entry.type)) {
+        out.printf("): %lld\n", (long long)entry.signedValue);
+    } else {
+        out.printf("): %llu\n", (unsigned long long)entry.unsignedValue);
+    }
+}
+
+void NvsIndex::printAll(Print& out) const {
+    out.println("\n📋 NVS 전체 내용 나열:");
+    out.println("========================");
+
+    uint16_t i = 0;
+    uint8_t printed = 0;
+    while (i < count) {
+        const uint8_t ns = entries[i].namespaceId;
+        if (printed++ > 0) out.println("------------------------");
+        out.printf("\n📁 네임스페이스: %s\n", namespaces[ns]);
+
+        const uint16_t first = i;
+        for (; i < count && entries[i].namespaceId == ns; i++) printEntry(out, entries[i]);
+        out.printf("  └── 총 %u개 엔트리\n", unsigned(i - first));
+    }
+
+    out.printf("\n✅ 총 %u개의 네임스페이스, %u개의 엔트리가 조회되었습니다. (문자열/blob %lu bytes)\n",
+               unsigned(printed), unsigned(count), (unsigned long)valuesSize);
+    out.println("========================");
+}
+
+uint8_t NvsIndex::mapNamespaces(const char* filter, uint8_t* remap) const {
+    uint8_t included = 0;
+    for (uint8_t ns = 0; ns < namespaceCount; ns++) {
+        remap[ns] = namespaceAllowed(filter, namespaces[ns]) ? included++ : NAMESPACE_EXCLUDED;
+    }
+    return included;
+}
+
+size_t NvsIndex::getSnapshotSize(const char* filter) const {
+    uint8_t remap[MAX_NAMESPACES];
+    mapNamespaces(filter, remap);
+
+    size_t size = SNAPSHOT_HEADER + SNAPSHOT_CRC;
+    for (uint8_t ns = 0; ns < namespaceCount; ns++) {
+        if (remap[ns] != NAMESPACE_EXCLUDED) size += 1 + strlen(namespaces[ns]);
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        if (remap[entries[i].namespaceId] == NAMESPACE_EXCLUDED) continue;
+        size += 3 + strlen(entries[i].key);
+        size += isInteger(entries[i]) ? entries[i].size : 4 + entries[i].size;
+    }
+    return size;
+}
+
+size_t NvsIndex::exportSnapshot(uint8_t* buffer, size_t size, const char* filter) const {
+    const size_t total = getSnapshotSize(filter);
+    if (!buffer || size < total) return 0;
+
+    // 남기는 네임스페이스만 0부터 다시 번호를 매긴다
+    uint8_t remap[MAX_NAMESPACES];
+    const uint8_t includedNamespaces = mapNamespaces(filter, remap);
+    uint16_t includedEntries = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        if (remap[entries[i].namespaceId] != NAMESPACE_EXCLUDED) includedEntries++;
+    }
+
+    uint8_t* out = buffer;
+    memcpy(out, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    out += sizeof(SNAPSHOT_MAGIC);
+    out = putLE(out, includedEntries, 2);
+    *out++ = includedNamespaces;
+    *out++ = 0;
+
+    for (uint8_t ns = 0; ns < namespaceCount; ns++) {
+        if (remap[ns] == NAMESPACE_EXCLUDED) continue;
+        const size_t length = strlen(namespaces[ns]);
+        *out++ = uint8_t(length);
+        memcpy(out, namespaces[ns], length);
+        out += length;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        const Entry& entry = entries[i];
+        if (remap[entry.namespaceId] == NAMESPACE_EXCLUDED) continue;
+        const size_t keyLength = strlen(entry.key);
+        *out++ = remap[entry.namespaceId];
+        *out++ = uint8_t(entry.type);
+        *out++ = uint8_t(keyLength);
+        memcpy(out, entry.key, keyLength);
+        out += keyLength;
+        if (isInteger(entry)) {
+            out = putLE(out, entry.unsignedValue, uint8_t(entry.size));
+        } else {
+            out = putLE(out, entry.size, 4);
+            memcpy(out, values + entry.offset, entry.size);
+            out += entry.size;
+        }
+    }
+
+    out = putLE(out, esp_rom_crc32_le(0, buffer, uint32_t(out - buffer)), 4);
+    return size_t(out - buffer);
+}
+
+esp_err_t NvsIndex::importSnapshot(const uint8_t* snapshot, size_t length, const char* partition,
+                                   uint16_t* written, const char* filter) {
+    if (written) *written = 0;
+    if (!snapshot || length < SNAPSHOT_HEADER + SNAPSHOT_CRC ||
+        memcmp(snapshot, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const size_t body = length - SNAPSHOT_CRC;
+    if (esp_rom_crc32_le(0, snapshot, uint32_t(body)) != uint32_t(getLE(snapshot + body, 4))) {
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    const uint16_t entryCount = uint16_t(getLE(snapshot + 4, 2));
+    const uint8_t nsCount = snapshot[6];
+    if (nsCount > MAX_NAMESPACES) return ESP_ERR_INVALID_SIZE;
+
+    const uint8_t* in = snapshot + SNAPSHOT_HEADER;
+    const uint8_t* end = snapshot + body;
+
+    char names[MAX_NAMESPACES][NVS_KEY_NAME_MAX_SIZE];
+    for (uint8_t ns = 0; ns < nsCount; ns++) {
+        if (in >= end || *in >= NVS_KEY_NAME_MAX_SIZE || end - in < 1 + *in) return ESP_ERR_INVALID_SIZE;
+        memcpy(names[ns], in + 1, *in);
+        names[ns][*in] = '\0';
+        in += 1 + *in;
+    }
+
+    // 1단계: 쓰기 전에 본문 전체를 검사한다 (중간에 형식 오류가 있으면 아무것도 쓰지 않음)
+    const uint8_t* const entriesStart = in;
+    SnapshotEntry entry;
+    for (uint16_t i = 0; i < entryCount; i++) {
+        if (!readSnapshotEntry(in, end, nsCount, entry)) return ESP_ERR_INVALID_SIZE;
+    }
+    if (in != end) return ESP_ERR_INVALID_SIZE;
+
+    // 2단계: 쓰기. 엔트리는 네임스페이스별로 모여 있으므로 네임스페이스가 바뀔 때만 열고 commit
+    in = entriesStart;
+    nvs_handle_t handle = 0;
+    int openNamespace = -1;
+    esp_err_t result = ESP_OK;
+    uint16_t stored = 0;
+
+    for (uint16_t i = 0; i < entryCount && result == ESP_OK; i++) {
+        readSnapshotEntry(in, end, nsCount, entry);
+        if (!namespaceAllowed(filter, names[entry.ns])) continue;
+
+        if (entry.ns != openNamespace) {
+            if (openNamespace >= 0) {
+                result = nvs_commit(handle);
+                nvs_close(handle);
+                openNamespace = -1;
+                if (result != ESP_OK) break;
+            }
+            result = nvs_open_from_partition(partition, names[entry.ns], NVS_READWRITE, &handle);
+            if (result != ESP_OK) break;
+            openNamespace = entry.ns;
+        }
+
+        if (entry.type == NVS_TYPE_STR) {
+            result = nvs_set_str(handle, entry.key, reinterpret_cast<const char*>(entry.value));
+        } else if (entry.type == NVS_TYPE_BLOB) {
+            result = nvs_set_blob(handle, entry.key, entry.value, entry.size);
+        } else {
+            result = writeInteger(handle, entry.key, entry.type, getLE(entry.value, uint8_t(entry.size)));
+        }
+        if (result == ESP_OK) stored++;
+    }
+
+    if (openNamespace >= 0) {
+        const esp_err_t committed = nvs_commit(handle);
+        if (result == ESP_OK) result = committed;
+        nvs_close(handle);
+    }
+    if (written) *written = stored;
+    return result;
+}
+
+bool NvsIndex::namespaceAllowed(const char* filter, const char* name) {
+    if (!filter || !*filter) return true;
+
+    const size_t nameLength = strlen(name);
+    bool hasInclude = false;
+    for (const char* item = filter; *item;) {
+        const char* comma = strchr(item, ',');
+        const size_t itemLength = comma ? size_t(comma - item) : strlen(item);
+        const bool exclude = *item == '-';
+        const size_t offset = exclude ? 1 : 0;
+        if (!exclude && itemLength > 0) hasInclude = true;
+        if (itemLength - offset == nameLength && memcmp(item + offset, name, nameLength) == 0) return !exclude;
+        item += itemLength;
+        if (*item == ',') item++;
+    }
+    // 목록에 없는 이름: 포함 목록이 있으면 제외, 제외 항목만 있으면 포함
+    return !hasInclude;
+}
@@ -0,0 +1,115 @@
+#ifndef NVS_INDEX_H
+#define NVS_INDEX_H
+
+#include <Arduino.h>
+#include <nvs.h>
+
+// NVS 파티션 전체를 한 번에 읽어 두는 색인.
+//  - scan()은 NVS 반복자(iterator)를 한 번만 돌면서 엔트리마다 타입을 기록하고 그 타입의 nvs_get_* 하나로
+//    값을 읽는다 (타입을 추측하며 여러 번 읽지 않음). 네임스페이스 핸들은 네임스페이스마다 한 번만 연다.
+//  - 정수 값은 엔트리 안에, 문자열/blob은 하나의 데이터 버퍼에 이어 붙여 보관한다.
+//  - find()는 "네임스페이스 + 키" 해시 표로 찾으므로 엔트리 수와 관계없이 O(1)이다 (플래시 접근 없음).
+//  - exportSnapshot()은 전체 내용을 작은 바이너리 스냅샷으로 만들고,
+//    importSnapshot()은 스냅샷 전체를 먼저 검사한 뒤 다른 보드의 NVS에 써 넣는다 (네임스페이스마다 commit 한 번).
+//  - 내보내기/가져오기 모두 네임스페이스 필터를 받는다. phy(RF 보정값)나 nvs.net80211(WiFi 드라이버 상태)처럼
+//    칩마다 다른 데이터를 다른 보드로 옮기지 않으려면 PER_CHIP_FILTER를 쓴다.
+//      필터 형식: "a,b" = a와 b만, "-a,-b" = a와 b를 뺀 전부, nullptr 또는 "" = 전부
+//
+// 스냅샷 형식 (리틀 엔디언):
+//   "NVS1" | 엔트리 수 u16 | 네임스페이스 수 u8 | 0
+//   네임스페이스 이름들: 길이 u8 + 문자
+//   엔트리들: 네임스페이스 번호 u8 | 타입 u8 | 키 길이 u8 + 키 | 값
+//             (정수는 타입 크기만큼, 문자열/blob은 길이 u32 + 바이트. 문자열 길이는 끝의 '\0' 포함)
+//   CRC32 u32 (앞의 모든 바이트)
+//
+// 스캔한 뒤에 바뀐 값은 반영되지 않으므로 값을 쓴 다음에는 scan()을 다시 호출한다.
+class NvsIndex {
+public:
+    static constexpr uint8_t MAX_NAMESPACES = 32;
+    static constexpr const char* PER_CHIP_FILTER = "-phy,-nvs.net80211";
+
+    struct Entry {
+        char key[NVS_KEY_NAME_MAX_SIZE];
+        nvs_type_t type;
+        uint8_t namespaceId;
+        uint32_t size;          // 값 바이트 수 (정수는 타입 크기, 문자열은 '\0' 포함)
+        union {
+            int64_t signedValue;
+            uint64_t unsignedValue;
+            uint32_t offset;    // 문자열/blob: 데이터 버퍼 안의 위치
+        };
+    };
+
+    NvsIndex() = default;
+    ~NvsIndex() { clear(); }
+    NvsIndex(const NvsIndex&) = delete;
+    NvsIndex& operator=(const NvsIndex&) = delete;
+
+    // 파티션 전체 읽기. 이전 내용은 버린다
+    esp_err_t scan(const char* partition = NVS_DEFAULT_PART_NAME);
+    void clear();
+
+    uint16_t getCount() const { return count; }
+    uint8_t getNamespaceCount() const { return namespaceCount; }
+    const Entry& at(uint16_t index) const { return entries[index]; }   // 네임스페이스, 키 순으로 정렬됨
+    const char* namespaceOf(const Entry& entry) const { return namespaces[entry.namespaceId]; }
+
+    // 값 찾기 (없으면 nullptr)
+    const Entry* find(const char* namespaceName, const char* key) const;
+    // "네임스페이스.키" 형식. 네임스페이스 이름에도 '.'이 있을 수 있어서 (nvs.net80211) 점 위치마다 시도한다
+    const Entry* find(const char* path) const;
+
+    // 문자열/blob 값의 바이트 (정수 타입이면 nullptr)
+    const uint8_t* data(const Entry& entry) const;
+    bool isInteger(const Entry& entry) const { return entry.type != NVS_TYPE_STR && entry.type != NVS_TYPE_BLOB; }
+
+    static const char* typeName(nvs_type_t type);
+
+    // 엔트리 한 줄 / 네임스페이스별 전체 목록 출력
+    void printEntry(Print& out, const Entry& entry) const;
+    void printAll(Print& out) const;
+    // 키 하나 자세히 ("📌 ns.key (타입): 값", blob은 앞 BLOB_PREVIEW_BYTES바이트를 16진수로)
+    void printDetail(Print& out, const Entry& entry) const;
+
+    static constexpr uint8_t BLOB_PREVIEW_BYTES = 32;
+
+    // 스냅샷 크기와 만들기 (filter에 맞는 네임스페이스만). buffer가 작으면 0
+    size_t getSnapshotSize(const char* filter = nullptr) const;
+    size_t exportSnapshot(uint8_t* buffer, size_t size, const char* filter = nullptr) const;
+
+    // 스냅샷에서 filter에 맞는 엔트리를 partition에 쓴다. CRC나 형식이 맞지 않으면 아무것도 쓰지 않는다.
+    // written에는 쓴 엔트리 수
+    static esp_err_t importSnapshot(const uint8_t* snapshot, size_t length,
+                                    const char* partition = NVS_DEFAULT_PART_NAME, uint16_t* written = nullptr,
+                                    const char* filter = nullptr);
+
+    // 네임스페이스 이름이 필터에 맞는지
+    static bool namespaceAllowed(const char* filter, const char* name);
+
+private:
+    Entry* entries = nullptr;
+    uint16_t count = 0;
+    uint16_t capacity = 0;
+
+    uint8_t* values = nullptr;      // 문자열/blob 데이터
+    uint32_t valuesSize = 0;
+    uint32_t valuesCapacity = 0;
+
+    char namespaces[MAX_NAMESPACES][NVS_KEY_NAME_MAX_SIZE];
+    uint8_t namespaceCount = 0;
+
+    uint16_t* slots = nullptr;      // 해시 표 (엔트리 번호 + 1, 0 = 빈 칸)
+    uint16_t slotMask = 0;
+
+    static constexpr uint8_t NAMESPACE_EXCLUDED = 0xFF;
+
+    // 필터에 맞는 네임스페이스의 새 번호(remap[ns], 제외면 NAMESPACE_EXCLUDED)와 개수
+    uint8_t mapNamespaces(const char* filter, uint8_t* remap) const;
+    static uint32_t hash(const char* namespaceName, size_t namespaceLength, const char* key);
+    const Entry* find(const char* namespaceName, size_t namespaceLength, const char* key) const;
+    bool reserveEntry();
+    bool appendValue(uint32_t size, uint32_t& offset);
+    bool buildSlots();
+};
+
+#endif
@@ -4,8 +4,6 @@
 // Initialize static member variables
 constexpr int DisplayManager::width;
 constexpr int DisplayManager::height;
-constexpr int DisplayManager::xOffset;
-constexpr int DisplayManager::yOffset;
 
 // Constructor
 DisplayManager::DisplayManager() 
@@ -25,24 +23,38 @@ void DisplayManager::begin() {
     
     // Set contrast and other parameters
     u8g2.setContrast(150);  // Reduced from 255 for better reliability
-    u8g2.setBusClock(100000);  // Reduced from 400kHz to 100kHz
+    u8g2.setBusClock(400000);  // Display clock only; I2cBus switches per device (motor board keeps its own)
     u8g2.setFont(u8g2_font_ncenB10_tr);
     
     // Optional: Add display clear and buffer reset
+    // Display RAM contents are unknown after power-up, so push the whole frame once
     u8g2.clearBuffer();
-    u8g2.sendBuffer();
+    flusher.invalidate();
+    flush();
     delay(10);
 }
 
+// Start the background flush task; later frames are queued instead of sent inline
+bool DisplayManager::beginAsync(UBaseType_t priority) {
+    return flusher.beginAsync(u8g2.getU8x8(), priority);
+}
+
 // Clear display
 void DisplayManager::clear() {
     u8g2.clearBuffer();
-    u8g2.sendBuffer();
+    flush();
+}
+
+// Send only the tiles that changed since the last flush
+void DisplayManager::flush() {
+    uint32_t start = micros();
+    flusher.submit(u8g2.getU8x8(), u8g2.getBufferPtr());
+    lastUpdateMicros = micros() - start;
 }
 
 // Draw frame
 void DisplayManager::drawFrame() {
-    u8g2.drawFrame(xOffset, yOffset, width, height);
+    u8g2.drawFrame(0, 0, width, height);
 }
 
 // Display 2 lines of text
@@ -51,7 +63,7 @@ void DisplayManager::display2Lines(const char* line1, const char* line2, TextAli
     
     // Fill background with white
     u8g2.setDrawColor(1);
-    u8g2.drawBox(0, 0, 128, 64);
+    u8g2.drawBox(0, 0, width, height);
     
     // Switch to black for text and frame
     u8g2.setDrawColor(0);
@@ -59,46 +71,47 @@ void DisplayManager::display2Lines(const char* line1, const char* line2, TextAli
     // Draw frame
     drawFrame();
     
+    // Default font (u8g2 skips the font header reload when it is already active)
+    u8g2.setFont(u8g2_font_ncenB10_tr);
+    
     // Text output settings
     int lineHeight = 15; // Line spacing
-    int textY = yOffset + (height - (lineHeight * 2)) / 2 + lineHeight - 2; // Vertical centering
+    int textY = (height - (lineHeight * 2)) / 2 + lineHeight - 2; // Vertical centering
     int textX;
     
     // First line
     if (line1 && strlen(line1)) {
         switch(align) {
             case ALIGN_CENTER:
-                textX = xOffset + (width - u8g2.getStrWidth(line1)) / 2;
+                textX = (width - textCache.getWidth(u8g2, line1)) / 2;
                 break;
             case ALIGN_RIGHT:
-                textX = xOffset + width - u8g2.getStrWidth(line1) - 2; // Right margin 2px
+                textX = width - textCache.getWidth(u8g2, line1) - 2; // Right margin 2px
                 break;
             case ALIGN_LEFT:
             default:
-                textX = xOffset + 2; // Left margin 2px
+                textX = 2; // Left margin 2px
         }
-        u8g2.setCursor(textX, textY - lineHeight/2);
-        u8g2.print(line1);
+        textCache.drawStr(u8g2, textX, textY - lineHeight/2, line1);
     }
     
     // Second line
     if (line2 && strlen(line2)) {
         switch(align) {
             case ALIGN_CENTER:
-                textX = xOffset + (width - u8g2.getStrWidth(line2)) / 2;
+                textX = (width - textCache.getWidth(u8g2, line2)) / 2;
                 break;
             case ALIGN_RIGHT:
-                textX = xOffset + width - u8g2.getStrWidth(line2) - 2; // Right margin 2px
+                textX = width - textCache.getWidth(u8g2, line2) - 2; // Right margin 2px
                 break;
             case ALIGN_LEFT:
             default:
-                textX = xOffset + 2; // Left margin 2px
+                textX = 2; // Left margin 2px
         }
-        u8g2.setCursor(textX, textY + lineHeight/2);
-        u8g2.print(line2);
+        textCache.drawStr(u8g2, textX, textY + lineHeight/2, line2);
     }
     
-    u8g2.sendBuffer();
+    flush();
 }
 
 void DisplayManager::display4Lines(const char* line1, const char* line2, const char* line3, const char* line4, TextAlign align) {
@@ -106,7 +119,7 @@ void DisplayManager::display4Lines(const char* line1, const char* line2, const c
     
     // Fill background with white
     u8g2.setDrawColor(1);
-    u8g2.drawBox(0, 0, 128, 64);
+    u8g2.drawBox(0, 0, width, height);
     
     // Switch to black for text and frame
     u8g2.setDrawColor(0);
@@ -121,7 +134,7 @@ void DisplayManager::display4Lines(const char* line1, const char* line2, const c
     int fontHeight = 8;      // Font height (pixels)
     int lineSpacing = 2;     // Line spacing (pixels)
     int totalTextHeight = (fontHeight + lineSpacing) * 4 - lineSpacing;  // Total text height
-    int startY = yOffset + (height - totalTextHeight) / 2;  // Starting Y position for vertical centering
+    int startY = (height - totalTextHeight) / 2;  // Starting Y position for vertical centering
     
     // Text output for each line
     const char* lines[4] = {line1, line2, line3, line4};
@@ -129,36 +142,33 @@ void DisplayManager::display4Lines(const char* line1, const char* line2, const c
     for (int i = 0; i < 4; i++) {
         if (lines[i] && strlen(lines[i])) {
             // Calculate text width (based on current font)
-            int textWidth = u8g2.getStrWidth(lines[i]);
+            int textWidth = textCache.getWidth(u8g2, lines[i]);
             
             // Calculate X position based on alignment
             int textX;
             switch(align) {
                 case ALIGN_CENTER:
-                    textX = xOffset + (width - textWidth) / 2;
+                    textX = (width - textWidth) / 2;
                     break;
                 case ALIGN_RIGHT:
-                    textX = xOffset + width - textWidth - 2; // Right margin 2px
+                    textX = width - textWidth - 2; // Right margin 2px
                     break;
                 case ALIGN_LEFT:
                 default:
-                    textX = xOffset + 2; // Left margin 2px
+                    textX = 2; // Left margin 2px
             }
             
             // Calculate Y position (fixed spacing)
             int textY = startY + (fontHeight + lineSpacing) * i + fontHeight - 1;
             
             // Ensure last line doesn't go outside the frame
-            if (textY > yOffset + height - 2) {
-                textY = yOffset + height - 2;
+            if (textY > height - 2) {
+                textY = height - 2;
             }
             
-            u8g2.setCursor(textX, textY);
-            u8g2.print(lines[i]);
+            textCache.drawStr(u8g2, textX, textY, lines[i]);
         }
     }
     
-    u8g2.sendBuffer();
-    // Restore default font
-    u8g2.setFont(u8g2_font_ncenB10_tr);
+    flush();
 }
@@ -3,12 +3,18 @@
 
 #include <U8g2lib.h>
 #include <Wire.h>
+#include "frameFlusher.h"
+#include "oledPanel.h"
+#include "textRunCache.h"
 
 // 텍스트 정렬 옵션
 enum TextAlign { ALIGN_LEFT, ALIGN_CENTER, ALIGN_RIGHT };
 
 class DisplayManager {
 public:
+    // 사용할 패널 (0.96" 128x64 모듈이면 Ssd1306Panel128x64 로 교체)
+    using Panel = Ssd1306Panel72x40;
+
     // 싱글톤 인스턴스 반환
     static DisplayManager& getInstance() {
         static DisplayManager instance;
@@ -18,6 +24,9 @@ public:
     // 초기화
     void begin();
 
+    // 비동기 전송 모드 시작 (begin() 이후 호출). 화면 갱신이 I2C 전송을 기다리지 않는다.
+    bool beginAsync(UBaseType_t priority = 1);
+
     // 2줄 텍스트 표시 함수
     void display2Lines(const char* line1, const char* line2, TextAlign align = ALIGN_LEFT);
     
@@ -26,12 +35,25 @@ public:
                       const char* line4 = "", TextAlign align = ALIGN_LEFT);
 
     // 화면 크기 접근자
-    static constexpr int width = 72;
-    static constexpr int height = 40;
+    static constexpr int width = Panel::width;
+    static constexpr int height = Panel::height;
 
     // 화면 지우기
     void clear();
 
+    // 마지막 화면 갱신에서 I2C로 전송한 바이트 수
+    size_t getLastFlushBytes() const { return flusher.getLastFlushBytes(); }
+
+    // 마지막 화면 갱신에서 호출한 쪽이 전송을 기다린 시간 (us)
+    uint32_t getLastUpdateMicros() const { return lastUpdateMicros; }
+
+    // 비동기 모드에서 전송이 밀려 합쳐진 프레임 수
+    uint32_t getCoalescedFrames() const { return flusher.getCoalescedFrames(); }
+
+    // 텍스트 캐시 적중/실패 횟수 (캐시 크기 조정용)
+    uint32_t getTextCacheHits() const { return textCache.getHits(); }
+    uint32_t getTextCacheMisses() const { return textCache.getMisses(); }
+
 private:
     // 생성자/소멸자 private로 선언하여 싱글톤 패턴 유지
     DisplayManager();
@@ -39,15 +61,21 @@ private:
     DisplayManager(const DisplayManager&) = delete;
     DisplayManager& operator=(const DisplayManager&) = delete;
 
-    // U8G2 인스턴스
-    U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2;
-    
-    // 화면 오프셋
-    static constexpr int xOffset = 28;  // = (132-width)/2 - 2 (왼쪽으로 2픽셀 이동)
-    static constexpr int yOffset = 24;  // = (64-height)/2 + 12 (아래로 10픽셀 이동)
+    // U8G2 인스턴스 (보이는 영역 크기의 버퍼, 컨트롤러 오프셋은 전송 시 적용)
+    Panel u8g2;
+
+    // 변경된 타일만 전송
+    FrameFlusher<Panel::tileWidth, Panel::tileHeight> flusher;
+    uint32_t lastUpdateMicros = 0;
+
+    // 반복해서 그리는 라벨의 폭과 비트맵 캐시
+    TextRunCache<width> textCache;
 
     // 프레임 그리기
     void drawFrame();
+
+    // 버퍼에서 변경된 부분만 디스플레이로 전송
+    void flush();
 };
 
 inline DisplayManager& Display = DisplayManager::getInstance();
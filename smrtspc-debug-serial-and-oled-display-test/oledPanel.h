@@ -0,0 +1,67 @@
+#ifndef OLED_PANEL_H
+#define OLED_PANEL_H
+
+#include <U8g2lib.h>
+#include "i2cBusManager.h"
+
+// SSD1306 컨트롤러(128x64 RAM)에 실제로 보이는 글라스 크기와 위치를 템플릿 인자로 받는 U8G2 패널.
+// 프레임 버퍼는 보이는 영역(Width x Height)만큼만 잡고, 컨트롤러 RAM 좌표로의 변환은
+// 타일을 전송하는 시점(DRAW_TILE)에만 한 번 적용한다. 그리기 좌표는 항상 (0,0) 기준.
+//
+//   0.42" 72x40 글라스  : OledPanel<72, 40, 28, 24>  -> 360 바이트 버퍼 (기존 1 KB)
+//   0.96" 128x64 모듈   : OledPanel<128, 64, 0, 0>
+//
+// I2C 전송은 I2cBusManager를 거치므로 모터 보드 등 같은 버스의 다른 장치와 안전하게 공유된다.
+template <int Width, int Height, int XOffset, int YOffset>
+class OledPanel : public U8G2 {
+public:
+    static constexpr int width = Width;
+    static constexpr int height = Height;
+    static constexpr uint8_t tileWidth = (Width + 7) / 8;
+    static constexpr uint8_t tileHeight = (Height + 7) / 8;
+
+    static_assert(XOffset + Width <= 128 && YOffset + Height <= 64, "panel must fit in SSD1306 RAM");
+    static_assert(YOffset % 8 == 0, "SSD1306 page addressing needs a page-aligned Y offset");
+
+    OledPanel(const u8g2_cb_t* rotation, uint8_t reset = U8X8_PIN_NONE,
+              uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE) : U8G2() {
+        u8g2_SetupDisplay(&u8g2, displayCallback, u8x8_cad_ssd13xx_fast_i2c,
+                          I2cBusManager::u8x8ByteCallback, u8x8_gpio_and_delay_arduino);
+        u8g2_SetupBuffer(&u8g2, buffer, tileHeight, u8g2_ll_hvline_vertical_top_lsb, rotation);
+        u8x8_SetPin_HW_I2C(getU8x8(), reset, clock, data);
+    }
+
+private:
+    uint8_t buffer[tileWidth * tileHeight * 8];
+
+    // 128x64 컨트롤러 정보를 복사한 뒤 보이는 영역 크기와 X 오프셋만 바꾼 것
+    inline static u8x8_display_info_t displayInfo;
+
+    // 초기화 시퀀스는 128x64 SSD1306 드라이버를 그대로 쓰고 메모리 설정과 타일 위치만 가로챈다
+    static uint8_t displayCallback(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+        if (msg == U8X8_MSG_DISPLAY_SETUP_MEMORY) {
+            u8x8_d_ssd1306_128x64_noname(u8x8, msg, arg_int, arg_ptr);
+            displayInfo = *u8x8->display_info;
+            displayInfo.tile_width = tileWidth;
+            displayInfo.tile_height = tileHeight;
+            displayInfo.pixel_width = Width;
+            displayInfo.pixel_height = Height;
+            displayInfo.default_x_offset += XOffset;
+            displayInfo.flipmode_x_offset += 128 - XOffset - Width;
+            u8x8_d_helper_display_setup_memory(u8x8, &displayInfo);
+            return 1;
+        }
+        if (msg == U8X8_MSG_DISPLAY_DRAW_TILE) {
+            u8x8_tile_t tile = *static_cast<u8x8_tile_t*>(arg_ptr);
+            tile.y_pos += YOffset / 8;
+            return u8x8_d_ssd1306_128x64_noname(u8x8, msg, arg_int, &tile);
+        }
+        return u8x8_d_ssd1306_128x64_noname(u8x8, msg, arg_int, arg_ptr);
+    }
+};
+
+// 보드별 패널 정의
+using Ssd1306Panel72x40 = OledPanel<72, 40, 28, 24>;    // ESP32-C3 Super Mini 0.42" OLED
+using Ssd1306Panel128x64 = OledPanel<128, 64, 0, 0>;   // 0.96" 128x64 OLED
+
+#endif
@@ -0,0 +1,69 @@
+#include "priceBoardView.h"
+#include "fixedFormat.h"
+
+void PriceBoardView::showPrices(const TickerSnapshot& prices) {
+    grid.clear();
+
+    const TickerQuote* stamped = nullptr;  // 갱신 시각을 표시할 시세 (첫 마켓)
+    uint8_t row = 0;
+    for (uint8_t i = 0; i < prices.count && row < PRICE_ROWS; i++) {
+        const TickerQuote& quote = prices.quotes[i];
+        if (!quote.valid) continue;
+        if (!stamped) stamped = &quote;
+
+        // 변동률에 따라 색상 설정 (0% 이상: 노란색, 0% 미만: 초록색, 종가 없음: 흰색)
+        const bool hasChange = quote.prevClose > 0;
+        const float change = quote.changePercent();
+        const uint16_t color = !hasChange ? ST77XX_WHITE : (change >= 0 ? ST77XX_YELLOW : ST77XX_GREEN);
+
+        // "BTC: " / "LINK:" + 11칸 가격 + " KRW " + "(+1.23%)"
+        char text[16];
+        uint8_t length = 0;
+        for (const char* symbol = quote.symbol(); *symbol && length < 4; symbol++) text[length++] = *symbol;
+        text[length++] = ':';
+        while (length < 5) text[length++] = ' ';
+        text[length] = '\0';
+        uint8_t column = grid.print(0, row, text, color);
+
+        formatGrouped(text, 11, int32_t(quote.price));
+        column = grid.print(column, row, text, color);
+        column = grid.print(column, row, " KRW ", color);
+
+        if (hasChange) {
+            const int32_t hundredths = int32_t(change * 100 + (change >= 0 ? 0.5f : -0.5f));
+            column = grid.print(column, row, "(", color);
+            formatHundredths(text, hundredths, true);
+            column = grid.print(column, row, text, color);
+            grid.print(column, row, "%)", color);
+        }
+        row++;
+    }
+
+    // API 응답의 거래일시 (이미 KST이므로 변환 없이 표시)
+    if (stamped) {
+        uint8_t column = grid.print(0, PRICE_ROWS, "Updated: ", ST77XX_WHITE);
+        column = grid.print(column, PRICE_ROWS, stamped->date, ST77XX_WHITE);
+        column = grid.print(column, PRICE_ROWS, " ", ST77XX_WHITE);
+        grid.print(column, PRICE_ROWS, stamped->time, ST77XX_WHITE);
+    }
+}
+
+void PriceBoardView::showConnecting(uint8_t dots) {
+    grid.clear();
+    uint8_t column = grid.print(0, 1, "Connecting", ST77XX_WHITE);
+    for (uint8_t i = 0; i < dots; i++) column = grid.print(column, 1, ".", ST77XX_WHITE);
+}
+
+uint32_t PriceBoardView::render() {
+    // 배경색을 함께 주면 drawChar()가 6x8 칸 전체를 덮어쓰므로 지우기가 따로 필요 없다
+    const uint16_t cells = grid.flush([this](uint8_t column, uint8_t row, char ch, uint16_t color) {
+        gfx.drawChar(left + column * CELL_WIDTH, rowY(row), ch, color, background, 1);
+    });
+
+    const uint32_t pixels = uint32_t(cells) * CELL_WIDTH * CELL_HEIGHT;
+    lastCells = cells;
+    lastPixels = pixels;
+    totalPixels += pixels;
+    renderCount++;
+    return pixels;
+}
@@ -0,0 +1,65 @@
+#ifndef PRICE_BOARD_VIEW_H
+#define PRICE_BOARD_VIEW_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_ST77xx.h>
+#include "textGrid.h"
+#include "tickerFetcher.h"
+
+// 크립토 가격 화면(TFT)의 retained 뷰.
+// 매 갱신마다 가격 줄과 갱신 시각을 문자 격자에 새로 쓰고, 마지막으로 그린 것과 다른 글자 칸만
+// 배경색과 함께 다시 그린다. 가격 영역을 fillRect()로 지우지 않으므로 깜빡이지 않는다.
+// 글자 크기 1 (칸 6x8 픽셀) 기준. 숫자는 fixedFormat.h로 스택 버퍼에 만든다.
+class PriceBoardView {
+public:
+    static constexpr uint8_t COLUMNS = 45;       // (284 - 10) / 6
+    static constexpr uint8_t PRICE_ROWS = 4;
+    static constexpr uint8_t ROWS = PRICE_ROWS + 1;  // 마지막 줄 = 갱신 시각
+
+    // left/top: 첫 가격 줄 위치, footerY: 갱신 시각 줄 위치 (픽셀)
+    PriceBoardView(Adafruit_GFX& gfx, int16_t left, int16_t top, int16_t footerY,
+                   uint16_t background = ST77XX_BLACK)
+        : gfx(gfx), left(left), top(top), footerY(footerY), background(background) {}
+
+    // 시세로 화면 내용 갱신 (그리지는 않음)
+    void showPrices(const TickerSnapshot& prices);
+
+    // 시세를 받기 전 "Connecting..." 표시 (dots = 점 개수)
+    void showConnecting(uint8_t dots);
+
+    // 바뀐 글자 칸만 그린다. 이번에 보낸 픽셀 수를 반환
+    uint32_t render();
+
+    // 화면을 다른 코드가 덮어썼을 때 다음 render()에서 전부 다시 그리기
+    void invalidate() { grid.invalidate(); }
+
+    uint16_t getLastCells() const { return lastCells; }
+    uint32_t getLastPixels() const { return lastPixels; }
+    uint32_t getTotalPixels() const { return totalPixels; }
+    uint32_t getRenderCount() const { return renderCount; }
+
+    static constexpr uint8_t CELL_WIDTH = 6;
+    static constexpr uint8_t CELL_HEIGHT = 8;
+    static constexpr uint8_t ROW_PITCH = 10;
+
+private:
+    Adafruit_GFX& gfx;
+    const int16_t left;
+    const int16_t top;
+    const int16_t footerY;
+    const uint16_t background;
+
+    TextGrid<COLUMNS, ROWS> grid;
+
+    volatile uint16_t lastCells = 0;
+    volatile uint32_t lastPixels = 0;
+    volatile uint32_t totalPixels = 0;
+    volatile uint32_t renderCount = 0;
+
+    int16_t rowY(uint8_t row) const {
+        return row < PRICE_ROWS ? top + row * ROW_PITCH : footerY;
+    }
+};
+
+#endif
@@ -0,0 +1,116 @@
+#include "serialShell.h"
+#include <string.h>
+
+bool SerialShell::add(const char* name, const char* usage, const char* help, Handler handler) {
+    // 이름순 위치 찾기 (명령 수가 적으므로 삽입 정렬)
+    uint8_t index = 0;
+    while (index < commandCount && strcmp(commands[index].name, name) < 0) index++;
+
+    if (index < commandCount && strcmp(commands[index].name, name) == 0) {
+        commands[index] = {name, usage, help, handler};
+        return true;
+    }
+    if (commandCount >= MAX_COMMANDS) return false;
+
+    memmove(&commands[index + 1], &commands[index], (commandCount - index) * sizeof(Command));
+    commands[index] = {name, usage, help, handler};
+    commandCount++;
+    return true;
+}
+
+const SerialShell::Command* SerialShell::find(const char* name) const {
+    int low = 0;
+    int high = int(commandCount) - 1;
+    while (low <= high) {
+        const int middle = (low + high) / 2;
+        const int order = strcmp(name, commands[middle].name);
+        if (order == 0) return &commands[middle];
+        if (order < 0) {
+            high = middle - 1;
+        } else {
+            low = middle + 1;
+        }
+    }
+    return nullptr;
+}
+
+bool SerialShell::poll() {
+    bool executed = false;
+    int available = io.available();
+    while (available-- > 0) {
+        const int c = io.read();
+        if (c < 0) break;
+
+        if (c == '\r' || c == '\n') {
+            const bool skip = c == '\n' && lastWasCR;
+            lastWasCR = c == '\r';
+            if (skip) continue;
+            if (echo) io.println();
+
+            if (overflow) {
+                io.printf("❌ 명령이 너무 깁니다 (최대 %u자).\n", unsigned(LINE_SIZE - 1));
+                overflow = false;
+            } else {
+                line[length] = '\0';
+                execute(line);
+                executed = true;
+            }
+            length = 0;
+            continue;
+        }
+        lastWasCR = false;
+
+        if (c == '\b' || c == 0x7F) {
+            if (length > 0 && !overflow) {
+                length--;
+                if (echo) io.print("\b \b");
+            }
+            continue;
+        }
+        if (overflow) continue;
+        if (length >= LINE_SIZE - 1) {
+            overflow = true;
+            overflowCount++;
+            continue;
+        }
+        line[length++] = char(c);
+        if (echo) io.write(uint8_t(c));
+    }
+    return executed;
+}
+
+void SerialShell::execute(char* text) {
+    char* argv[MAX_ARGS + 1];
+    uint8_t argc = 0;
+
+    // 공백 자리에 '\0'을 넣어 잘라서 argv 만들기. MAX_ARGS를 넘는 인자는 버린다
+    char* cursor = text;
+    while (*cursor) {
+        while (*cursor == ' ' || *cursor == '\t') *cursor++ = '\0';
+        if (!*cursor) break;
+        if (argc == MAX_ARGS) break;
+        argv[argc++] = cursor;
+        while (*cursor && *cursor != ' ' && *cursor != '\t') cursor++;
+    }
+    argv[argc] = nullptr;
+    if (argc == 0) return;
+
+    const Command* command = find(argv[0]);
+    if (command) {
+        command->handler(*this, argc, argv);
+    } else if (strcmp(argv[0], "help") == 0) {
+        printHelp();
+    } else {
+        io.printf("❌ Unknown command '%s'. Type 'help' for available commands.\n", argv[0]);
+    }
+}
+
+void SerialShell::printHelp() {
+    io.println("\n사용 가능한 명령어:");
+    for (uint8_t i = 0; i < commandCount; i++) {
+        char synopsis[40];
+        snprintf(synopsis, sizeof(synopsis), "%s %s", commands[i].name, commands[i].usage ? commands[i].usage : "");
+        io.printf("  %-24s - %s\n", synopsis, commands[i].help ? commands[i].help : "");
+    }
+    if (!find("help")) io.printf("  %-24s - %s\n", "help", "도움말 보기");
+}
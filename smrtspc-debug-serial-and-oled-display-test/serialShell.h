@@ -0,0 +1,72 @@
+#ifndef SERIAL_SHELL_H
+#define SERIAL_SHELL_H
+
+#include <Arduino.h>
+
+// 시리얼 명령 셸. 예제 스케치들이 같은 방식으로 명령을 받도록 공용으로 쓴다.
+//  - poll()은 지금 와 있는 바이트만 읽고 바로 반환한다 (readStringUntil처럼 줄 끝을 기다리지 않음)
+//  - 입력은 고정 버퍼(LINE_SIZE)에 모으고 줄이 끝나면 그 자리에서 공백으로 잘라 argv를 만든다 (힙 할당 없음)
+//  - 명령은 이름순으로 정렬해 두고 이진 탐색으로 찾는다
+//  - 줄 끝은 '\n', '\r', "\r\n" 모두 허용, 백스페이스로 지우기 가능 (터미널에서 직접 입력할 때)
+//
+//   void cmdDump(SerialShell& shell, uint8_t argc, char* argv[]) { ... argv[0] == "dump" ... }
+//   SerialShell shell(Serial);
+//   shell.add("dump", "nvs|eeprom", "NVS/EEPROM 내용 조회", cmdDump);
+//   loop() { shell.poll(); ... }
+//
+// "help"는 따로 등록하지 않아도 등록된 명령 목록을 출력한다.
+class SerialShell {
+public:
+    static constexpr uint8_t MAX_COMMANDS = 24;
+    static constexpr uint8_t MAX_ARGS = 8;
+    static constexpr uint8_t LINE_SIZE = 128;
+
+    // argv[0]은 명령 이름, argv[argc]는 nullptr
+    using Handler = void (*)(SerialShell& shell, uint8_t argc, char* argv[]);
+
+    explicit SerialShell(Stream& io) : io(io) {}
+
+    // 명령 등록. 문자열은 복사하지 않으므로 리터럴이나 전역 문자열을 넘긴다.
+    // 이름이 같으면 덮어쓰고, 자리가 없으면 false
+    bool add(const char* name, const char* usage, const char* help, Handler handler);
+
+    // 와 있는 입력을 처리. 완성된 줄을 하나 이상 실행했으면 true
+    bool poll();
+
+    // 한 줄을 바로 실행 (line은 잘라 쓰므로 수정 가능한 버퍼여야 함)
+    void execute(char* line);
+
+    void printHelp();
+
+    // 명령 처리 함수에서 출력할 때
+    Stream& out() { return io; }
+
+    // 입력 에코 (터미널 프로그램처럼 입력이 보이지 않을 때). 기본은 끔 (Arduino 시리얼 모니터)
+    void setEcho(bool enabled) { echo = enabled; }
+
+    // 너무 길어서 버린 줄 수
+    uint32_t getOverflowCount() const { return overflowCount; }
+
+private:
+    struct Command {
+        const char* name;
+        const char* usage;
+        const char* help;
+        Handler handler;
+    };
+
+    Stream& io;
+    Command commands[MAX_COMMANDS];
+    uint8_t commandCount = 0;
+
+    char line[LINE_SIZE];
+    uint8_t length = 0;
+    bool overflow = false;       // 현재 줄이 넘쳐서 줄 끝까지 버리는 중
+    bool lastWasCR = false;      // "\r\n"의 '\n'을 빈 줄로 세지 않기 위해
+    bool echo = false;
+    uint32_t overflowCount = 0;
+
+    const Command* find(const char* name) const;
+};
+
+#endif
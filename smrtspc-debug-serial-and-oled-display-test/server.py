@@ -5,8 +5,10 @@
 
 
 from flask import Flask, request, jsonify
-from datetime import datetime
+from datetime import datetime, timedelta, timezone
 from flask_cors import CORS
+from werkzeug.serving import WSGIRequestHandler
+import random
 
 app = Flask(__name__)
 app.config['TEMPLATES_AUTO_RELOAD'] = True
@@ -48,6 +50,50 @@ def receive_data():
 def get_data():
     return jsonify(received_data)
 
+# Upbit /v1/ticker 모의 응답 (ex-crypto-on-dual-display 예제에서 TICKER_BASE_URL을 이 서버로 지정)
+# 요청한 마켓마다 가격이 조금씩 움직이고, 필드 이름과 형식은 Upbit 응답과 같다
+mock_prices = {
+    'KRW-BTC': 95000000.0,
+    'KRW-ETH': 3500000.0,
+    'KRW-LINK': 20000.0,
+}
+mock_stats = {'requests': 0}
+
+@app.route('/v1/ticker', methods=['GET'])
+def mock_ticker():
+    markets = [m for m in request.args.get('markets', '').split(',') if m]
+    if not markets:
+        return jsonify({"error": {"name": "invalid_query_payload", "message": "markets is required"}}), 400
+
+    mock_stats['requests'] += 1
+    now = datetime.now(timezone(timedelta(hours=9)))
+    tickers = []
+    for market in markets:
+        prev_close = mock_prices.setdefault(market, 10000.0)
+        price = round(prev_close * (1 + random.uniform(-0.03, 0.03)), 2)
+        tickers.append({
+            'market': market,
+            'trade_date_kst': now.strftime('%Y%m%d'),
+            'trade_time_kst': now.strftime('%H%M%S'),
+            'trade_timestamp': int(now.timestamp() * 1000),
+            'opening_price': prev_close,
+            'high_price': max(prev_close, price),
+            'low_price': min(prev_close, price),
+            'trade_price': price,
+            'prev_closing_price': prev_close,
+            'change': 'RISE' if price > prev_close else 'FALL' if price < prev_close else 'EVEN',
+            'change_price': abs(price - prev_close),
+            'change_rate': abs(price - prev_close) / prev_close,
+            'signed_change_price': price - prev_close,
+            'signed_change_rate': (price - prev_close) / prev_close,
+            'trade_volume': round(random.uniform(0.001, 1.0), 8),
+            'timestamp': int(now.timestamp() * 1000),
+        })
+
+    # 연결 재사용 여부는 클라이언트 포트로 확인 (keep-alive면 같은 포트가 반복됨)
+    print(f"Ticker request #{mock_stats['requests']} from {request.remote_addr}:{request.environ.get('REMOTE_PORT')} for {', '.join(markets)}")
+    return jsonify(tickers)
+
 @app.route('/')
 def index():
     client_ip = request.remote_addr
@@ -222,5 +268,7 @@ def index():
         """
 
 if __name__ == '__main__':
+    # HTTP/1.1로 응답해야 클라이언트가 keep-alive 연결을 재사용할 수 있다
+    WSGIRequestHandler.protocol_version = "HTTP/1.1"
     print("Starting Flask server on http://0.0.0.0:5003")
     app.run(host='0.0.0.0', port=5003, debug=True, use_reloader=True, use_debugger=True)
\ No newline at end of file
@@ -0,0 +1,346 @@
+#include "settingsStore.h"
+#include "metricsRegistry.h"
+#include <esp_rom_crc.h>
+#include <string.h>
+#include <algorithm>
+
+namespace {
+
+const uint16_t RECORD_MAGIC = 0x5354;  // "ST"
+
+// NVS에 저장되는 묶음 머리. CRC는 version, size와 구조체 바이트에 대해 계산
+struct RecordHeader {
+    uint16_t magic;
+    uint16_t version;
+    uint16_t size;
+    uint16_t reserved;
+    uint32_t crc;
+};
+
+uint32_t recordCrc(const RecordHeader& header, const uint8_t* data) {
+    uint32_t crc = esp_rom_crc32_le(0, reinterpret_cast<const uint8_t*>(&header.version), 4);
+    return esp_rom_crc32_le(crc, data, header.size);
+}
+
+const char* typeName(SettingType type) {
+    switch (type) {
+        case SettingType::U8:    return "uint8";
+        case SettingType::I8:    return "int8";
+        case SettingType::U16:   return "uint16";
+        case SettingType::I16:   return "int16";
+        case SettingType::U32:   return "uint32";
+        case SettingType::I32:   return "int32";
+        case SettingType::FLOAT: return "float";
+        case SettingType::BOOL:  return "bool";
+    }
+    return "?";
+}
+
+uint8_t typeSize(SettingType type) {
+    switch (type) {
+        case SettingType::U8: case SettingType::I8: case SettingType::BOOL: return 1;
+        case SettingType::U16: case SettingType::I16: return 2;
+        default: return 4;
+    }
+}
+
+// 문자열을 필드 타입 값으로 (범위 검사 포함)
+bool parseValue(SettingType type, const char* text, uint8_t* out) {
+    char* end = nullptr;
+    switch (type) {
+        case SettingType::BOOL: {
+            bool value;
+            if (!strcmp(text, "1") || !strcmp(text, "true") || !strcmp(text, "on")) {
+                value = true;
+            } else if (!strcmp(text, "0") || !strcmp(text, "false") || !strcmp(text, "off")) {
+                value = false;
+            } else {
+                return false;
+            }
+            memcpy(out, &value, sizeof(value));
+            return true;
+        }
+        case SettingType::FLOAT: {
+            const float value = strtof(text, &end);
+            if (end == text || *end) return false;
+            memcpy(out, &value, sizeof(value));
+            return true;
+        }
+        case SettingType::U8: case SettingType::U16: case SettingType::U32: {
+            if (*text == '-') return false;
+            const unsigned long value = strtoul(text, &end, 0);
+            if (end == text || *end) return false;
+            const uint8_t size = typeSize(type);
+            if (size < 4 && value >> (size * 8)) return false;
+            const uint32_t raw = uint32_t(value);
+            memcpy(out, &raw, size);  // 리틀 엔디언
+            return true;
+        }
+        default: {
+            const long value = strtol(text, &end, 0);
+            if (end == text || *end) return false;
+            const uint8_t size = typeSize(type);
+            const long limit = size < 4 ? 1L << (size * 8 - 1) : 0;
+            if (size < 4 && (value < -limit || value >= limit)) return false;
+            const int32_t raw = int32_t(value);
+            memcpy(out, &raw, size);
+            return true;
+        }
+    }
+}
+
+void printValue(Print& out, SettingType type, const uint8_t* data) {
+    switch (type) {
+        case SettingType::U8:    out.print(unsigned(data[0])); break;
+        case SettingType::I8:    out.print(int(int8_t(data[0]))); break;
+        case SettingType::BOOL:  out.print(data[0] ? "true" : "false"); break;
+        case SettingType::U16:   { uint16_t v; memcpy(&v, data, 2); out.print(unsigned(v)); break; }
+        case SettingType::I16:   { int16_t v;  memcpy(&v, data, 2); out.print(int(v)); break; }
+        case SettingType::U32:   { uint32_t v; memcpy(&v, data, 4); out.print((unsigned long)v); break; }
+        case SettingType::I32:   { int32_t v;  memcpy(&v, data, 4); out.print((long)v); break; }
+        case SettingType::FLOAT: { float v;    memcpy(&v, data, 4); out.print(v, 3); break; }
+    }
+}
+
+}  // namespace
+
+// ---- SettingsRecordBase ----
+
+SettingsRecordBase::SettingsRecordBase(const char* key, uint16_t version, void* data, const void* defaults,
+                                       uint16_t size, const SettingField* fields, uint8_t fieldCount)
+    : key(key), version(version), data(static_cast<uint8_t*>(data)), defaults(static_cast<const uint8_t*>(defaults)),
+      size(size), fields(fields), fieldCount(fieldCount) {}
+
+void SettingsRecordBase::attach() {
+    // 전역 객체 생성 중일 수 있으므로 Settings 참조 대신 getInstance()
+    SettingsStore::getInstance().add(this);
+}
+
+void SettingsRecordBase::write(uint16_t offset, const void* value, uint16_t length) {
+    if (offset + length > size) return;
+    portENTER_CRITICAL(&lock);
+    const bool changed = memcmp(data + offset, value, length) != 0;
+    if (changed) {
+        memcpy(data + offset, value, length);
+        dirty = true;
+    }
+    portEXIT_CRITICAL(&lock);
+    SettingsStore::getInstance().onChange(changed);
+}
+
+void SettingsRecordBase::read(void* out) const {
+    portENTER_CRITICAL(&lock);
+    memcpy(out, data, size);
+    portEXIT_CRITICAL(&lock);
+}
+
+bool SettingsRecordBase::setByName(const char* name, const char* text) {
+    for (uint8_t i = 0; i < fieldCount; i++) {
+        if (strcmp(fields[i].name, name) != 0) continue;
+        uint8_t value[4];
+        if (!parseValue(fields[i].type, text, value)) return false;
+        write(fields[i].offset, value, typeSize(fields[i].type));
+        return true;
+    }
+    return false;
+}
+
+void SettingsRecordBase::print(Print& out) const {
+    uint8_t copy[SettingsStore::MAX_RECORD_SIZE];
+    read(copy);
+    out.printf("[%s] v%u%s\n", key, unsigned(version), dirty ? " (저장 대기)" : "");
+    for (uint8_t i = 0; i < fieldCount; i++) {
+        out.printf("  %-16s = ", fields[i].name);
+        printValue(out, fields[i].type, copy + fields[i].offset);
+        out.printf("  (%s)\n", typeName(fields[i].type));
+    }
+}
+
+void SettingsRecordBase::resetToDefaults() {
+    write(0, defaults, size);
+}
+
+// ---- SettingsStore ----
+
+void SettingsStore::add(SettingsRecordBase* record) {
+    if (recordCount >= MAX_RECORDS || record->size > MAX_RECORD_SIZE) return;
+    records[recordCount++] = record;
+    if (opened) load(*record);
+}
+
+bool SettingsStore::begin(const char* namespaceName) {
+    if (opened) return true;
+    if (!commitMutex) commitMutex = xSemaphoreCreateMutex();
+    if (!commitMutex) return false;
+    if (nvs_open(namespaceName, NVS_READWRITE, &handle) != ESP_OK) return false;
+    opened = true;
+    for (uint8_t i = 0; i < recordCount; i++) load(*records[i]);
+    return true;
+}
+
+void SettingsStore::load(SettingsRecordBase& record) {
+    uint8_t buffer[sizeof(RecordHeader) + MAX_RECORD_SIZE];
+    size_t length = sizeof(buffer);
+    const esp_err_t err = nvs_get_blob(handle, record.key, buffer, &length);
+    if (err == ESP_ERR_NVS_NOT_FOUND) return;  // 처음 쓰는 묶음: 기본값 그대로
+
+    RecordHeader header;
+    memcpy(&header, buffer, sizeof(header));
+    const uint8_t* payload = buffer + sizeof(header);
+    const bool valid = err == ESP_OK && length >= sizeof(header) && header.magic == RECORD_MAGIC &&
+                       header.version == record.version && header.size <= record.size &&
+                       length == sizeof(header) + header.size && recordCrc(header, payload) == header.crc;
+    if (!valid) {
+        portENTER_CRITICAL(&statsLock);
+        stats.loadFallbacks++;
+        portEXIT_CRITICAL(&statsLock);
+        return;
+    }
+
+    // 저장된 크기가 작으면 (필드 추가) 나머지는 기본값 유지
+    portENTER_CRITICAL(&record.lock);
+    memcpy(record.data, payload, header.size);
+    portEXIT_CRITICAL(&record.lock);
+    record.stored = true;
+}
+
+void SettingsStore::onChange(bool changed) {
+    portENTER_CRITICAL(&statsLock);
+    if (changed) {
+        stats.changes++;
+    } else {
+        stats.unchanged++;
+    }
+    portEXIT_CRITICAL(&statsLock);
+    if (changed && commitTask) xTaskNotifyGive(commitTask);
+}
+
+esp_err_t SettingsStore::commit() {
+    if (!opened) return ESP_ERR_INVALID_STATE;
+    xSemaphoreTake(commitMutex, portMAX_DELAY);
+
+    static MetricsRegistry::Counter& commitCounter = Metrics.counter("settings.commits");
+    const uint32_t start = micros();
+    esp_err_t result = ESP_OK;
+    uint8_t written = 0;
+    uint8_t writtenMask = 0;   // 이번에 nvs_set_blob한 묶음 (MAX_RECORDS <= 8)
+
+    for (uint8_t i = 0; i < recordCount; i++) {
+        SettingsRecordBase& record = *records[i];
+        if (!record.dirty) continue;
+
+        uint8_t buffer[sizeof(RecordHeader) + MAX_RECORD_SIZE];
+        RecordHeader header = {RECORD_MAGIC, record.version, record.size, 0, 0};
+        uint8_t* payload = buffer + sizeof(header);
+
+        // 복사하는 순간의 값을 기록. 그 뒤의 변경은 dirty가 다시 켜져 다음 commit에 들어간다
+        portENTER_CRITICAL(&record.lock);
+        memcpy(payload, record.data, record.size);
+        record.dirty = false;
+        portEXIT_CRITICAL(&record.lock);
+
+        header.crc = recordCrc(header, payload);
+        memcpy(buffer, &header, sizeof(header));
+        const esp_err_t err = nvs_set_blob(handle, record.key, buffer, sizeof(header) + record.size);
+        if (err != ESP_OK) {
+            record.dirty = true;  // 다음에 다시 시도
+            result = err;
+            continue;
+        }
+        written++;
+        writtenMask |= uint8_t(1u << i);
+    }
+
+    if (written > 0) {
+        const esp_err_t err = nvs_commit(handle);
+        if (err != ESP_OK) {
+            // 기록이 확정되지 않았으므로 이번에 쓴 묶음을 다시 dirty로 (다음 commit에서 다시 쓴다)
+            for (uint8_t i = 0; i < recordCount; i++) {
+                if (!(writtenMask & (1u << i))) continue;
+                portENTER_CRITICAL(&records[i]->lock);
+                records[i]->dirty = true;
+                portEXIT_CRITICAL(&records[i]->lock);
+            }
+            result = err;
+        } else {
+            for (uint8_t i = 0; i < recordCount; i++) {
+                if (writtenMask & (1u << i)) records[i]->stored = true;
+            }
+            commitCounter.add();
+        }
+
+        portENTER_CRITICAL(&statsLock);
+        stats.recordWrites += written;
+        if (err == ESP_OK) stats.commits++;
+        stats.lastCommitMicros = micros() - start;
+        portEXIT_CRITICAL(&statsLock);
+    }
+
+    xSemaphoreGive(commitMutex);
+    return result;
+}
+
+bool SettingsStore::beginAutoCommit(uint32_t quiet, uint32_t maxDelay, UBaseType_t priority) {
+    if (commitTask) return true;
+    if (!opened) return false;
+    quietMs = quiet;
+    maxDelayMs = maxDelay;
+    commitTask = Tasks.spawn("Settings", commitTaskEntry, this, 3072, priority);
+    return commitTask != nullptr;
+}
+
+void SettingsStore::commitTaskEntry(void* arg) {
+    SettingsStore* self = static_cast<SettingsStore*>(arg);
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // 첫 변경
+
+        // 변경이 이어지는 동안은 모아 두고, 조용해지거나 최대 지연이 지나면 한 번에 기록
+        const uint32_t firstChange = millis();
+        while (true) {
+            const uint32_t elapsed = millis() - firstChange;
+            if (elapsed >= self->maxDelayMs) break;
+            const uint32_t wait = std::min(self->quietMs, self->maxDelayMs - elapsed);
+            if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait)) == 0) break;
+        }
+
+        esp_err_t result;
+        {
+            WorkTimer work;
+            result = self->commit();
+        }
+        // 실패한 묶음은 dirty로 남아 있으므로 최대 지연만큼 쉬었다가 다시 시도
+        if (result != ESP_OK) {
+            vTaskDelay(pdMS_TO_TICKS(self->maxDelayMs));
+            xTaskNotifyGive(self->commitTask);
+        }
+    }
+}
+
+bool SettingsStore::isDirty() const {
+    for (uint8_t i = 0; i < recordCount; i++) {
+        if (records[i]->dirty) return true;
+    }
+    return false;
+}
+
+SettingsStore::Stats SettingsStore::getStats() const {
+    portENTER_CRITICAL(&statsLock);
+    Stats copy = stats;
+    portEXIT_CRITICAL(&statsLock);
+    return copy;
+}
+
+SettingsRecordBase* SettingsStore::find(const char* key) const {
+    for (uint8_t i = 0; i < recordCount; i++) {
+        if (strcmp(records[i]->key, key) == 0) return records[i];
+    }
+    return nullptr;
+}
+
+void SettingsStore::print(Print& out) const {
+    for (uint8_t i = 0; i < recordCount; i++) records[i]->print(out);
+    const Stats s = getStats();
+    out.printf("변경 %lu회 (같은 값 %lu회 무시), 기록 %lu개 묶음 / commit %lu회, 마지막 commit %lu us\n",
+               (unsigned long)s.changes, (unsigned long)s.unchanged, (unsigned long)s.recordWrites,
+               (unsigned long)s.commits, (unsigned long)s.lastCommitMicros);
+}
@@ -0,0 +1,216 @@
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+#include <Arduino.h>
+#include <nvs.h>
+#include <stddef.h>
+#include <type_traits>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include "taskRuntime.h"
+
+// NVS 위의 설정 저장소. 자주 바뀌는 값(밝기, 모터 보정, 갱신 주기 등)을 바꿀 때마다
+// nvs_set + nvs_commit을 하면 플래시가 닳고 호출한 쪽이 기록 시간 동안 멈춘다.
+//  - 설정 묶음(record)은 컴파일 시간에 SETTINGS_SCHEMA로 정의한다 (필드 타입, 이름, 기본값, 스키마 버전)
+//  - 값은 RAM 사본에서 읽으므로 get()은 비용이 없다
+//  - set()은 값이 실제로 바뀔 때만 묶음을 dirty로 표시한다 (같은 값이면 아무것도 하지 않음)
+//  - commit()은 dirty 묶음만 blob 하나씩 쓰고 nvs_commit은 한 번만 한다
+//  - beginAutoCommit() 후에는 백그라운드 태스크가 변경이 quietMs 동안 멈추면(최대 maxDelayMs) 모아서 commit
+//  - 저장 형식: 머리(매직, 스키마 버전, 크기) + CRC32 + 구조체 바이트. CRC나 버전이 맞지 않으면 기본값을 쓴다.
+//    버전이 같고 저장된 크기가 더 작으면(필드를 끝에 추가한 경우) 있는 부분만 읽고 나머지는 기본값
+//
+//   #define DISPLAY_SETTINGS(FIELD) FIELD(uint8_t, contrast, 150) FIELD(uint32_t, refreshMs, 60000)
+//   SETTINGS_SCHEMA(DisplaySettings, DISPLAY_SETTINGS, 1)
+//
+//   SettingsRecord<DisplaySettings> displaySettings("display");   // 전역 (NVS 키 이름, 15자 이하)
+//   Settings.begin();  Settings.beginAutoCommit();                // nvs_flash_init() 이후
+//   u8g2.setContrast(displaySettings.get().contrast);
+//   displaySettings.set(&DisplaySettings::contrast, 200);
+enum class SettingType : uint8_t { U8, I8, U16, I16, U32, I32, FLOAT, BOOL };
+
+template <typename T> struct SettingTypeOf;
+template <> struct SettingTypeOf<uint8_t>  { static constexpr SettingType value = SettingType::U8; };
+template <> struct SettingTypeOf<int8_t>   { static constexpr SettingType value = SettingType::I8; };
+template <> struct SettingTypeOf<uint16_t> { static constexpr SettingType value = SettingType::U16; };
+template <> struct SettingTypeOf<int16_t>  { static constexpr SettingType value = SettingType::I16; };
+template <> struct SettingTypeOf<uint32_t> { static constexpr SettingType value = SettingType::U32; };
+template <> struct SettingTypeOf<int32_t>  { static constexpr SettingType value = SettingType::I32; };
+template <> struct SettingTypeOf<float>    { static constexpr SettingType value = SettingType::FLOAT; };
+template <> struct SettingTypeOf<bool>     { static constexpr SettingType value = SettingType::BOOL; };
+
+struct SettingField {
+    const char* name;
+    SettingType type;
+    uint16_t offset;
+};
+
+template <typename T> struct SettingsSchema;
+
+#define SETTINGS_FIELD_MEMBER(type, name, defaultValue) type name = defaultValue;
+#define SETTINGS_FIELD_INFO(type, name, defaultValue) \
+    {#name, SettingTypeOf<type>::value, uint16_t(offsetof(SchemaType, name))},
+
+// 설정 구조체와 필드 표 정의 (헤더나 스케치의 전역 범위에서)
+#define SETTINGS_SCHEMA(Name, FIELDS, schemaVersion) \
+    struct Name { \
+        FIELDS(SETTINGS_FIELD_MEMBER) \
+    }; \
+    template <> struct SettingsSchema<Name> { \
+        using SchemaType = Name; \
+        static constexpr uint16_t version = schemaVersion; \
+        static constexpr SettingField fields[] = {FIELDS(SETTINGS_FIELD_INFO)}; \
+        static constexpr uint8_t fieldCount = sizeof(fields) / sizeof(fields[0]); \
+    };
+
+class SettingsStore;
+
+// 설정 묶음 하나 (타입 없는 부분). SettingsRecord<T>로 사용
+class SettingsRecordBase {
+public:
+    const char* getKey() const { return key; }
+    bool isDirty() const { return dirty; }
+    // NVS에 저장된 묶음이 있는지 (읽어 왔거나 commit함). false면 값은 기본값이다
+    bool isStored() const { return stored; }
+
+    // 이름으로 값 바꾸기 (시리얼 명령용). 이름이 없거나 값이 범위를 벗어나면 false
+    bool setByName(const char* name, const char* text);
+    // "  이름 = 값" 목록
+    void print(Print& out) const;
+    // 모든 값을 기본값으로 (바뀐 값이 있으면 dirty)
+    void resetToDefaults();
+
+protected:
+    SettingsRecordBase(const char* key, uint16_t version, void* data, const void* defaults, uint16_t size,
+                       const SettingField* fields, uint8_t fieldCount);
+
+    // 저장소에 등록 (파생 클래스의 값이 초기화된 뒤에 불러야 읽은 값이 덮어써지지 않는다)
+    void attach();
+
+    // offset 위치에 값 복사. 바뀌었으면 dirty로 표시하고 저장소에 알린다
+    void write(uint16_t offset, const void* value, uint16_t length);
+    void read(void* out) const;
+
+private:
+    friend class SettingsStore;
+
+    const char* key;
+    uint16_t version;
+    uint8_t* data;
+    const uint8_t* defaults;
+    uint16_t size;
+    const SettingField* fields;
+    uint8_t fieldCount;
+    volatile bool dirty = false;
+    bool stored = false;
+    mutable portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+};
+
+template <typename T>
+class SettingsRecord : public SettingsRecordBase {
+public:
+    static_assert(std::is_trivially_copyable<T>::value, "settings must be plain data");
+
+    explicit SettingsRecord(const char* key)
+        : SettingsRecordBase(key, SettingsSchema<T>::version, &value, &defaultValue, sizeof(T),
+                             SettingsSchema<T>::fields, SettingsSchema<T>::fieldCount) {
+        attach();
+    }
+
+    // RAM 사본 (다른 태스크가 바꾸는 중에도 필드 하나씩 읽는 것은 안전)
+    const T& get() const { return value; }
+
+    // 구조체 전체를 일관되게 복사
+    T snapshot() const {
+        T copy;
+        read(&copy);
+        return copy;
+    }
+
+    template <typename F>
+    void set(F T::*field, const F& newValue) {
+        const uint16_t offset = uint16_t(reinterpret_cast<const uint8_t*>(&(value.*field)) -
+                                         reinterpret_cast<const uint8_t*>(&value));
+        write(offset, &newValue, sizeof(F));
+    }
+
+    // 구조체 전체 바꾸기
+    void set(const T& newValue) { write(0, &newValue, sizeof(T)); }
+
+private:
+    T value{};
+    static const T defaultValue;
+};
+
+template <typename T>
+const T SettingsRecord<T>::defaultValue{};
+
+class SettingsStore {
+public:
+    static constexpr uint8_t MAX_RECORDS = 8;
+    static constexpr uint16_t MAX_RECORD_SIZE = 256;
+
+    struct Stats {
+        uint32_t changes;        // 값이 실제로 바뀐 set() 수
+        uint32_t unchanged;      // 같은 값이라 무시한 set() 수
+        uint32_t recordWrites;   // nvs_set_blob 수
+        uint32_t commits;        // nvs_commit 수
+        uint32_t loadFallbacks;  // CRC/버전/크기가 맞지 않아 기본값을 쓴 묶음 수
+        uint32_t lastCommitMicros;
+    };
+
+    // 싱글톤 인스턴스 반환
+    static SettingsStore& getInstance() {
+        static SettingsStore instance;
+        return instance;
+    }
+
+    // NVS 네임스페이스를 열고 등록된 묶음을 읽는다 (nvs_flash_init() 이후에 호출)
+    bool begin(const char* namespaceName = "settings");
+
+    // 백그라운드 commit 시작. 변경이 quietMs 동안 없거나 첫 변경 후 maxDelayMs가 지나면 기록
+    bool beginAutoCommit(uint32_t quietMs = 2000, uint32_t maxDelayMs = 10000,
+                         UBaseType_t priority = TaskPriority::Background);
+
+    // dirty 묶음을 지금 기록 (재부팅 전 등). 기록할 것이 없으면 ESP_OK
+    esp_err_t commit();
+
+    bool isDirty() const;
+    Stats getStats() const;
+
+    // 등록된 묶음 전체 출력
+    void print(Print& out) const;
+    SettingsRecordBase* find(const char* key) const;
+
+private:
+    friend class SettingsRecordBase;
+
+    // 생성자/소멸자 private로 선언하여 싱글톤 패턴 유지
+    SettingsStore() = default;
+    ~SettingsStore() = default;
+    SettingsStore(const SettingsStore&) = delete;
+    SettingsStore& operator=(const SettingsStore&) = delete;
+
+    SettingsRecordBase* records[MAX_RECORDS];
+    uint8_t recordCount = 0;
+    nvs_handle_t handle = 0;
+    bool opened = false;
+
+    TaskHandle_t commitTask = nullptr;
+    uint32_t quietMs = 2000;
+    uint32_t maxDelayMs = 10000;
+    SemaphoreHandle_t commitMutex = nullptr;   // commit()을 여러 태스크에서 불러도 한 번에 하나씩
+
+    Stats stats = {};
+    mutable portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+
+    void add(SettingsRecordBase* record);
+    void load(SettingsRecordBase& record);
+    void onChange(bool changed);
+    static void commitTaskEntry(void* arg);
+};
+
+// 전역 인스턴스 참조
+inline SettingsStore& Settings = SettingsStore::getInstance();
+
+#endif
@@ -0,0 +1,118 @@
+#include "allocCounter.h"
+#include <errno.h>
+#include <malloc.h>
+#include <stddef.h>
+#include <new>
+
+// glibc의 실제 구현 (malloc을 다시 정의해도 이 이름으로 부를 수 있다)
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void __libc_free(void* ptr);
+}
+
+namespace {
+
+// 정적 초기화 순서와 상관없게 상수 초기화만
+uint64_t mallocCount = 0;
+uint64_t newCount = 0;
+size_t liveBytes = 0;
+size_t peakBytes = 0;
+
+void* track(void* p) {
+    if (p) {
+        liveBytes += malloc_usable_size(p);
+        if (liveBytes > peakBytes) peakBytes = liveBytes;
+    }
+    return p;
+}
+
+void release(void* p) {
+    if (p) liveBytes -= malloc_usable_size(p);
+    __libc_free(p);
+}
+
+void* allocateForNew(size_t size) {
+    newCount++;
+    void* p = track(__libc_malloc(size ? size : 1));
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* allocateAlignedForNew(size_t size, std::align_val_t alignment) {
+    newCount++;
+    void* p = track(__libc_memalign(size_t(alignment), size ? size : 1));
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+}  // namespace
+
+namespace Sim {
+
+AllocCounts allocCounts() { return {mallocCount, newCount, liveBytes, peakBytes}; }
+
+void resetAllocPeak() { peakBytes = liveBytes; }
+
+}  // namespace Sim
+
+extern "C" {
+
+void* malloc(size_t size) {
+    mallocCount++;
+    return track(__libc_malloc(size));
+}
+
+void* calloc(size_t count, size_t size) {
+    mallocCount++;
+    return track(__libc_calloc(count, size));
+}
+
+void* realloc(void* ptr, size_t size) {
+    mallocCount++;
+    const size_t oldSize = ptr ? malloc_usable_size(ptr) : 0;
+    void* p = __libc_realloc(ptr, size);
+    if (p || size == 0) liveBytes -= oldSize;  // 실패하면 원래 블록은 그대로
+    return track(p);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    mallocCount++;
+    return track(__libc_memalign(alignment, size));
+}
+
+int posix_memalign(void** out, size_t alignment, size_t size) {
+    mallocCount++;
+    void* p = track(__libc_memalign(alignment, size));
+    if (!p) return ENOMEM;
+    *out = p;
+    return 0;
+}
+
+void free(void* ptr) { release(ptr); }
+
+}  // extern "C"
+
+void* operator new(size_t size) { return allocateForNew(size); }
+void* operator new[](size_t size) { return allocateForNew(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    newCount++;
+    return track(__libc_malloc(size ? size : 1));
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    newCount++;
+    return track(__libc_malloc(size ? size : 1));
+}
+void* operator new(size_t size, std::align_val_t alignment) { return allocateAlignedForNew(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return allocateAlignedForNew(size, alignment); }
+
+void operator delete(void* ptr) noexcept { release(ptr); }
+void operator delete[](void* ptr) noexcept { release(ptr); }
+void operator delete(void* ptr, size_t) noexcept { release(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { release(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { release(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { release(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { release(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { release(ptr); }
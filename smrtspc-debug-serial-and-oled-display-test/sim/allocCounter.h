@@ -0,0 +1,27 @@
+#ifndef SIM_ALLOC_COUNTER_H
+#define SIM_ALLOC_COUNTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 힙 할당 횟수와 사용량 세기 (allocCounter.cpp를 링크한 실행 파일에서만).
+// malloc/calloc/realloc/aligned_alloc/posix_memalign/free와 모든 operator new/delete를 가로채 센 뒤
+// glibc 구현으로 넘긴다. 바이트 수는 malloc_usable_size 기준 (요청 크기보다 조금 클 수 있다).
+namespace Sim {
+
+struct AllocCounts {
+    uint64_t mallocs;  // malloc 계열
+    uint64_t news;     // operator new / new[]
+    size_t liveBytes;  // 지금 잡혀 있는 바이트
+    size_t peakBytes;  // resetAllocPeak() 이후 liveBytes 최대값
+    uint64_t total() const { return mallocs + news; }
+};
+
+AllocCounts allocCounts();
+
+// 최대 사용량을 지금 사용량으로 되돌린다 (구간별 최대값 측정용)
+void resetAllocPeak();
+
+}  // namespace Sim
+
+#endif
@@ -0,0 +1,227 @@
+// Upbit /v1/ticker 응답 파싱 벤치마크: 스트리밍 TickerParser(128바이트 조각, tickerFetcher와 같은 읽기 버퍼)와
+// 이전 방식(getString()으로 본문 String을 만든 뒤 필터를 건 DynamicJsonDocument로 역직렬화).
+// 행마다 파싱 1회 시간(호스트 ns), 할당 횟수, 최대 힙 사용량(파싱 시작 시점 대비), 힙 밖 상태 크기를 출력한다.
+// 이전 방식은 ArduinoJson이 있을 때만 빌드된다 (CMake의 ARDUINOJSON_SOURCE_DIR / SIM_FETCH_ARDUINOJSON).
+// 두 방식이 모두 있으면 뽑은 값이 같은지도 확인한다. TickerParser가 힙을 쓰거나 값이 틀리면 종료 코드 1.
+//   sim_bench_ticker_parser [출력 폴더] [응답 파일] [반복 횟수]   -> stdout과 serial.log 에 CSV
+
+#include <Arduino.h>
+#include <chrono>
+#include <math.h>
+#include <vector>
+#include "tickerParser.h"
+#include "allocCounter.h"
+#include "simRuntime.h"
+
+#ifdef SIM_HAVE_ARDUINOJSON
+// 호스트에는 Arduino Stream/Print가 없으므로 const char* 입력만 쓴다 (String 입력도 내부에서는 같은 경로)
+#define ARDUINOJSON_ENABLE_ARDUINO_STRING 0
+#define ARDUINOJSON_ENABLE_ARDUINO_STREAM 0
+#define ARDUINOJSON_ENABLE_ARDUINO_PRINT 0
+#define ARDUINOJSON_ENABLE_PROGMEM 0
+#include <ArduinoJson.h>
+#endif
+
+#ifndef SIM_DATA_DIR
+#define SIM_DATA_DIR "data"
+#endif
+
+namespace {
+
+constexpr size_t READ_CHUNK = 128;  // TickerFetcher::READ_CHUNK
+const char* const markets[] = {"KRW-BTC", "KRW-ETH", "KRW-LINK"};
+constexpr uint8_t MARKET_COUNT = sizeof(markets) / sizeof(markets[0]);
+
+// TickerSnapshot에서 필요한 부분만 (tickerFetcher.h는 WiFi에 의존)
+struct Quotes {
+    TickerQuote quotes[MARKET_COUNT];
+    uint8_t received;
+
+    void clear() {
+        for (uint8_t i = 0; i < MARKET_COUNT; i++) {
+            quotes[i] = TickerQuote();
+            strncpy(quotes[i].market, markets[i], sizeof(quotes[i].market) - 1);
+        }
+        received = 0;
+    }
+};
+
+struct Result {
+    double nsPerParse;
+    double allocsPerParse;
+    size_t peakHeapBytes;
+    size_t stateBytes;
+};
+
+// ---- 스트리밍 파서 (TickerFetcher::readQuotes / onQuote 와 같은 흐름) ----
+
+TickerParser parser;
+
+void onQuote(const TickerQuote& quote, void* context) {
+    Quotes* out = static_cast<Quotes*>(context);
+    for (uint8_t i = 0; i < MARKET_COUNT; i++) {
+        TickerQuote& slot = out->quotes[i];
+        if (slot.valid || strcmp(slot.market, quote.market) != 0) continue;
+        slot = quote;
+        slot.valid = true;
+        out->received++;
+        return;
+    }
+}
+
+bool parseStreaming(const std::vector<char>& payload, Quotes& out) {
+    out.clear();
+    parser.reset(onQuote, &out);
+    char buffer[READ_CHUNK];
+    for (size_t offset = 0; offset < payload.size(); offset += READ_CHUNK) {
+        const size_t count = payload.size() - offset < READ_CHUNK ? payload.size() - offset : READ_CHUNK;
+        memcpy(buffer, payload.data() + offset, count);  // client.read()가 스택 버퍼를 채우는 것과 같게
+        parser.feed(buffer, count);
+    }
+    return parser.isDone() && !parser.hasError();
+}
+
+#ifdef SIM_HAVE_ARDUINOJSON
+// ---- 이전 방식 (4b1029b 이전 TickerFetcher::parse) ----
+
+bool parseDocument(const std::vector<char>& payload, Quotes& out) {
+    out.clear();
+    const String body(std::string(payload.data(), payload.size()));  // http.getString()
+
+    StaticJsonDocument<128> filter;
+    filter[0]["market"] = true;
+    filter[0]["trade_price"] = true;
+    filter[0]["prev_closing_price"] = true;
+    filter[0]["trade_date_kst"] = true;
+    filter[0]["trade_time_kst"] = true;
+
+    DynamicJsonDocument doc(192 * MARKET_COUNT + 64);
+    if (deserializeJson(doc, body.c_str(), body.length(), DeserializationOption::Filter(filter))) return false;
+
+    for (JsonObject item : doc.as<JsonArray>()) {
+        const char* market = item["market"];
+        if (!market) continue;
+        for (uint8_t i = 0; i < MARKET_COUNT; i++) {
+            TickerQuote& quote = out.quotes[i];
+            if (quote.valid || strcmp(quote.market, market) != 0) continue;
+            quote.price = item["trade_price"];
+            quote.prevClose = item["prev_closing_price"];
+            TickerParser::formatDate(item["trade_date_kst"] | "", quote.date);
+            TickerParser::formatTime(item["trade_time_kst"] | "", quote.time);
+            quote.valid = true;
+            out.received++;
+            break;
+        }
+    }
+    return true;
+}
+#endif
+
+template <typename ParseFn>
+Result measure(ParseFn parse, const std::vector<char>& payload, uint32_t iterations, size_t stateBytes) {
+    Quotes scratch;
+    for (int i = 0; i < 10; i++) parse(payload, scratch);  // 준비 단계
+
+    const Sim::AllocCounts before = Sim::allocCounts();
+    Sim::resetAllocPeak();
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) parse(payload, scratch);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const Sim::AllocCounts after = Sim::allocCounts();
+
+    Result result;
+    result.nsPerParse = double(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / iterations;
+    result.allocsPerParse = double(after.total() - before.total()) / iterations;
+    result.peakHeapBytes = after.peakBytes - before.liveBytes;
+    result.stateBytes = stateBytes;
+    return result;
+}
+
+void printRow(const char* name, const Result& r) {
+    Serial.printf("%s,%u,%.0f,%.1f,%u,%u\n", name, (unsigned)READ_CHUNK, r.nsPerParse, r.allocsPerParse,
+                  (unsigned)r.peakHeapBytes, (unsigned)r.stateBytes);
+}
+
+bool checkQuotes(const char* name, const Quotes& q) {
+    bool ok = q.received == MARKET_COUNT;
+    for (uint8_t i = 0; i < MARKET_COUNT && ok; i++) {
+        const TickerQuote& t = q.quotes[i];
+        ok = t.valid && t.price > 0 && t.prevClose > 0 && strlen(t.date) == 10 && strlen(t.time) == 8;
+    }
+    if (!ok) Serial.printf("FAIL: %s did not extract all %u quotes\n", name, (unsigned)MARKET_COUNT);
+    return ok;
+}
+
+bool loadPayload(const char* path, std::vector<char>& payload) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+    char buffer[512];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) payload.insert(payload.end(), buffer, buffer + count);
+    fclose(file);
+    return !payload.empty();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (!Sim::begin(argc > 1 ? argv[1] : "sim-out/ticker-bench")) return 1;
+    const char* path = argc > 2 ? argv[2] : SIM_DATA_DIR "/upbit_ticker_krw_btc_eth_link.json";
+    const uint32_t iterations = argc > 3 ? uint32_t(strtoul(argv[3], nullptr, 10)) : 20000;
+    Serial.begin(115200);
+
+    std::vector<char> payload;
+    if (!loadPayload(path, payload)) {
+        Serial.printf("cannot read %s\n", path);
+        Sim::end();
+        return 1;
+    }
+
+    // 반복 중에는 기록 파일을 쓰지 않는다
+    Sim::setTracing(false);
+    const Result streaming = measure(parseStreaming, payload, iterations, sizeof(TickerParser) + READ_CHUNK);
+#ifdef SIM_HAVE_ARDUINOJSON
+    const Result document = measure(parseDocument, payload, iterations, sizeof(StaticJsonDocument<128>));
+#endif
+    Sim::setTracing(true);
+
+    Serial.printf("# %s: %u bytes, %u markets, %lu iterations\n", path, (unsigned)payload.size(),
+                  (unsigned)MARKET_COUNT, (unsigned long)iterations);
+    Serial.println("parser,chunk_bytes,ns_per_parse,allocs_per_parse,peak_heap_bytes,state_bytes");
+    printRow("TickerParser", streaming);
+
+    Quotes streamed;
+    bool ok = parseStreaming(payload, streamed) && checkQuotes("TickerParser", streamed);
+    if (streaming.allocsPerParse != 0 || streaming.peakHeapBytes != 0) {
+        Serial.println("FAIL: TickerParser used the heap");
+        ok = false;
+    }
+
+#ifdef SIM_HAVE_ARDUINOJSON
+    printRow("DynamicJsonDocument", document);
+
+    Quotes parsed;
+    ok = parseDocument(payload, parsed) && checkQuotes("DynamicJsonDocument", parsed) && ok;
+    for (uint8_t i = 0; i < MARKET_COUNT && ok; i++) {
+        const TickerQuote& a = streamed.quotes[i];
+        const TickerQuote& b = parsed.quotes[i];
+        // ArduinoJson은 double로 읽은 뒤 float로 줄이므로 마지막 자리 차이는 허용
+        if (fabsf(a.price - b.price) > a.price * 1e-6f || fabsf(a.prevClose - b.prevClose) > a.prevClose * 1e-6f ||
+            strcmp(a.date, b.date) != 0 || strcmp(a.time, b.time) != 0) {
+            Serial.printf("FAIL: %s differs between parsers\n", a.market);
+            ok = false;
+        }
+    }
+#else
+    Serial.println("# DynamicJsonDocument row skipped: configure with -DARDUINOJSON_SOURCE_DIR=... or "
+                   "-DSIM_FETCH_ARDUINOJSON=ON");
+#endif
+
+    for (uint8_t i = 0; i < MARKET_COUNT; i++) {
+        const TickerQuote& q = streamed.quotes[i];
+        Serial.printf("# %s %.0f (prev %.0f) %s %s\n", q.market, q.price, q.prevClose, q.date, q.time);
+    }
+
+    Sim::end();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+# 시나리오 하나를 돌려 출력(PBM 프레임, i2c.log)을 골든 파일과 비교한다. ctest 에서 cmake -P 로 실행.
+#   -DSCENARIO=<실행 파일> -DOUTPUT_DIR=<출력 폴더> -DGOLDEN_DIR=<골든 폴더> [-DUPDATE=ON]
+# UPDATE=ON 이면 비교 대신 골든 폴더를 출력으로 바꾼다.
+
+cmake_minimum_required(VERSION 3.16)
+
+foreach(var SCENARIO OUTPUT_DIR GOLDEN_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "checkGolden.cmake: ${var} is not set")
+    endif()
+endforeach()
+
+file(REMOVE_RECURSE ${OUTPUT_DIR})
+execute_process(COMMAND ${SCENARIO} ${OUTPUT_DIR} RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${SCENARIO} failed (${result})")
+endif()
+
+file(GLOB produced RELATIVE ${OUTPUT_DIR} ${OUTPUT_DIR}/*.pbm)
+list(APPEND produced i2c.log)
+list(SORT produced)
+
+if(UPDATE)
+    file(REMOVE_RECURSE ${GOLDEN_DIR})
+    file(MAKE_DIRECTORY ${GOLDEN_DIR})
+    foreach(name ${produced})
+        file(COPY ${OUTPUT_DIR}/${name} DESTINATION ${GOLDEN_DIR})
+    endforeach()
+    message(STATUS "updated ${GOLDEN_DIR}")
+    return()
+endif()
+
+file(GLOB expected RELATIVE ${GOLDEN_DIR} ${GOLDEN_DIR}/*)
+list(SORT expected)
+
+set(failures)
+foreach(name ${expected})
+    if(NOT EXISTS ${OUTPUT_DIR}/${name})
+        list(APPEND failures "missing ${name}")
+        continue()
+    endif()
+    execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${GOLDEN_DIR}/${name} ${OUTPUT_DIR}/${name}
+        RESULT_VARIABLE different)
+    if(different)
+        list(APPEND failures "differs ${name}")
+    endif()
+endforeach()
+foreach(name ${produced})
+    if(NOT name IN_LIST expected)
+        list(APPEND failures "unexpected ${name}")
+    endif()
+endforeach()
+
+if(failures)
+    string(REPLACE ";" "\n  " report "${failures}")
+    message(FATAL_ERROR "output in ${OUTPUT_DIR} does not match ${GOLDEN_DIR}:\n  ${report}\n"
+        "If the change is intended, run the sim_update_golden target and commit sim/golden/.")
+endif()
+list(LENGTH expected count)
+message(STATUS "${GOLDEN_DIR}: ${count} files match")
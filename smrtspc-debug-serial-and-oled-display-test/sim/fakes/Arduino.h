@@ -0,0 +1,241 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// 호스트 시뮬레이션용 Arduino 코어 대체 (sim/ 빌드 전용, 보드 빌드에는 쓰이지 않는다).
+// 시간은 가상 시계(simRuntime.h)로 흐르고 delay(), vTaskDelay(), I2C 전송 때만 앞으로 간다.
+// 그래서 같은 시나리오는 몇 번을 돌려도 같은 로그, 같은 프레임을 만든다.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <math.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef unsigned int word;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT          0x01
+#define OUTPUT         0x03
+#define PULLUP         0x04
+#define INPUT_PULLUP   0x05
+#define PULLDOWN       0x08
+#define INPUT_PULLDOWN 0x09
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define IRAM_ATTR
+#define ARDUINO_ISR_ATTR
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// ---- 시간, GPIO, PWM (C 소스에서도 부를 수 있게 C 링키지) ----
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield(void);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution);
+bool ledcWrite(uint8_t pin, uint32_t duty);
+bool ledcDetach(uint8_t pin);
+
+#ifdef __cplusplus
+}
+
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(string_literal))
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+// ---- String (std::string 기반, 예제들이 쓰는 만큼만) ----
+
+class String {
+public:
+    String() = default;
+    String(const char* text) : value(text ? text : "") {}
+    String(const std::string& text) : value(text) {}
+    String(char c) : value(1, c) {}
+    String(int number, unsigned char base = DEC);
+    String(unsigned int number, unsigned char base = DEC);
+    String(long number, unsigned char base = DEC);
+    String(unsigned long number, unsigned char base = DEC);
+    String(float number, unsigned int decimals = 2);
+    String(double number, unsigned int decimals = 2);
+
+    const char* c_str() const { return value.c_str(); }
+    unsigned int length() const { return (unsigned int)value.size(); }
+    bool isEmpty() const { return value.empty(); }
+    char charAt(unsigned int index) const { return index < value.size() ? value[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+
+    String& operator+=(const String& other) { value += other.value; return *this; }
+    String& operator+=(const char* other) { if (other) value += other; return *this; }
+    String& operator+=(char c) { value += c; return *this; }
+    bool concat(const String& other) { value += other.value; return true; }
+
+    friend String operator+(const String& a, const String& b) { return String(a.value + b.value); }
+    friend String operator+(const String& a, const char* b) { return String(a.value + (b ? b : "")); }
+    friend String operator+(const char* a, const String& b) { return String((a ? a : "") + b.value); }
+
+    bool operator==(const String& other) const { return value == other.value; }
+    bool operator==(const char* other) const { return other && value == other; }
+    bool operator!=(const String& other) const { return value != other.value; }
+    bool operator!=(const char* other) const { return !(*this == other); }
+    bool equals(const String& other) const { return value == other.value; }
+    bool equalsIgnoreCase(const String& other) const;
+    bool startsWith(const String& prefix) const { return value.compare(0, prefix.value.size(), prefix.value) == 0; }
+    bool endsWith(const String& suffix) const;
+
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String& text, unsigned int from = 0) const;
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+
+    void trim();
+    void toUpperCase();
+    void toLowerCase();
+    long toInt() const { return strtol(value.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(value.c_str(), nullptr); }
+
+private:
+    std::string value;
+};
+
+// ---- Print / Stream ----
+
+class Print {
+public:
+    virtual ~Print() = default;
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* text) { return text ? write((const uint8_t*)text, strlen(text)) : 0; }
+    size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+    virtual int availableForWrite() { return 0; }
+    virtual void flush() {}
+
+    size_t print(const __FlashStringHelper* text) { return write(reinterpret_cast<const char*>(text)); }
+    size_t print(const String& text) { return write(text.c_str(), text.length()); }
+    size_t print(const char* text) { return write(text); }
+    size_t print(char c) { return write(uint8_t(c)); }
+    size_t print(unsigned char number, int base = DEC) { return print((unsigned long)number, base); }
+    size_t print(int number, int base = DEC) { return print((long)number, base); }
+    size_t print(unsigned int number, int base = DEC) { return print((unsigned long)number, base); }
+    size_t print(long number, int base = DEC);
+    size_t print(unsigned long number, int base = DEC);
+    size_t print(long long number, int base = DEC);
+    size_t print(unsigned long long number, int base = DEC);
+    size_t print(double number, int digits = 2);
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T& value) { size_t n = print(value); return n + println(); }
+    template <typename T>
+    size_t println(const T& value, int format) { size_t n = print(value, format); return n + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+private:
+    size_t printNumber(unsigned long long number, int base, bool negative);
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long timeoutMs) { timeout = timeoutMs; }
+    size_t readBytes(char* buffer, size_t length);
+    size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+    String readString();
+    String readStringUntil(char terminator);
+
+protected:
+    unsigned long timeout = 1000;
+
+    // timeout 안에 들어온 다음 바이트, 없으면 -1 (가상 시계로 기다림)
+    int timedRead();
+};
+
+// ---- Serial ----
+// 출력은 stdout과 <출력 폴더>/serial.log 에 같이 쓴다. 입력은 Sim::feedSerial()로 넣는다.
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long baud) { baud_ = baud; started = true; }
+    void end() { started = false; }
+    uint32_t baudRate() const { return uint32_t(baud_); }
+    operator bool() const { return started; }
+
+    int available() override;
+    int read() override;
+    int peek() override;
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+    int availableForWrite() override { return 128; }
+    void flush() override;
+
+private:
+    unsigned long baud_ = 0;
+    bool started = false;
+};
+
+extern HardwareSerial Serial;
+
+// ---- ESP (칩 정보는 ESP32-C3 Super Mini 값으로 고정) ----
+class EspClass {
+public:
+    const char* getChipModel() { return "ESP32-C3"; }
+    uint8_t getChipRevision() { return 4; }
+    uint32_t getCpuFreqMHz() { return 160; }
+    uint32_t getFlashChipSize() { return 4 * 1024 * 1024; }
+    uint32_t getHeapSize() { return 320 * 1024; }
+    uint32_t getFreeHeap() { return 256 * 1024; }
+    uint32_t getMinFreeHeap() { return 240 * 1024; }
+    uint32_t getMaxAllocHeap() { return 192 * 1024; }
+    uint32_t getCycleCount();
+    void restart();
+};
+
+extern EspClass ESP;
+
+#endif  // __cplusplus
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef SIM_PRINT_H
+#define SIM_PRINT_H
+
+// U8g2lib.h가 따로 include 하는 헤더. Print는 Arduino.h에 있다
+#include "Arduino.h"
+
+#endif
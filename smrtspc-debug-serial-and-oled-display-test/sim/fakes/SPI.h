@@ -0,0 +1,44 @@
+#ifndef SIM_SPI_H
+#define SIM_SPI_H
+
+// U8x8lib.cpp의 하드웨어 SPI 경로가 컴파일되도록 하는 최소 대체. 전송 내용은 버린다
+#include "Arduino.h"
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+#define SPI_CLOCK_DIV2  0x00
+#define SPI_CLOCK_DIV4  0x01
+#define SPI_CLOCK_DIV8  0x02
+#define SPI_CLOCK_DIV16 0x03
+
+class SPISettings {
+public:
+    SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0)
+        : clock(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+    uint32_t clock;
+    uint8_t bitOrder;
+    uint8_t dataMode;
+};
+
+class SPIClass {
+public:
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {
+        (void)sck; (void)miso; (void)mosi; (void)ss;
+    }
+    void end() {}
+    void beginTransaction(const SPISettings& settings) { (void)settings; }
+    void endTransaction() {}
+    uint8_t transfer(uint8_t data) { (void)data; return 0xFF; }
+    void transfer(void* data, uint32_t size) { (void)data; (void)size; }
+    void setBitOrder(uint8_t order) { (void)order; }
+    void setDataMode(uint8_t mode) { (void)mode; }
+    void setClockDivider(uint32_t divider) { (void)divider; }
+    void setFrequency(uint32_t frequency) { (void)frequency; }
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef SIM_WIRE_H
+#define SIM_WIRE_H
+
+// Wire(I2C) 대체. 트랜잭션마다 Sim::attach()로 연결한 장치 모델에 전달하고 i2c.log에 기록한다.
+// 전송 시간(시작/주소/데이터/정지 비트 수 ÷ 버스 클럭)만큼 가상 시계가 흐른다.
+#include "Arduino.h"
+
+class TwoWire : public Stream {
+public:
+    explicit TwoWire(uint8_t busNum) : busNum(busNum) {}
+
+    bool begin();
+    bool begin(int sda, int scl, uint32_t frequency = 0);
+    bool end();
+    bool setClock(uint32_t frequency);
+    uint32_t getClock() const { return clock; }
+    void setTimeOut(uint16_t timeoutMs) { (void)timeoutMs; }
+
+    void beginTransmission(uint8_t address);
+    void beginTransmission(int address) { beginTransmission(uint8_t(address)); }
+    uint8_t endTransmission(bool sendStop = true);
+
+    size_t write(uint8_t data) override { return write(&data, 1); }
+    size_t write(const uint8_t* data, size_t length) override;
+    using Print::write;
+
+    uint8_t requestFrom(uint8_t address, uint8_t quantity, bool sendStop = true);
+    uint8_t requestFrom(int address, int quantity) { return requestFrom(uint8_t(address), uint8_t(quantity)); }
+    int available() override { return int(rxLength - rxIndex); }
+    int read() override { return rxIndex < rxLength ? rxBuffer[rxIndex++] : -1; }
+    int peek() override { return rxIndex < rxLength ? rxBuffer[rxIndex] : -1; }
+    void flush() override {}
+
+    // 마지막 begin()에 준 핀 (시나리오 확인용)
+    int getSda() const { return sdaPin; }
+    int getScl() const { return sclPin; }
+
+private:
+    static constexpr size_t BUFFER_LENGTH = 128;  // ESP32 Arduino Wire와 같은 크기
+
+    const uint8_t busNum;
+    bool started = false;
+    int sdaPin = -1;
+    int sclPin = -1;
+    uint32_t clock = 100000;
+
+    uint8_t txAddress = 0;
+    uint8_t txBuffer[BUFFER_LENGTH];
+    size_t txLength = 0;
+    bool transmitting = false;
+
+    uint8_t rxBuffer[BUFFER_LENGTH];
+    size_t rxLength = 0;
+    size_t rxIndex = 0;
+
+    // bits 만큼의 버스 시간을 가상 시계에 더한다
+    void spendBusTime(size_t bits);
+};
+
+extern TwoWire Wire;
+extern TwoWire Wire1;
+
+#endif
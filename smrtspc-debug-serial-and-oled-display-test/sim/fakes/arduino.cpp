@@ -0,0 +1,313 @@
+#include <Arduino.h>
+#include <ctype.h>
+#include "simRuntime.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// ---- 시간 ----
+
+unsigned long millis() {
+    return (unsigned long)(Sim::now() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)Sim::now();
+}
+
+void delay(uint32_t ms) {
+    Sim::advance(uint64_t(ms) * 1000);
+}
+
+void delayMicroseconds(uint32_t us) {
+    Sim::advance(us);
+}
+
+void yield() {}
+
+// ---- GPIO, ADC, PWM: 상태만 기억하고 gpio.log에 기록 ----
+
+namespace {
+
+uint8_t pinLevels[64];
+uint32_t pinDuty[64];
+bool pinPwm[64];
+uint32_t randomState = 1;
+
+}  // namespace
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    Sim::traceGpio("pinMode %u 0x%02x", pin, mode);
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin < 64) pinLevels[pin] = value ? HIGH : LOW;
+    Sim::traceGpio("digitalWrite %u %u", pin, value ? 1u : 0u);
+}
+
+int digitalRead(uint8_t pin) {
+    return pin < 64 ? pinLevels[pin] : LOW;
+}
+
+uint16_t analogRead(uint8_t pin) {
+    // 입력 장치가 없으므로 핀마다 고정된 중간값
+    return uint16_t(2048 + pin);
+}
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution) {
+    if (pin >= 64) return false;
+    pinPwm[pin] = true;
+    pinDuty[pin] = 0;
+    Sim::traceGpio("ledcAttach %u %u Hz %u bit", pin, (unsigned)freq, resolution);
+    return true;
+}
+
+bool ledcWrite(uint8_t pin, uint32_t duty) {
+    if (pin >= 64 || !pinPwm[pin]) return false;
+    if (pinDuty[pin] == duty) return true;  // 같은 값 반복은 기록하지 않음
+    pinDuty[pin] = duty;
+    Sim::traceGpio("ledcWrite %u %u", pin, (unsigned)duty);
+    return true;
+}
+
+bool ledcDetach(uint8_t pin) {
+    if (pin >= 64 || !pinPwm[pin]) return false;
+    pinPwm[pin] = false;
+    Sim::traceGpio("ledcDetach %u", pin);
+    return true;
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    if (in_max == in_min) return out_min;
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+// 결정적인 난수 (xorshift32). 같은 시드면 같은 순서
+long random(long howbig) {
+    if (howbig <= 0) return 0;
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return long(randomState % uint32_t(howbig));
+}
+
+long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) return howsmall;
+    return howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed) {
+    randomState = seed ? uint32_t(seed) : 1;
+}
+
+uint32_t EspClass::getCycleCount() {
+    // 160 MHz 기준으로 가상 시계를 환산
+    return uint32_t(Sim::now() * getCpuFreqMHz());
+}
+
+void EspClass::restart() {
+    fprintf(stderr, "[sim] ESP.restart()\n");
+    Serial.flush();
+    exit(0);
+}
+
+// ---- String ----
+
+static std::string formatInteger(unsigned long long value, unsigned base, bool negative) {
+    if (base < 2 || base > 36) base = 10;
+    char digits[72];
+    char* p = digits + sizeof(digits);
+    *--p = '\0';
+    do {
+        const unsigned digit = unsigned(value % base);
+        *--p = char(digit < 10 ? '0' + digit : 'A' + digit - 10);
+        value /= base;
+    } while (value);
+    if (negative) *--p = '-';
+    return p;
+}
+
+static std::string formatFloat(double value, unsigned decimals) {
+    char text[48];
+    snprintf(text, sizeof(text), "%.*f", int(decimals), value);
+    return text;
+}
+
+String::String(int number, unsigned char base) : String(long(number), base) {}
+String::String(unsigned int number, unsigned char base) : String((unsigned long)number, base) {}
+
+String::String(long number, unsigned char base)
+    : value(base == DEC && number < 0
+                ? formatInteger(0ULL - (unsigned long long)number, base, true)
+                : formatInteger(base == DEC ? (unsigned long long)number : (unsigned long)number, base, false)) {}
+
+String::String(unsigned long number, unsigned char base) : value(formatInteger(number, base, false)) {}
+String::String(float number, unsigned int decimals) : value(formatFloat(number, decimals)) {}
+String::String(double number, unsigned int decimals) : value(formatFloat(number, decimals)) {}
+
+bool String::equalsIgnoreCase(const String& other) const {
+    if (value.size() != other.value.size()) return false;
+    for (size_t i = 0; i < value.size(); i++) {
+        if (tolower((unsigned char)value[i]) != tolower((unsigned char)other.value[i])) return false;
+    }
+    return true;
+}
+
+bool String::endsWith(const String& suffix) const {
+    return value.size() >= suffix.value.size() &&
+           value.compare(value.size() - suffix.value.size(), suffix.value.size(), suffix.value) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    const size_t found = value.find(c, from);
+    return found == std::string::npos ? -1 : int(found);
+}
+
+int String::indexOf(const String& text, unsigned int from) const {
+    const size_t found = value.find(text.value, from);
+    return found == std::string::npos ? -1 : int(found);
+}
+
+String String::substring(unsigned int from) const {
+    return from < value.size() ? String(value.substr(from)) : String();
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= value.size()) return String();
+    return String(value.substr(from, to - from));
+}
+
+void String::trim() {
+    size_t begin = 0;
+    size_t end = value.size();
+    while (begin < end && isspace((unsigned char)value[begin])) begin++;
+    while (end > begin && isspace((unsigned char)value[end - 1])) end--;
+    value = value.substr(begin, end - begin);
+}
+
+void String::toUpperCase() {
+    for (char& c : value) c = char(toupper((unsigned char)c));
+}
+
+void String::toLowerCase() {
+    for (char& c : value) c = char(tolower((unsigned char)c));
+}
+
+// ---- Print ----
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    while (size--) written += write(*buffer++);
+    return written;
+}
+
+size_t Print::printNumber(unsigned long long number, int base, bool negative) {
+    const std::string text = formatInteger(number, unsigned(base), negative);
+    return write(text.c_str(), text.size());
+}
+
+size_t Print::print(long number, int base) {
+    if (base == DEC && number < 0) return printNumber(0ULL - (unsigned long long)number, base, true);
+    return printNumber(base == DEC ? (unsigned long long)number : (unsigned long)number, base, false);
+}
+
+size_t Print::print(unsigned long number, int base) {
+    return printNumber(number, base, false);
+}
+
+size_t Print::print(long long number, int base) {
+    if (base == DEC && number < 0) return printNumber(0ULL - (unsigned long long)number, base, true);
+    return printNumber((unsigned long long)number, base, false);
+}
+
+size_t Print::print(unsigned long long number, int base) {
+    return printNumber(number, base, false);
+}
+
+size_t Print::print(double number, int digits) {
+    const std::string text = formatFloat(number, unsigned(digits < 0 ? 0 : digits));
+    return write(text.c_str(), text.size());
+}
+
+size_t Print::printf(const char* format, ...) {
+    char stackBuffer[128];
+    va_list args;
+    va_start(args, format);
+    va_list copy;
+    va_copy(copy, args);
+    const int length = vsnprintf(stackBuffer, sizeof(stackBuffer), format, copy);
+    va_end(copy);
+
+    size_t written = 0;
+    if (length < 0) {
+        written = 0;
+    } else if (size_t(length) < sizeof(stackBuffer)) {
+        written = write((const uint8_t*)stackBuffer, size_t(length));
+    } else {
+        std::string heapBuffer(size_t(length) + 1, '\0');
+        vsnprintf(&heapBuffer[0], heapBuffer.size(), format, args);
+        written = write((const uint8_t*)heapBuffer.data(), size_t(length));
+    }
+    va_end(args);
+    return written;
+}
+
+// ---- Stream ----
+
+int Stream::timedRead() {
+    const uint64_t start = Sim::now();
+    do {
+        const int c = read();
+        if (c >= 0) return c;
+        Sim::advance(1000);
+    } while (Sim::now() - start < uint64_t(timeout) * 1000);
+    return -1;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        const int c = timedRead();
+        if (c < 0) break;
+        buffer[count++] = char(c);
+    }
+    return count;
+}
+
+String Stream::readString() {
+    String text;
+    int c;
+    while ((c = timedRead()) >= 0) text += char(c);
+    return text;
+}
+
+String Stream::readStringUntil(char terminator) {
+    String text;
+    int c;
+    while ((c = timedRead()) >= 0 && c != terminator) text += char(c);
+    return text;
+}
+
+// ---- Serial ----
+
+int HardwareSerial::available() {
+    return Sim::serialAvailable();
+}
+
+int HardwareSerial::read() {
+    return Sim::serialRead(true);
+}
+
+int HardwareSerial::peek() {
+    return Sim::serialRead(false);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    Sim::writeSerial(buffer, size);
+    return size;
+}
+
+void HardwareSerial::flush() {
+    fflush(stdout);
+}
@@ -0,0 +1,211 @@
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include "simRuntime.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+struct SimTask {
+    std::string name;
+    TaskFunction_t function;
+    void* parameters;
+    UBaseType_t priority;
+    uint32_t stackDepth;
+    uint32_t notifications;
+};
+
+// FreeRTOS처럼 저장 공간은 만들 때 한 번만 잡는 고리 버퍼 (보내고 받을 때 할당 없음)
+struct SimQueue {
+    UBaseType_t length;
+    UBaseType_t itemSize;
+    std::vector<uint8_t> storage;  // length * itemSize (세마포어는 비어 있음)
+    UBaseType_t head;              // 맨 앞 항목 위치
+    UBaseType_t count;
+
+    uint8_t* slot(UBaseType_t index) { return storage.data() + size_t((head + index) % length) * itemSize; }
+};
+
+namespace {
+
+// 시나리오 코드(setup/loop)가 도는 "태스크"
+SimTask mainTask{"loopTask", nullptr, nullptr, 1, 8192, 0};
+
+uint64_t ticksToMicros(TickType_t ticks) {
+    return uint64_t(ticks) * portTICK_PERIOD_MS * 1000;
+}
+
+// 단일 스레드에서는 기다려도 상태가 바뀌지 않는다. 유한 대기는 시간만 보내고 실패, 무한 대기는 교착
+BaseType_t wouldBlock(const char* what, TickType_t ticksToWait) {
+    if (ticksToWait == portMAX_DELAY) {
+        fprintf(stderr, "[sim] %s would block forever (no other task runs in the simulation)\n", what);
+        abort();
+    }
+    Sim::advance(ticksToMicros(ticksToWait));
+    return pdFALSE;
+}
+
+}  // namespace
+
+// ---- 태스크 ----
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stackDepth,
+                       void* parameters, UBaseType_t priority, TaskHandle_t* createdTask) {
+    SimTask* task = new SimTask{name ? name : "", function, parameters, priority, stackDepth, 0};
+    if (createdTask) *createdTask = task;
+    fprintf(stderr, "[sim] task \"%s\" registered (not scheduled)\n", task->name.c_str());
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth,
+                                   void* parameters, UBaseType_t priority, TaskHandle_t* createdTask,
+                                   BaseType_t) {
+    return xTaskCreate(function, name, stackDepth, parameters, priority, createdTask);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if (task && task != &mainTask) delete task;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    Sim::advance(ticksToMicros(ticks));
+}
+
+BaseType_t xTaskDelayUntil(TickType_t* previousWakeTime, TickType_t increment) {
+    const TickType_t wake = *previousWakeTime + increment;
+    const bool delayed = ticksToMicros(wake) > Sim::now();
+    Sim::advanceTo(ticksToMicros(wake));
+    *previousWakeTime = wake;
+    return delayed ? pdTRUE : pdFALSE;
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return TickType_t(Sim::now() / (portTICK_PERIOD_MS * 1000));
+}
+
+void taskYIELD(void) {}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return &mainTask;
+}
+
+const char* pcTaskGetName(TaskHandle_t task) {
+    return (task ? task : &mainTask)->name.c_str();
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task) {
+    return (task ? task : &mainTask)->priority;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    // 호스트 스택은 측정할 수 없으므로 할당 크기를 그대로 돌려준다
+    return (task ? task : &mainTask)->stackDepth;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (task) task->notifications++;
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken) {
+    xTaskNotifyGive(task);
+    if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdFALSE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait) {
+    SimTask* task = xTaskGetCurrentTaskHandle();
+    if (task->notifications == 0) {
+        wouldBlock("ulTaskNotifyTake", ticksToWait);
+        return 0;
+    }
+    const uint32_t count = task->notifications;
+    task->notifications = clearCountOnExit ? 0 : count - 1;
+    return count;
+}
+
+// ---- 큐 ----
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    if (length == 0) return nullptr;
+    return new SimQueue{length, itemSize, std::vector<uint8_t>(size_t(length) * itemSize), 0, 0};
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+static BaseType_t queuePut(QueueHandle_t queue, const void* item, TickType_t ticksToWait, bool front) {
+    if (!queue) return pdFAIL;
+    if (queue->count >= queue->length) return wouldBlock("xQueueSend", ticksToWait);
+
+    if (front) queue->head = (queue->head + queue->length - 1) % queue->length;
+    uint8_t* target = front ? queue->slot(0) : queue->slot(queue->count);
+    if (queue->itemSize) memcpy(target, item, queue->itemSize);
+    queue->count++;
+    return pdPASS;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticksToWait) {
+    return queuePut(queue, item, ticksToWait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t ticksToWait) {
+    return queuePut(queue, item, ticksToWait, true);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item) {
+    if (!queue) return pdFAIL;
+    queue->count = 0;
+    return queuePut(queue, item, 0, false);
+}
+
+static BaseType_t queueGet(QueueHandle_t queue, void* item, TickType_t ticksToWait, bool remove) {
+    if (!queue) return pdFAIL;
+    if (queue->count == 0) return wouldBlock("xQueueReceive", ticksToWait);
+
+    if (queue->itemSize && item) memcpy(item, queue->slot(0), queue->itemSize);
+    if (remove) {
+        queue->head = (queue->head + 1) % queue->length;
+        queue->count--;
+    }
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticksToWait) {
+    return queueGet(queue, item, ticksToWait, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void* item, TickType_t ticksToWait) {
+    return queueGet(queue, item, ticksToWait, false);
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    return queue ? queue->count : 0;
+}
+
+// ---- 세마포어 (크기 0 항목의 큐) ----
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount) {
+    QueueHandle_t queue = xQueueCreate(maxCount, 0);
+    if (queue) queue->count = initialCount < maxCount ? initialCount : maxCount;
+    return queue;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    return xSemaphoreCreateCounting(1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void) {
+    return xSemaphoreCreateCounting(1, 0);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait) {
+    return queueGet(semaphore, nullptr, ticksToWait, true);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return queuePut(semaphore, nullptr, 0, false);
+}
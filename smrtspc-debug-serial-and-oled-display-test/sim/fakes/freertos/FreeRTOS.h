@@ -0,0 +1,44 @@
+#ifndef SIM_FREERTOS_H
+#define SIM_FREERTOS_H
+
+// FreeRTOS 대체 (단일 스레드). 틱은 1 ms, 시간은 가상 시계를 따른다.
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef struct SimTask* TaskHandle_t;
+typedef struct SimQueue* QueueHandle_t;
+typedef QueueHandle_t SemaphoreHandle_t;
+
+#define pdFALSE   ((BaseType_t)0)
+#define pdTRUE    ((BaseType_t)1)
+#define pdFAIL    pdFALSE
+#define pdPASS    pdTRUE
+
+#define configTICK_RATE_HZ    1000
+#define configMAX_PRIORITIES  25
+#define portTICK_PERIOD_MS    ((TickType_t)1000 / configTICK_RATE_HZ)
+#define portMAX_DELAY         ((TickType_t)0xffffffffUL)
+#define pdMS_TO_TICKS(ms)     ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000))
+#define tskIDLE_PRIORITY      ((UBaseType_t)0)
+#define tskNO_AFFINITY        0x7FFFFFFF
+
+// 임계 구역: 다른 스레드가 없으므로 아무것도 하지 않는다
+typedef struct {
+    uint32_t owner;
+    uint32_t count;
+} portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0, 0}
+#define portENTER_CRITICAL(mux)      ((void)(mux))
+#define portEXIT_CRITICAL(mux)       ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux)  ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux)   ((void)(mux))
+#define portYIELD_FROM_ISR(...)      ((void)0)
+#define xPortInIsrContext()          pdFALSE
+
+#endif
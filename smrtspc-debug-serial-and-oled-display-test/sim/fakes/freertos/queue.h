@@ -0,0 +1,19 @@
+#ifndef SIM_FREERTOS_QUEUE_H
+#define SIM_FREERTOS_QUEUE_H
+
+#include "FreeRTOS.h"
+
+// 큐 대체. 기다려야 하는 상황(가득 참/비어 있음)에서는 기다린 만큼 가상 시계를 보내고 실패한다.
+// portMAX_DELAY로 기다리면 단일 스레드에서는 영원히 풀리지 않으므로 오류를 찍고 종료한다.
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticksToWait);
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t ticksToWait);
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticksToWait);
+BaseType_t xQueuePeek(QueueHandle_t queue, void* item, TickType_t ticksToWait);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+#define xQueueSendToBack xQueueSend
+#define xQueueSendFromISR(queue, item, woken) xQueueSend(queue, item, 0)
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef SIM_FREERTOS_SEMPHR_H
+#define SIM_FREERTOS_SEMPHR_H
+
+#include "queue.h"
+
+// 세마포어/뮤텍스 대체 (길이 1, 크기 0 큐와 같은 동작)
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+#define xSemaphoreGiveFromISR(semaphore, woken) xSemaphoreGive(semaphore)
+#define vSemaphoreDelete(semaphore) vQueueDelete(semaphore)
+
+#endif
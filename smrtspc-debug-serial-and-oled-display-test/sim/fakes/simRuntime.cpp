@@ -0,0 +1,223 @@
+#include "simRuntime.h"
+#include <esp_timer.h>
+#include <stdarg.h>
+#include <deque>
+#include <filesystem>
+#include <vector>
+
+namespace {
+
+struct Files {
+    std::string dir = ".";
+    FILE* serial = nullptr;
+    FILE* i2c = nullptr;
+    FILE* gpio = nullptr;
+};
+
+Files files;
+bool tracing = true;
+uint64_t clockMicros = 0;
+Sim::I2cDevice* devices[128] = {};
+std::deque<uint8_t> serialInput;
+
+void closeFile(FILE*& file) {
+    if (file) fclose(file);
+    file = nullptr;
+}
+
+void traceLine(FILE* file, const char* format, va_list args) {
+    if (!tracing || !file) return;
+    fprintf(file, "%10llu ", (unsigned long long)clockMicros);
+    vfprintf(file, format, args);
+    fputc('\n', file);
+}
+
+}  // namespace
+
+// ---- esp_timer (가상 시계 위에서 동작) ----
+
+struct esp_timer {
+    esp_timer_cb_t callback;
+    void* arg;
+    uint64_t period;    // 0 = 한 번
+    uint64_t due;
+    bool active;
+};
+
+namespace {
+
+std::vector<esp_timer*> timers;
+
+// target까지 만기된 타이머를 시간 순서대로 실행
+void runTimersUntil(uint64_t target) {
+    while (true) {
+        esp_timer* next = nullptr;
+        for (esp_timer* timer : timers) {
+            if (timer->active && timer->due <= target && (!next || timer->due < next->due)) next = timer;
+        }
+        if (!next) break;
+
+        if (next->due > clockMicros) clockMicros = next->due;
+        if (next->period) {
+            next->due += next->period;
+        } else {
+            next->active = false;
+        }
+        next->callback(next->arg);
+    }
+    if (target > clockMicros) clockMicros = target;
+}
+
+}  // namespace
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out) {
+    if (!args || !args->callback || !out) return ESP_ERR_INVALID_ARG;
+    esp_timer* timer = new esp_timer{args->callback, args->arg, 0, 0, false};
+    timers.push_back(timer);
+    *out = timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period) {
+    if (!timer || period == 0) return ESP_ERR_INVALID_ARG;
+    if (timer->active) return ESP_ERR_INVALID_STATE;
+    timer->period = period;
+    timer->due = clockMicros + period;
+    timer->active = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout) {
+    if (!timer) return ESP_ERR_INVALID_ARG;
+    if (timer->active) return ESP_ERR_INVALID_STATE;
+    timer->period = 0;
+    timer->due = clockMicros + timeout;
+    timer->active = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (!timer) return ESP_ERR_INVALID_ARG;
+    if (!timer->active) return ESP_ERR_INVALID_STATE;
+    timer->active = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    if (!timer) return ESP_ERR_INVALID_ARG;
+    if (timer->active) return ESP_ERR_INVALID_STATE;
+    for (size_t i = 0; i < timers.size(); i++) {
+        if (timers[i] == timer) {
+            timers.erase(timers.begin() + long(i));
+            break;
+        }
+    }
+    delete timer;
+    return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer) {
+    return timer && timer->active;
+}
+
+int64_t esp_timer_get_time() {
+    return int64_t(clockMicros);
+}
+
+namespace Sim {
+
+bool begin(const char* outputDir) {
+    end();
+    files.dir = outputDir && *outputDir ? outputDir : ".";
+
+    std::error_code error;
+    std::filesystem::create_directories(files.dir, error);
+    if (error) {
+        fprintf(stderr, "[sim] cannot create %s: %s\n", files.dir.c_str(), error.message().c_str());
+        return false;
+    }
+
+    files.serial = fopen(outputPath("serial.log").c_str(), "w");
+    files.i2c = fopen(outputPath("i2c.log").c_str(), "w");
+    files.gpio = fopen(outputPath("gpio.log").c_str(), "w");
+    return files.serial && files.i2c && files.gpio;
+}
+
+void end() {
+    closeFile(files.serial);
+    closeFile(files.i2c);
+    closeFile(files.gpio);
+}
+
+std::string outputPath(const char* name) {
+    return files.dir + "/" + name;
+}
+
+void setTracing(bool enabled) {
+    tracing = enabled;
+}
+
+bool isTracing() {
+    return tracing;
+}
+
+uint64_t now() {
+    return clockMicros;
+}
+
+void advance(uint64_t micros) {
+    runTimersUntil(clockMicros + micros);
+}
+
+void advanceTo(uint64_t micros) {
+    if (micros > clockMicros) runTimersUntil(micros);
+}
+
+void attach(uint8_t address, I2cDevice* device) {
+    if (address < 128) devices[address] = device;
+}
+
+void detach(uint8_t address) {
+    if (address < 128) devices[address] = nullptr;
+}
+
+I2cDevice* deviceAt(uint8_t address) {
+    return address < 128 ? devices[address] : nullptr;
+}
+
+void feedSerial(const char* text) {
+    while (text && *text) serialInput.push_back(uint8_t(*text++));
+}
+
+// HardwareSerial이 읽는 입력 큐 (arduino.cpp)
+int serialAvailable() {
+    return int(serialInput.size());
+}
+
+int serialRead(bool consume) {
+    if (serialInput.empty()) return -1;
+    const int c = serialInput.front();
+    if (consume) serialInput.pop_front();
+    return c;
+}
+
+void traceI2c(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    traceLine(files.i2c, format, args);
+    va_end(args);
+}
+
+void traceGpio(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    traceLine(files.gpio, format, args);
+    va_end(args);
+}
+
+void writeSerial(const uint8_t* data, size_t length) {
+    fwrite(data, 1, length, stdout);
+    if (tracing && files.serial) fwrite(data, 1, length, files.serial);
+}
+
+}  // namespace Sim
@@ -0,0 +1,85 @@
+#ifndef SIM_RUNTIME_H
+#define SIM_RUNTIME_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string>
+
+// 호스트 시뮬레이션 공통 상태: 가상 시계, I2C 장치 모델, 기록 파일.
+//
+//  - 가상 시계: micros()/millis()/esp_timer_get_time()이 읽는 시간. delay(), vTaskDelay(),
+//    I2C 전송(바이트 수와 버스 클럭으로 계산한 시간)만 시계를 앞으로 보낸다.
+//    시계가 지나가는 동안 만기된 esp_timer 콜백을 시간 순서대로 부른다.
+//  - 태스크: 단일 스레드로 돌기 때문에 xTaskCreate()는 등록만 하고 실행하지 않는다.
+//    백그라운드 태스크가 하던 일은 시나리오가 동기 API(DebugSerial::flush() 등)로 대신한다.
+//  - 기록: begin()에 준 폴더에 serial.log(시리얼 출력), i2c.log(트랜잭션), gpio.log(핀, PWM, 장치 모델 상태)를
+//    남긴다. 시각은 모두 가상 시계 기준(us)이라 실행할 때마다 같다.
+namespace Sim {
+
+// Wire에 붙는 장치 모델. write()는 한 번의 쓰기 트랜잭션(주소 뒤의 바이트들)을 받는다.
+class I2cDevice {
+public:
+    virtual ~I2cDevice() = default;
+
+    // 반환값은 Wire.endTransmission()과 같은 코드 (0 = ACK, 3 = 데이터 NACK)
+    virtual uint8_t write(const uint8_t* data, size_t length) = 0;
+
+    // requestFrom()으로 읽을 바이트. 채운 바이트 수를 반환
+    virtual size_t read(uint8_t* out, size_t length) {
+        (void)out;
+        (void)length;
+        return 0;
+    }
+};
+
+// 출력 폴더를 만들고 기록 파일을 연다 (폴더는 없으면 만든다)
+bool begin(const char* outputDir);
+void end();
+
+// 출력 폴더 안의 파일 경로
+std::string outputPath(const char* name);
+
+// 기록 끄기/켜기 (벤치마크 반복 중 파일 I/O 제외용)
+void setTracing(bool enabled);
+bool isTracing();
+
+// 가상 시계
+uint64_t now();
+void advance(uint64_t micros);
+void advanceTo(uint64_t micros);
+
+// I2C 장치 연결. 장치가 없는 주소로 보내면 endTransmission()이 2(주소 NACK)를 반환한다
+void attach(uint8_t address, I2cDevice* device);
+void detach(uint8_t address);
+I2cDevice* deviceAt(uint8_t address);
+
+// Serial로 읽힐 입력 (시리얼 모니터에 입력한 것처럼)
+void feedSerial(const char* text);
+int serialAvailable();
+int serialRead(bool consume);  // 없으면 -1, consume = false면 peek
+
+// 기록 파일에 한 줄 (타임스탬프는 붙여준다). 기록이 꺼져 있으면 무시
+void traceI2c(const char* format, ...) __attribute__((format(printf, 1, 2)));
+void traceGpio(const char* format, ...) __attribute__((format(printf, 1, 2)));
+void writeSerial(const uint8_t* data, size_t length);
+
+// 1비트 이미지를 PBM(P1) 파일로 저장. pixel(x, y)가 true면 1 (켜진 픽셀)
+template <typename PixelFn>
+bool writePbm(const char* name, int width, int height, PixelFn pixel) {
+    FILE* file = fopen(outputPath(name).c_str(), "w");
+    if (!file) return false;
+    fprintf(file, "P1\n%d %d\n", width, height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            fputc(pixel(x, y) ? '1' : '0', file);
+            fputc(x + 1 < width ? ' ' : '\n', file);
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+}  // namespace Sim
+
+#endif
@@ -0,0 +1,94 @@
+#include <Wire.h>
+#include <SPI.h>
+#include "simRuntime.h"
+
+TwoWire Wire(0);
+TwoWire Wire1(1);
+SPIClass SPI;
+
+bool TwoWire::begin() {
+    return begin(-1, -1, 0);
+}
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+    if (started) return true;
+    started = true;
+    sdaPin = sda;
+    sclPin = scl;
+    if (frequency) clock = frequency;
+    Sim::traceI2c("bus%u begin sda=%d scl=%d %u Hz", busNum, sda, scl, (unsigned)clock);
+    return true;
+}
+
+bool TwoWire::end() {
+    started = false;
+    return true;
+}
+
+bool TwoWire::setClock(uint32_t frequency) {
+    if (frequency == 0) return false;
+    if (frequency != clock) Sim::traceI2c("bus%u clock %u Hz", busNum, (unsigned)frequency);
+    clock = frequency;
+    return true;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+    txAddress = address;
+    txLength = 0;
+    transmitting = true;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t length) {
+    if (!transmitting) return 0;
+    const size_t room = BUFFER_LENGTH - txLength;
+    const size_t count = length < room ? length : room;
+    memcpy(txBuffer + txLength, data, count);
+    txLength += count;
+    return count;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+    (void)sendStop;
+    if (!transmitting) return 4;
+    transmitting = false;
+
+    uint8_t error = 4;  // 버스를 시작하지 않음
+    if (started) {
+        Sim::I2cDevice* device = Sim::deviceAt(txAddress);
+        // 시작 + 주소(9비트) + 바이트마다 9비트 + 정지. 주소 NACK이면 데이터는 보내지 않는다
+        spendBusTime(device ? 2 + 9 * (1 + txLength) : 2 + 9);
+        error = device ? device->write(txBuffer, txLength) : 2;
+    }
+
+    if (Sim::isTracing()) {
+        char hex[BUFFER_LENGTH * 3 + 1];
+        size_t used = 0;
+        for (size_t i = 0; i < txLength; i++) {
+            used += size_t(snprintf(hex + used, sizeof(hex) - used, " %02x", txBuffer[i]));
+        }
+        hex[used] = '\0';
+        Sim::traceI2c("bus%u 0x%02x %uk W%3u ->%u:%s", busNum, txAddress, (unsigned)(clock / 1000),
+                      (unsigned)txLength, error, hex);
+    }
+    return error;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, bool sendStop) {
+    (void)sendStop;
+    rxIndex = 0;
+    rxLength = 0;
+    if (!started) return 0;
+
+    Sim::I2cDevice* device = Sim::deviceAt(address);
+    if (device) {
+        const size_t wanted = quantity < BUFFER_LENGTH ? quantity : BUFFER_LENGTH;
+        rxLength = device->read(rxBuffer, wanted);
+    }
+    spendBusTime(2 + 9 * (1 + rxLength));
+    Sim::traceI2c("bus%u 0x%02x %uk R%3u", busNum, address, (unsigned)(clock / 1000), (unsigned)rxLength);
+    return uint8_t(rxLength);
+}
+
+void TwoWire::spendBusTime(size_t bits) {
+    Sim::advance((uint64_t(bits) * 1000000 + clock - 1) / clock);
+}
@@ -0,0 +1,26 @@
+#include "maqueenModel.h"
+
+uint8_t MaqueenModel::write(const uint8_t* data, size_t length) {
+    if (failuresLeft > 0) {
+        failuresLeft--;
+        return 3;  // 데이터 NACK
+    }
+    if (length == 0) return 0;
+
+    pointer = data[0];
+    for (size_t i = 1; i < length; i++) {
+        registers[pointer++ % sizeof(registers)] = data[i];
+    }
+    writes++;
+
+    Sim::traceGpio("maqueen L %c%u R %c%u", left().reverse ? '-' : '+', left().speed,
+                   right().reverse ? '-' : '+', right().speed);
+    return 0;
+}
+
+size_t MaqueenModel::read(uint8_t* out, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        out[i] = registers[pointer++ % sizeof(registers)];
+    }
+    return length;
+}
@@ -0,0 +1,32 @@
+#ifndef MAQUEEN_MODEL_H
+#define MAQUEEN_MODEL_H
+
+#include "simRuntime.h"
+
+// DFRobot Maqueen 모터 보드 모델 (I2C 0x10). 첫 바이트는 레지스터 주소이고 뒤 바이트는
+// 그 주소부터 차례로 쓴다. 0x00~0x03 = 왼쪽 방향, 왼쪽 속도, 오른쪽 방향, 오른쪽 속도.
+// failWrites()로 다음 n번의 쓰기를 NACK으로 만들어 재시도 경로를 시험할 수 있다.
+class MaqueenModel : public Sim::I2cDevice {
+public:
+    struct Wheel {
+        bool reverse;
+        uint8_t speed;
+    };
+
+    uint8_t write(const uint8_t* data, size_t length) override;
+    size_t read(uint8_t* out, size_t length) override;
+
+    void failWrites(uint8_t count) { failuresLeft = count; }
+
+    Wheel left() const { return {bool(registers[0] & 0x01), registers[1]}; }
+    Wheel right() const { return {bool(registers[2] & 0x01), registers[3]}; }
+    uint32_t getWrites() const { return writes; }
+
+private:
+    uint8_t registers[32] = {};
+    uint8_t pointer = 0;
+    uint8_t failuresLeft = 0;
+    uint32_t writes = 0;
+};
+
+#endif
@@ -0,0 +1,88 @@
+// maqueenWheelManager + DebugSerial 시뮬레이션 시나리오.
+// 모터 보드 모델이 NACK을 내도록 해서 재시도/실패 경로까지 지나간다.
+// 상태 LED(StatusLed)는 esp_timer 콜백으로 재생되므로 gpio.log에 PWM 값이 남는다.
+//   sim_maqueen [출력 폴더]   -> serial.log, i2c.log, gpio.log
+
+#include <Arduino.h>
+#include "DebugSerial.h"
+#include "maqueenWheelManager.h"
+#include "maqueenModel.h"
+
+namespace {
+
+constexpr uint8_t MAQUEEN_ADDRESS = 0x10;
+constexpr int LED_PIN = 8;
+
+MaqueenModel board;
+
+const char* stateName(MotorState state) {
+    switch (state) {
+        case MotorState::STOP: return "STOP";
+        case MotorState::FORWARD: return "FORWARD";
+        case MotorState::BACKWARD: return "BACKWARD";
+        case MotorState::TURN_LEFT: return "TURN_LEFT";
+        case MotorState::TURN_RIGHT: return "TURN_RIGHT";
+        case MotorState::ROTATE_LEFT: return "ROTATE_LEFT";
+        case MotorState::ROTATE_RIGHT: return "ROTATE_RIGHT";
+    }
+    return "?";
+}
+
+void report(const char* action, bool ok) {
+    const MaqueenModel::Wheel left = board.left();
+    const MaqueenModel::Wheel right = board.right();
+    DebugSerial::printfDebug("%-14s %s  state=%s speed=%u  board L %c%u R %c%u\n", action, ok ? "ok  " : "FAIL",
+                             stateName(Maqueen.getState()), Maqueen.getSpeed(),
+                             left.reverse ? '-' : '+', left.speed, right.reverse ? '-' : '+', right.speed);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (!Sim::begin(argc > 1 ? argv[1] : "sim-out/maqueen")) return 1;
+    Sim::attach(MAQUEEN_ADDRESS, &board);
+
+    DebugSerial::begin(115200, LED_PIN);
+    DebugSerial::waitForConnection(1000);
+    DebugSerial::printSystemInfo();
+
+    Maqueen.begin(MAQUEEN_ADDRESS);
+    report("begin", true);
+
+    report("forward 100", Maqueen.forward(100));
+    delay(500);
+    report("forward 100", Maqueen.forward(100));  // 같은 명령은 전송 생략
+    report("speed 150", Maqueen.setSpeed(150));
+    delay(500);
+    report("rotateLeft 80", Maqueen.rotateLeft(80));
+    delay(300);
+
+    board.failWrites(2);  // 재시도 안에서 성공
+    report("turnRight 120", Maqueen.turnRight(120));
+    delay(300);
+
+    board.failWrites(3);  // 재시도까지 실패
+    report("backward 90", Maqueen.backward(90));
+    report("backward 90", Maqueen.backward(90));  // 보드 상태를 모르므로 다시 전송
+
+    Sim::detach(MAQUEEN_ADDRESS);  // 선이 빠진 보드
+    report("stop (no bus)", Maqueen.stop());
+    Sim::attach(MAQUEEN_ADDRESS, &board);
+    report("stop", Maqueen.stop());
+
+    const MaqueenBusStats& stats = Maqueen.getBusStats();
+    DebugSerial::printfDebug("sent %lu, skipped %lu, retries %lu, bus errors %lu, failed %lu, last error %u\n",
+                             (unsigned long)stats.commandsSent, (unsigned long)stats.commandsSkipped,
+                             (unsigned long)stats.retries, (unsigned long)stats.busErrors,
+                             (unsigned long)stats.failedCommands, stats.lastError);
+    DebugSerial::printfDebug("latency last %lu us, max %lu us, bus busy %llu us\n",
+                             (unsigned long)stats.lastLatencyMicros, (unsigned long)stats.maxLatencyMicros,
+                             (unsigned long long)stats.busMicros);
+
+    // 백그라운드 출력 태스크가 돌지 않으므로 여기서 한 번에 내보낸다
+    delay(1000);  // LED 패턴 재생이 끝나도록
+    DebugSerial::flush();
+
+    Sim::end();
+    return 0;
+}
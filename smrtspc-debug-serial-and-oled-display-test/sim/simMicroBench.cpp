@@ -0,0 +1,52 @@
+// ex-micro-benchmark.ino 의 호스트 버전. 같은 벤치마크 목록(driverBenchSuite)을 돌린다.
+// ticks는 호스트 시간(ns), timer_ns_per_op는 가상 시계 기준이라 I2C 전송 시간만 반영된다.
+// 측정 중에는 기록 파일을 끄므로 파일 I/O는 결과에 들어가지 않는다.
+//   sim_micro_bench [출력 폴더] [반복 횟수]   -> stdout과 serial.log 에 CSV
+
+#include <Arduino.h>
+#include "miniDisplayManager.h"
+#include "maqueenWheelManager.h"
+#include "driverBenchSuite.h"
+#include "ssd1306Model.h"
+#include "maqueenModel.h"
+
+namespace {
+
+Ssd1306Model panel;
+MaqueenModel board;
+
+// 측정하는 동안 CSV를 모아 두는 Print
+class BufferPrint : public Print {
+public:
+    String text;
+    size_t write(uint8_t c) override {
+        text += char(c);
+        return 1;
+    }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (!Sim::begin(argc > 1 ? argv[1] : "sim-out/bench")) return 1;
+    const uint32_t iterations = argc > 2 ? uint32_t(strtoul(argv[2], nullptr, 10)) : 1000;
+
+    Sim::attach(0x3C, &panel);
+    Sim::attach(0x10, &board);
+
+    Serial.begin(115200);
+    Display.begin();
+    Maqueen.begin();
+
+    Serial.printf("# micro benchmark: host simulation, %lu iterations\n", (unsigned long)iterations);
+
+    // CSV는 serial.log에도 남기고, 측정 구간의 I2C/GPIO 기록만 끈다
+    BufferPrint csv;
+    Sim::setTracing(false);
+    runDriverBenchSuite(csv, iterations);
+    Sim::setTracing(true);
+    Serial.print(csv.text);
+
+    Sim::end();
+    return 0;
+}
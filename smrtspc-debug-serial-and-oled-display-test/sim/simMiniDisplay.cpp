@@ -0,0 +1,84 @@
+// miniDisplayManager 시뮬레이션 시나리오.
+// 화면을 몇 가지 그린 뒤 매번 SSD1306 모델의 보이는 영역(72x40)을 PBM으로 저장한다.
+//   sim_mini_display [출력 폴더]   -> mini_01_begin.pbm ... , serial.log, i2c.log, gpio.log
+
+#include <Arduino.h>
+#include "miniDisplayManager.h"
+#include "i2cBusManager.h"
+#include "ssd1306Model.h"
+
+namespace {
+
+constexpr uint8_t OLED_ADDRESS = 0x3C;
+
+// Ssd1306Panel72x40 = OledPanel<72, 40, 28, 24>
+constexpr int GLASS_LEFT = 28;
+constexpr int GLASS_TOP = 24;
+
+Ssd1306Model panel;
+int frameNumber = 0;
+
+void saveFrame(const char* label) {
+    char name[64];
+    snprintf(name, sizeof(name), "mini_%02d_%s.pbm", ++frameNumber, label);
+    panel.savePbm(name, GLASS_LEFT, GLASS_TOP, DisplayManager::width, DisplayManager::height);
+    Serial.printf("%-24s flush %3u bytes, %5lu us\n", name, (unsigned)Display.getLastFlushBytes(),
+                  (unsigned long)Display.getLastUpdateMicros());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (!Sim::begin(argc > 1 ? argv[1] : "sim-out/mini")) return 1;
+    Sim::attach(OLED_ADDRESS, &panel);
+
+    Serial.begin(115200);
+    Display.begin();
+    saveFrame("begin");
+
+    Display.setFont(FONT_LARGE);
+    Display.display2Lines("Hello", "World", ALIGN_CENTER);
+    saveFrame("two_lines");
+
+    Display.setFont(FONT_SMALL);
+    Display.display4Lines("Line 1", "Line 2", "Line 3", "Line 4");
+    saveFrame("four_lines");
+
+    const char* const lines[] = {"ESP32-C3", "72x40", "OLED"};
+    Display.setFont(FONT_MEDIUM);
+    Display.displayText(lines, ALIGN_CENTER);
+    saveFrame("text_center");
+
+    // 숫자만 바뀌는 화면: 바뀐 타일만 전송되는지 확인
+    Display.setFont(FONT_LARGE);
+    char count[12];
+    for (int i = 0; i <= 10; i++) {
+        snprintf(count, sizeof(count), "%d", i * 7);
+        Display.display2Lines("Count", count, ALIGN_RIGHT);
+        delay(100);
+    }
+    saveFrame("counter");
+
+    Display.clear();
+    Display.drawFrame(0, 0, DisplayManager::width, DisplayManager::height);
+    Display.drawLine(0, 0, DisplayManager::width - 1, DisplayManager::height - 1);
+    Display.drawRect(8, 8, 20, 12, true);
+    Display.drawHLine(40, 30, 24);
+    Display.drawVLine(60, 4, 20);
+    Display.update();
+    saveFrame("graphics");
+
+    const I2cDeviceStats* stats = I2cBus.getStats(OLED_ADDRESS);
+    if (stats) {
+        Serial.printf("I2C 0x%02x: %lu transactions, %lu errors, busy %llu us\n", OLED_ADDRESS,
+                      (unsigned long)stats->transactions, (unsigned long)stats->errors,
+                      (unsigned long long)stats->totalBusyMicros);
+    }
+    Serial.printf("panel: %lu data bytes, %lu command bytes\n", (unsigned long)panel.getDataBytes(),
+                  (unsigned long)panel.getCommandBytes());
+    Serial.printf("text cache: %lu hits, %lu misses\n", (unsigned long)Display.getTextCacheHits(),
+                  (unsigned long)Display.getTextCacheMisses());
+
+    Sim::end();
+    return 0;
+}
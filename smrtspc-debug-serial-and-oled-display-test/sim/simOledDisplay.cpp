@@ -0,0 +1,72 @@
+// oledDisplayManager 시뮬레이션 시나리오 (흰 배경, 검은 글자, 테두리 화면).
+//   sim_oled_display [출력 폴더]   -> oled_01_begin.pbm ... , serial.log, i2c.log, gpio.log
+
+#include <Arduino.h>
+#include "oledDisplayManager.h"
+#include "i2cBusManager.h"
+#include "ssd1306Model.h"
+
+namespace {
+
+constexpr uint8_t OLED_ADDRESS = 0x3C;
+
+// Ssd1306Panel72x40 = OledPanel<72, 40, 28, 24>
+constexpr int GLASS_LEFT = 28;
+constexpr int GLASS_TOP = 24;
+
+Ssd1306Model panel;
+int frameNumber = 0;
+
+void saveFrame(const char* label) {
+    char name[64];
+    snprintf(name, sizeof(name), "oled_%02d_%s.pbm", ++frameNumber, label);
+    panel.savePbm(name, GLASS_LEFT, GLASS_TOP, DisplayManager::width, DisplayManager::height);
+    Serial.printf("%-24s flush %3u bytes, %5lu us\n", name, (unsigned)Display.getLastFlushBytes(),
+                  (unsigned long)Display.getLastUpdateMicros());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (!Sim::begin(argc > 1 ? argv[1] : "sim-out/oled")) return 1;
+    Sim::attach(OLED_ADDRESS, &panel);
+
+    Serial.begin(115200);
+    Display.begin();
+    saveFrame("begin");
+
+    Display.display2Lines("Hello", "World", ALIGN_CENTER);
+    saveFrame("two_lines");
+
+    Display.display4Lines("Line 1", "Line 2", "Line 3", "Line 4", ALIGN_LEFT);
+    saveFrame("four_lines");
+
+    Display.display4Lines("L", "Right", "", "aligned", ALIGN_RIGHT);
+    saveFrame("four_right");
+
+    // 값 한 줄만 바뀌는 화면
+    char value[16];
+    for (int i = 0; i <= 10; i++) {
+        snprintf(value, sizeof(value), "%d.%d V", 3, i);
+        Display.display2Lines("Battery", value, ALIGN_CENTER);
+        delay(100);
+    }
+    saveFrame("battery");
+
+    Display.clear();
+    saveFrame("clear");
+
+    const I2cDeviceStats* stats = I2cBus.getStats(OLED_ADDRESS);
+    if (stats) {
+        Serial.printf("I2C 0x%02x: %lu transactions, %lu errors, busy %llu us\n", OLED_ADDRESS,
+                      (unsigned long)stats->transactions, (unsigned long)stats->errors,
+                      (unsigned long long)stats->totalBusyMicros);
+    }
+    Serial.printf("panel: %lu data bytes, %lu command bytes\n", (unsigned long)panel.getDataBytes(),
+                  (unsigned long)panel.getCommandBytes());
+    Serial.printf("text cache: %lu hits, %lu misses\n", (unsigned long)Display.getTextCacheHits(),
+                  (unsigned long)Display.getTextCacheMisses());
+
+    Sim::end();
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include "ssd1306Model.h"
+
+uint8_t Ssd1306Model::write(const uint8_t* bytes, size_t length) {
+    size_t i = 0;
+    while (i < length) {
+        const uint8_t control = bytes[i++];
+        const bool isData = control & 0x40;
+        const bool single = control & 0x80;  // Co: 다음 한 바이트 뒤에 다시 제어 바이트
+
+        const size_t end = single ? (i + 1 < length ? i + 1 : length) : length;
+        for (; i < end; i++) {
+            if (isData) {
+                data(bytes[i]);
+            } else {
+                command(bytes[i]);
+            }
+        }
+    }
+    return 0;
+}
+
+bool Ssd1306Model::pixel(int x, int y) const {
+    if (x < 0 || x >= RAM_WIDTH || y < 0 || y >= RAM_PAGES * 8) return false;
+    return ram[y / 8][x] & (1u << (y % 8));
+}
+
+bool Ssd1306Model::savePbm(const char* name, int left, int top, int width, int height) const {
+    return Sim::writePbm(name, width, height, [&](int x, int y) {
+        return displayOn && (pixel(left + x, top + y) != inverted);
+    });
+}
+
+uint8_t Ssd1306Model::argumentCount(uint8_t cmd) {
+    switch (cmd) {
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5:
+        case 0xD6: case 0xD9: case 0xDA: case 0xDB: case 0xAD:
+            return 1;
+        case 0x21: case 0x22: case 0xA3:
+            return 2;
+        case 0x29: case 0x2A:
+            return 5;
+        case 0x26: case 0x27:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+void Ssd1306Model::command(uint8_t value) {
+    commandBytes++;
+
+    if (pendingArgs > 0) {
+        args[argCount++] = value;
+        if (argCount == pendingArgs) {
+            pendingArgs = 0;
+            execute(pendingCommand, args);
+        }
+        return;
+    }
+
+    const uint8_t count = argumentCount(value);
+    if (count > 0) {
+        pendingCommand = value;
+        pendingArgs = count;
+        argCount = 0;
+        return;
+    }
+    execute(value, nullptr);
+}
+
+void Ssd1306Model::execute(uint8_t cmd, const uint8_t* params) {
+    if (cmd <= 0x0F) {
+        column = uint8_t((column & 0xF0) | cmd);
+    } else if (cmd <= 0x1F) {
+        column = uint8_t((column & 0x0F) | ((cmd & 0x0F) << 4));
+    } else if (cmd >= 0xB0 && cmd <= 0xB7) {
+        page = cmd & 0x07;
+    } else {
+        switch (cmd) {
+            case 0x20: addressingMode = params[0] & 0x03; break;
+            case 0x21:
+                columnStart = params[0] & 0x7F;
+                columnEnd = params[1] & 0x7F;
+                column = columnStart;
+                break;
+            case 0x22:
+                pageStart = params[0] & 0x07;
+                pageEnd = params[1] & 0x07;
+                page = pageStart;
+                break;
+            case 0x81: contrast = params[0]; break;
+            case 0xA6: inverted = false; break;
+            case 0xA7: inverted = true; break;
+            case 0xAE: displayOn = false; break;
+            case 0xAF: displayOn = true; break;
+            default: break;  // 타이밍, 반전 배치, 스크롤 등은 이미지에 영향 없음
+        }
+    }
+}
+
+void Ssd1306Model::data(uint8_t value) {
+    dataBytes++;
+    if (column < RAM_WIDTH) ram[page][column] = value;
+
+    if (addressingMode == 1) {
+        // 세로 모드: 페이지 먼저, 끝나면 다음 열
+        if (page >= pageEnd) {
+            page = pageStart;
+            column = column >= columnEnd ? columnStart : uint8_t(column + 1);
+        } else {
+            page++;
+        }
+        return;
+    }
+
+    if (column >= columnEnd || column >= RAM_WIDTH - 1) {
+        column = columnStart;
+        // 가로 모드는 다음 페이지로, 페이지 모드는 같은 페이지에 머문다
+        if (addressingMode == 0) page = page >= pageEnd ? pageStart : uint8_t(page + 1);
+    } else {
+        column++;
+    }
+}
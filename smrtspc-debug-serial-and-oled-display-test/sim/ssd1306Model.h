@@ -0,0 +1,58 @@
+#ifndef SSD1306_MODEL_H
+#define SSD1306_MODEL_H
+
+#include "simRuntime.h"
+
+// SSD1306 컨트롤러 모델. I2C로 받은 명령을 해석해 128x64 GRAM을 채운다.
+// 첫 바이트는 제어 바이트 (0x00 = 명령 이어짐, 0x40 = 데이터 이어짐, Co 비트 = 한 바이트만).
+// 페이지/가로/세로 주소 모드, 열/페이지 범위, 켜기/끄기, 대비, 반전을 따른다.
+// 세그먼트/COM 반전과 스크롤은 기록만 하고 GRAM 배치에는 적용하지 않는다 (u8g2 R0 기준).
+class Ssd1306Model : public Sim::I2cDevice {
+public:
+    static constexpr int RAM_WIDTH = 128;
+    static constexpr int RAM_PAGES = 8;
+
+    uint8_t write(const uint8_t* data, size_t length) override;
+
+    // GRAM 한 픽셀 (x: 0~127, y: 0~63)
+    bool pixel(int x, int y) const;
+
+    // 보이는 영역(글라스)만 PBM으로 저장. 화면이 꺼져 있으면 모두 0, 반전이면 뒤집어 저장
+    bool savePbm(const char* name, int left, int top, int width, int height) const;
+
+    bool isOn() const { return displayOn; }
+    uint8_t getContrast() const { return contrast; }
+    uint32_t getDataBytes() const { return dataBytes; }
+    uint32_t getCommandBytes() const { return commandBytes; }
+
+private:
+    uint8_t ram[RAM_PAGES][RAM_WIDTH] = {};
+
+    uint8_t addressingMode = 2;  // 리셋 후 페이지 주소 모드
+    uint8_t column = 0;
+    uint8_t page = 0;
+    uint8_t columnStart = 0;
+    uint8_t columnEnd = RAM_WIDTH - 1;
+    uint8_t pageStart = 0;
+    uint8_t pageEnd = RAM_PAGES - 1;
+
+    bool displayOn = false;
+    bool inverted = false;
+    uint8_t contrast = 0x7F;
+
+    // 인자를 받는 중인 명령
+    uint8_t pendingCommand = 0;
+    uint8_t pendingArgs = 0;
+    uint8_t args[7] = {};
+    uint8_t argCount = 0;
+
+    uint32_t dataBytes = 0;
+    uint32_t commandBytes = 0;
+
+    void command(uint8_t value);
+    void execute(uint8_t cmd, const uint8_t* params);
+    void data(uint8_t value);
+    static uint8_t argumentCount(uint8_t cmd);
+};
+
+#endif
@@ -0,0 +1,80 @@
+// miniDisplayManager의 글자 화면 API가 준비 단계(첫 그리기) 뒤에는 힙을 전혀 쓰지 않는지 확인한다.
+// display2Lines / display4Lines / displayText(배열, 포인터+개수) / printCenter 를 글꼴과 정렬을 바꿔 가며
+// 반복하고, 그 사이 malloc 계열과 operator new 호출 수(allocCounter.cpp)가 0인지 본다.
+// 카운터가 실제로 걸려 있는지는 std::vector 호환 오버로드(호출하는 쪽이 할당)로 확인한다.
+//   sim_test_display_alloc [출력 폴더] [반복 횟수]   -> 할당이 있으면 종료 코드 1
+
+#include <Arduino.h>
+#include "miniDisplayManager.h"
+#include "ssd1306Model.h"
+#include "allocCounter.h"
+
+namespace {
+
+Ssd1306Model panel;
+
+const FontSize fonts[] = {FONT_SMALL, FONT_MEDIUM, FONT_LARGE};
+const TextAlign aligns[] = {ALIGN_LEFT, ALIGN_CENTER, ALIGN_RIGHT};
+
+// 화면 한 바퀴. 숫자는 매번 바뀌게 (변경 타일 전송 경로도 타도록)
+void redraw(int round) {
+    char value[12];
+    char uptime[16];
+    snprintf(value, sizeof(value), "%d", round * 37 % 1000);
+    snprintf(uptime, sizeof(uptime), "up %ds", round);
+    const TextAlign align = aligns[round % 3];
+
+    Display.setFont(fonts[round % 3]);
+    Display.display2Lines("Temp", value, align);
+
+    Display.setFont(FONT_SMALL);
+    Display.display4Lines("ESP32-C3", value, uptime, "OK", align);
+
+    const char* const lines[] = {"BTC", value, nullptr, uptime};
+    Display.setFont(FONT_MEDIUM);
+    Display.displayText(lines, align);
+    Display.displayText(lines, 2, ALIGN_LEFT);
+
+    Display.clear();
+    Display.printCenter(value, 12);
+    Display.update();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (!Sim::begin(argc > 1 ? argv[1] : "sim-out/display-alloc")) return 1;
+    const int rounds = argc > 2 ? atoi(argv[2]) : 300;
+
+    Sim::attach(0x3C, &panel);
+    Serial.begin(115200);
+    Display.begin();
+
+    // 기록 파일 출력(경로 문자열 등)은 측정에서 뺀다
+    Sim::setTracing(false);
+
+    // 준비 단계: 지표 등록, 글꼴별 첫 그리기 등 한 번만 하는 일
+    for (int i = 0; i < 3; i++) redraw(i);
+
+    const Sim::AllocCounts before = Sim::allocCounts();
+    for (int i = 0; i < rounds; i++) redraw(i);
+    const Sim::AllocCounts after = Sim::allocCounts();
+
+    // 카운터 자체 확인: vector<string> 오버로드는 할당해야 정상
+    const Sim::AllocCounts vectorBefore = Sim::allocCounts();
+    Display.displayText(std::vector<std::string>{"vector", "overload"});
+    const Sim::AllocCounts vectorAfter = Sim::allocCounts();
+
+    Sim::setTracing(true);
+    const uint64_t steadyMallocs = after.mallocs - before.mallocs;
+    const uint64_t steadyNews = after.news - before.news;
+    const uint64_t vectorAllocs = vectorAfter.total() - vectorBefore.total();
+    Serial.printf("%d redraw rounds: %llu malloc, %llu new (vector overload: %llu)\n", rounds,
+                  (unsigned long long)steadyMallocs, (unsigned long long)steadyNews,
+                  (unsigned long long)vectorAllocs);
+
+    const bool ok = steadyMallocs == 0 && steadyNews == 0 && vectorAllocs > 0;
+    if (!ok) Serial.println(vectorAllocs == 0 ? "FAIL: allocation counter is not hooked" : "FAIL: redraw allocated");
+    Sim::end();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+// FrameFlusher 검증: 무작위 프레임을 차례로 flush()로 보낸 패널과, 같은 프레임을 매번 sendBuffer()로
+// 통째로 보낸 패널의 SSD1306 GRAM(128x64 전체)이 프레임마다 같은지 확인한다.
+// 프레임 종류: 타일 몇 개만 바뀜, 한 줄의 양 끝만 바뀜, 박스/선, 변화 없음, 전체 무작위, invalidate() 후 전체.
+//   sim_test_frame_flusher [출력 폴더] [프레임 수] [시드]   -> 다르면 종료 코드 1
+
+#include <Arduino.h>
+#include "oledPanel.h"
+#include "frameFlusher.h"
+#include "ssd1306Model.h"
+
+namespace {
+
+using Panel = Ssd1306Panel72x40;
+using Flusher = FrameFlusher<Panel::tileWidth, Panel::tileHeight>;
+
+constexpr uint8_t FLUSH_ADDRESS = 0x3C;
+constexpr uint8_t REFERENCE_ADDRESS = 0x3D;
+
+Ssd1306Model flushedModel;
+Ssd1306Model referenceModel;
+Panel flushed(U8G2_R0, U8X8_PIN_NONE, 6, 5);
+Panel reference(U8G2_R0, U8X8_PIN_NONE, 6, 5);
+Flusher flusher;
+
+uint32_t rngState = 1;
+
+// xorshift32 (시드가 같으면 같은 프레임 순서)
+uint32_t nextRandom() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+int randomBelow(int limit) { return int(nextRandom() % uint32_t(limit)); }
+
+void mutateFrame(uint8_t* frame, uint32_t kind) {
+    const size_t rowBytes = size_t(Panel::tileWidth) * 8;
+    switch (kind) {
+        case 0: {  // 타일 몇 개의 바이트 몇 개
+            const int changes = 1 + randomBelow(4);
+            for (int i = 0; i < changes; i++) frame[randomBelow(int(Flusher::frameSize))] ^= uint8_t(nextRandom() | 1);
+            break;
+        }
+        case 1: {  // 같은 타일 행의 첫 타일과 마지막 타일 (가운데는 그대로 다시 보내야 함)
+            uint8_t* row = frame + size_t(randomBelow(Panel::tileHeight)) * rowBytes;
+            row[randomBelow(8)] ^= 0x81;
+            row[rowBytes - 1 - randomBelow(8)] ^= 0x18;
+            break;
+        }
+        case 2: {  // 그리기 API로 박스와 선
+            flushed.setDrawColor(uint8_t(randomBelow(3)));
+            flushed.drawBox(int16_t(randomBelow(Panel::width)), int16_t(randomBelow(Panel::height)),
+                            int16_t(1 + randomBelow(24)), int16_t(1 + randomBelow(16)));
+            flushed.setDrawColor(2);
+            flushed.drawLine(int16_t(randomBelow(Panel::width)), int16_t(randomBelow(Panel::height)),
+                             int16_t(randomBelow(Panel::width)), int16_t(randomBelow(Panel::height)));
+            break;
+        }
+        case 3:  // 변화 없음
+            break;
+        default:  // 전체 무작위
+            for (size_t i = 0; i < Flusher::frameSize; i++) frame[i] = uint8_t(nextRandom());
+            break;
+    }
+}
+
+// 첫 번째 다른 픽셀을 찾으면 false
+bool sameGram(int frameIndex) {
+    for (int y = 0; y < Ssd1306Model::RAM_PAGES * 8; y++) {
+        for (int x = 0; x < Ssd1306Model::RAM_WIDTH; x++) {
+            if (flushedModel.pixel(x, y) != referenceModel.pixel(x, y)) {
+                Sim::setTracing(true);
+                Serial.printf("frame %d: GRAM differs at (%d, %d): flush %d, sendBuffer %d\n", frameIndex, x, y,
+                              flushedModel.pixel(x, y), referenceModel.pixel(x, y));
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (!Sim::begin(argc > 1 ? argv[1] : "sim-out/frame-flusher")) return 1;
+    const int frames = argc > 2 ? atoi(argv[2]) : 2000;
+    rngState = argc > 3 ? uint32_t(strtoul(argv[3], nullptr, 0)) : 0x1306u;
+    if (rngState == 0) rngState = 1;
+
+    Sim::attach(FLUSH_ADDRESS, &flushedModel);
+    Sim::attach(REFERENCE_ADDRESS, &referenceModel);
+    Sim::setTracing(false);
+    Serial.begin(115200);
+
+    reference.setI2CAddress(REFERENCE_ADDRESS << 1);
+    flushed.begin();
+    reference.begin();
+
+    uint8_t* frame = flushed.getBufferPtr();
+    size_t sentBytes = 0;
+    size_t skippedFrames = 0;
+
+    for (int i = 0; i < frames; i++) {
+        const uint32_t kind = nextRandom() % 6;
+        mutateFrame(frame, kind);
+        if (randomBelow(50) == 0) flusher.invalidate();
+
+        const size_t sent = flusher.flush(flushed.getU8x8(), frame);
+        sentBytes += sent;
+        if (sent == 0) skippedFrames++;
+
+        memcpy(reference.getBufferPtr(), frame, Flusher::frameSize);
+        reference.sendBuffer();
+
+        if (!sameGram(i)) {
+            Sim::end();
+            return 1;
+        }
+    }
+
+    Sim::setTracing(true);
+    Serial.printf("%d frames match: flush sent %lu bytes (sendBuffer %lu), %lu frames unchanged\n", frames,
+                  (unsigned long)sentBytes, (unsigned long)(Flusher::frameSize * size_t(frames)),
+                  (unsigned long)skippedFrames);
+    Sim::end();
+    return 0;
+}
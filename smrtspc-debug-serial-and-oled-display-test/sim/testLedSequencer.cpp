@@ -0,0 +1,159 @@
+// LedSequencer(하드웨어 없는 LED 패턴 계산) 검증. tick()에 경과 시간을 넘기며 밝기를 확인한다.
+//  - 깜빡임: 켜짐/꺼짐 경계, 한 번의 tick()이 주기 경계를 넘는 경우, 횟수를 채운 뒤 꺼짐
+//  - 무한 패턴(times = 0): 다음 패턴이 들어오면 현재 주기를 마친 뒤 남은 시간을 넘겨 시작
+//  - PULSE/BREATHE: 삼각파/제곱 곡선 값과 peak 배율
+//  - 큐가 가득 차거나 주기가 0인 패턴은 거부
+//  - isIdle() / clear()
+//   sim_test_led_sequencer [출력 폴더]   -> 실패가 있으면 종료 코드 1
+
+#include <Arduino.h>
+#include "ledSequencer.h"
+#include "simRuntime.h"
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const char* what, long actual, long expected) {
+    if (condition) return;
+    failures++;
+    Serial.printf("FAIL: %s (got %ld, expected %ld)\n", what, actual, expected);
+}
+
+void expectLevel(LedSequencer& sequencer, uint32_t elapsedMs, uint8_t expected, const char* what) {
+    const uint8_t level = sequencer.tick(elapsedMs);
+    check(level == expected, what, level, expected);
+    check(sequencer.getLevel() == level, "getLevel() must match tick()", sequencer.getLevel(), level);
+}
+
+void testBlink() {
+    LedSequencer sequencer;
+    check(sequencer.isIdle(), "new sequencer is idle", 0, 1);
+    check(sequencer.blink(2, 100, 50, 200), "blink accepted", 0, 1);
+    check(!sequencer.isIdle(), "queued pattern is not idle", 1, 0);
+
+    // 주기 150ms: 0~99 켜짐, 100~149 꺼짐
+    expectLevel(sequencer, 0, 200, "blink starts on");
+    expectLevel(sequencer, 99, 200, "blink on until onMs");
+    expectLevel(sequencer, 1, 0, "blink off at onMs");
+    expectLevel(sequencer, 49, 0, "blink off until period end");
+    expectLevel(sequencer, 1, 200, "second cycle starts on");
+    // 한 번에 경계 두 개(꺼짐, 횟수 끝)를 넘으면 꺼지고 끝난다
+    expectLevel(sequencer, 160, 0, "blink finished after 2 cycles");
+    check(sequencer.isIdle(), "idle after the last cycle", 0, 1);
+    expectLevel(sequencer, 1000, 0, "idle stays off");
+
+    // 긴 tick(): 260ms = 한 주기 + 110ms -> 두 번째 주기의 꺼짐 구간
+    sequencer.blink(3, 100, 50);
+    expectLevel(sequencer, 260, 0, "long tick lands in second cycle off phase");
+    expectLevel(sequencer, 40, 255, "long tick carries the remainder into the third cycle");
+}
+
+void testInfiniteHandover() {
+    LedSequencer sequencer;
+    sequencer.blink(0, 100, 100);
+    expectLevel(sequencer, 0, 255, "infinite blink on");
+    // 다음 패턴이 없으면 계속 반복
+    for (int cycle = 0; cycle < 20; cycle++) {
+        expectLevel(sequencer, 150, 0, "infinite blink off phase");
+        expectLevel(sequencer, 50, 255, "infinite blink repeats");
+    }
+    check(!sequencer.isIdle(), "infinite pattern never goes idle", 1, 0);
+
+    expectLevel(sequencer, 150, 0, "off phase before handover");
+    sequencer.pulse(1, 200);
+    // 현재 주기(200ms)를 마칠 때까지는 깜빡임 유지
+    expectLevel(sequencer, 30, 0, "queued pattern waits for the cycle end");
+    // 180 + 40 = 220 -> 새 패턴 20ms 지점: 20 * 255 / 100
+    expectLevel(sequencer, 40, 51, "pulse starts with the carried remainder");
+    expectLevel(sequencer, 180, 0, "pulse ends after one cycle");
+    check(sequencer.isIdle(), "idle after the handed-over pattern", 0, 1);
+}
+
+void testRamps() {
+    LedSequencer pulse;
+    pulse.pulse(1, 200, 128);
+    // 삼각파: 절반(100ms)에서 최대, peak 128로 배율
+    expectLevel(pulse, 0, 0, "pulse starts dark");
+    expectLevel(pulse, 50, 63, "pulse quarter: 127 * 128 / 255");
+    expectLevel(pulse, 50, 128, "pulse peak scaled to 128");
+    expectLevel(pulse, 50, 63, "pulse falls symmetrically");
+    expectLevel(pulse, 49, 1, "pulse near the end");
+
+    LedSequencer breathe;
+    breathe.breathe(1, 200);
+    expectLevel(breathe, 0, 0, "breathe starts dark");
+    expectLevel(breathe, 50, 63, "breathe quarter: 127^2 / 255");
+    expectLevel(breathe, 50, 255, "breathe peak");
+    expectLevel(breathe, 25, 143, "breathe 3/4 up: 191^2 / 255");
+
+    LedSequencer scaled;
+    scaled.breathe(1, 200, 100);
+    expectLevel(scaled, 100, 100, "breathe peak scaled to 100");
+    expectLevel(scaled, 50, 24, "breathe quarter scaled: 63 * 100 / 255");
+
+    // 값이 계속 단조롭게 올라갔다 내려가는지 (1ms 단위)
+    LedSequencer sweep;
+    sweep.breathe(1, 400);
+    uint8_t previous = sweep.tick(0);
+    bool monotonic = true;
+    for (uint32_t t = 1; t < 400; t++) {
+        const uint8_t level = sweep.tick(1);
+        if (t <= 200 ? level < previous : level > previous) monotonic = false;
+        previous = level;
+    }
+    check(monotonic, "breathe rises then falls monotonically", monotonic, 1);
+}
+
+void testRejects() {
+    LedSequencer sequencer;
+    check(!sequencer.blink(1, 0, 0), "zero-length blink rejected", 1, 0);
+    check(!sequencer.pulse(1, 0), "zero-length pulse rejected", 1, 0);
+    check(!sequencer.breathe(1, 0), "zero-length breathe rejected", 1, 0);
+    check(sequencer.isIdle(), "rejected patterns are not queued", 0, 1);
+
+    int accepted = 0;
+    for (int i = 0; i < LedSequencer::queueCapacity; i++) accepted += sequencer.blink(1, 10, 10);
+    check(accepted == LedSequencer::queueCapacity, "queue accepts capacity patterns", accepted,
+          LedSequencer::queueCapacity);
+    check(!sequencer.blink(1, 10, 10), "full queue rejects", 1, 0);
+
+    // 하나를 꺼내 재생하면 한 칸이 빈다
+    sequencer.tick(0);
+    check(sequencer.blink(1, 10, 10), "slot freed after a pattern starts", 0, 1);
+    check(!sequencer.blink(1, 10, 10), "full again", 1, 0);
+}
+
+void testClear() {
+    LedSequencer sequencer;
+    sequencer.blink(0, 100, 100);
+    sequencer.pulse(3, 200);
+    expectLevel(sequencer, 10, 255, "playing before clear");
+
+    sequencer.clear();
+    check(sequencer.isIdle(), "idle after clear", 0, 1);
+    check(sequencer.getLevel() == 0, "level 0 after clear", sequencer.getLevel(), 0);
+    expectLevel(sequencer, 500, 0, "nothing plays after clear");
+
+    // clear 뒤 새 패턴은 처음부터
+    sequencer.blink(1, 100, 100, 77);
+    expectLevel(sequencer, 0, 77, "new pattern after clear starts from phase 0");
+    expectLevel(sequencer, 100, 0, "new pattern off phase");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (!Sim::begin(argc > 1 ? argv[1] : "sim-out/led-sequencer")) return 1;
+    Serial.begin(115200);
+
+    testBlink();
+    testInfiniteHandover();
+    testRamps();
+    testRejects();
+    testClear();
+
+    Serial.printf("%s: %d failures\n", failures ? "FAIL" : "ok", failures);
+    Sim::end();
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,167 @@
+// MotionController/MotionPlanner 검증. 제어 주기(update())마다 모터 보드 모델(MaqueenModel)에 실제로
+// 써진 좌우 바퀴 속도를 읽어 다음을 확인한다.
+//  - 모든 주기에서 바퀴 속도 변화가 가속도 한계(acceleration x 주기) 이하
+//  - 직진 램프: 0 -> 200 이 200 / 400 = 0.5초(25주기)에 도달하고 구간 끝까지 유지
+//  - 정지 시간: 구간이 끝난 뒤 0이 될 때까지의 시간이 getStoppingTimeMs() 예측과 같음
+//  - 반경 회전: 가감속 중에도 좌우 속도 비가 (R - W/2) : (R + W/2), 오른쪽 회전은 반대
+//  - 제자리 회전: 좌우가 항상 반대 부호, 같은 크기
+//  - stop(): 후진 중에도 한계 안에서 감속해 멈춤
+//   sim_test_motion_planner [출력 폴더]   -> 실패가 있으면 종료 코드 1, gpio.log 에 명령 흐름
+
+#include <Arduino.h>
+#include "maqueenWheelManager.h"
+#include "motionController.h"
+#include "maqueenModel.h"
+
+namespace {
+
+constexpr uint8_t MAQUEEN_ADDRESS = 0x10;
+constexpr uint16_t RATE_HZ = 50;
+constexpr uint16_t ACCELERATION = 400;   // PWM/s
+constexpr uint16_t TRACK_WIDTH_MM = 80;
+
+MaqueenModel board;
+uint32_t periodMs = 0;
+int32_t stepLimit = 0;   // 한 주기 최대 변화량
+int failures = 0;
+
+MotionPlanner::WheelSpeeds previous = {0, 0};
+
+void check(bool condition, const char* what, int cycle, const MotionPlanner::WheelSpeeds& speeds) {
+    if (condition) return;
+    failures++;
+    Serial.printf("FAIL cycle %d (L %d, R %d): %s\n", cycle, speeds.left, speeds.right, what);
+}
+
+int16_t signedSpeed(const MaqueenModel::Wheel& wheel) {
+    return int16_t(wheel.reverse ? -int(wheel.speed) : int(wheel.speed));
+}
+
+// 제어 한 주기 진행 후 보드에 써진 속도. 가속도 한계는 여기서 매번 확인한다
+MotionPlanner::WheelSpeeds cycle(int index) {
+    Motion.update();
+    delay(periodMs);
+    const MotionPlanner::WheelSpeeds now = {signedSpeed(board.left()), signedSpeed(board.right())};
+    check(abs(now.left - previous.left) <= stepLimit && abs(now.right - previous.right) <= stepLimit,
+          "acceleration limit exceeded", index, now);
+    previous = now;
+    return now;
+}
+
+// 같은 설정의 계획기로 속도 v에서의 정지 시간 예측
+uint32_t predictedStoppingMs(int16_t speed) {
+    MotionPlanner probe;
+    MotionPlanner::Config config;
+    config.acceleration = ACCELERATION;
+    config.trackWidthMm = TRACK_WIDTH_MM;
+    probe.setConfig(config);
+    probe.line(speed, 60000);
+    while (probe.getSpeeds().left != speed) probe.step(periodMs);
+    return probe.getStoppingTimeMs();
+}
+
+void testLineRampAndStop() {
+    const int16_t speed = 200;
+    const uint16_t durationMs = 2000;
+    Motion.line(speed, durationMs);
+
+    const int rampCycles = speed / stepLimit;                // 0.5초
+    const int segmentCycles = int(durationMs / periodMs);
+    int reached = -1;
+    int zeroAt = -1;
+    for (int i = 1; i <= segmentCycles + 60 && zeroAt < 0; i++) {
+        const MotionPlanner::WheelSpeeds s = cycle(i);
+        check(s.left == s.right, "straight line must drive both wheels equally", i, s);
+        if (reached < 0 && s.left == speed) reached = i;
+        if (i > rampCycles && i <= segmentCycles) check(s.left == speed, "speed must hold until segment end", i, s);
+        if (i > segmentCycles && s.left == 0) zeroAt = i;
+    }
+    check(reached == rampCycles, "ramp 0 -> 200 must take 0.5 s", reached, previous);
+
+    const uint32_t stoppedMs = uint32_t(zeroAt - segmentCycles) * periodMs;
+    const uint32_t predictedMs = predictedStoppingMs(speed);
+    check(stoppedMs == predictedMs, "stopping time must match getStoppingTimeMs()", zeroAt, previous);
+    Serial.printf("line: ramp %d cycles (%lu ms), stop %lu ms (predicted %lu ms)\n", reached,
+                  (unsigned long)(reached * periodMs), (unsigned long)stoppedMs, (unsigned long)predictedMs);
+    check(Motion.isIdle(), "controller must be idle after stopping", zeroAt, previous);
+}
+
+// radius > 0: 왼쪽으로 (왼쪽 바퀴가 안쪽)
+void testArc(int16_t speed, int16_t radiusMm) {
+    const uint16_t durationMs = 1500;
+    Motion.arc(speed, radiusMm, durationMs);
+
+    const int32_t half = TRACK_WIDTH_MM / 2;
+    const int32_t innerRatio = abs(radiusMm) - half;   // 안쪽 : 바깥쪽
+    const int32_t outerRatio = abs(radiusMm) + half;
+    const int16_t inner = int16_t(speed * innerRatio / abs(radiusMm));
+    const int16_t outer = int16_t(speed * outerRatio / abs(radiusMm));
+
+    MotionPlanner::WheelSpeeds steady = {0, 0};
+    for (int i = 1; i <= 200 && !(i > 10 && previous.left == 0 && previous.right == 0); i++) {
+        const MotionPlanner::WheelSpeeds s = cycle(i);
+        const int32_t in = radiusMm > 0 ? s.left : s.right;
+        const int32_t out = radiusMm > 0 ? s.right : s.left;
+        // 정수 PWM 반올림 한 단계(바깥쪽 비율만큼)까지 허용
+        check(abs(in * outerRatio - out * innerRatio) <= outerRatio, "arc wheel ratio must hold while ramping", i, s);
+        if (i == int(durationMs / periodMs)) steady = s;
+    }
+    const int16_t steadyInner = radiusMm > 0 ? steady.left : steady.right;
+    const int16_t steadyOuter = radiusMm > 0 ? steady.right : steady.left;
+    check(steadyInner == inner && steadyOuter == outer, "arc steady state wheel speeds", 0, steady);
+    Serial.printf("arc r=%d: steady L %d R %d (inner:outer = %ld:%ld)\n", radiusMm, steady.left, steady.right,
+                  (long)innerRatio, (long)outerRatio);
+}
+
+void testSpin() {
+    Motion.spin(120, 800);
+    for (int i = 1; i <= 100 && !(i > 5 && previous.left == 0); i++) {
+        const MotionPlanner::WheelSpeeds s = cycle(i);
+        check(s.left == -s.right, "spin must drive the wheels in opposite directions", i, s);
+        if (i == 40) check(s.right == 120 && s.left == -120, "spin steady state", i, s);
+    }
+}
+
+void testStopWhileReversing() {
+    Motion.line(-180, 5000);
+    int i = 1;
+    for (; i <= 40; i++) cycle(i);
+    check(previous.left == -180 && previous.right == -180, "reverse cruise", i, previous);
+
+    Motion.stop();
+    const int expectedCycles = (180 + stepLimit - 1) / stepLimit;
+    int stoppedAfter = -1;
+    for (int n = 1; n <= 60 && stoppedAfter < 0; n++, i++) {
+        const MotionPlanner::WheelSpeeds s = cycle(i);
+        if (s.left == 0 && s.right == 0) stoppedAfter = n;
+    }
+    check(stoppedAfter == expectedCycles, "stop() must decelerate at the limit", i, previous);
+    Serial.printf("stop(): -180 -> 0 in %d cycles (%lu ms)\n", stoppedAfter, (unsigned long)(stoppedAfter * periodMs));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (!Sim::begin(argc > 1 ? argv[1] : "sim-out/motion")) return 1;
+    Sim::attach(MAQUEEN_ADDRESS, &board);
+    Serial.begin(115200);
+
+    Maqueen.begin(MAQUEEN_ADDRESS);
+    MotionPlanner::Config config;
+    config.acceleration = ACCELERATION;
+    config.trackWidthMm = TRACK_WIDTH_MM;
+    Motion.begin(RATE_HZ, 3, config);  // 태스크는 시뮬레이션에서 돌지 않으므로 update()를 직접 부른다
+    periodMs = Motion.getPeriodMs();
+    stepLimit = int32_t(ACCELERATION * periodMs / 1000);
+
+    testLineRampAndStop();
+    testArc(150, 200);
+    testArc(150, -200);
+    testSpin();
+    testStopWhileReversing();
+
+    Serial.printf("%s: %d failures, %lu motor writes\n", failures ? "FAIL" : "ok", failures,
+                  (unsigned long)board.getWrites());
+    Sim::end();
+    return failures ? 1 : 0;
+}
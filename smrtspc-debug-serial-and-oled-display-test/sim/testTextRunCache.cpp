@@ -0,0 +1,142 @@
+// TextRunCache 검증: 같은 문자열을 캐시 없이(u8g2 drawStr) 그린 프레임 버퍼와, 캐시로 그린 버퍼
+// (처음 = 저장, 두 번째 = 적중 복사)가 바이트 단위로 같은지 글꼴마다 확인한다.
+//  - 위치: 화면 가운데, 왼쪽/오른쪽/위/아래 가장자리, 가장자리에 걸쳐 잘리는 위치
+//  - 배경: 검은 바탕에 켜기, 흰 바탕에 지우기 / 글꼴 모드: 불투명, 투명
+//  - u8g2lite에서는 글리프가 글자 간격보다 넓고 왼쪽으로 튀어나오는 글꼴도 (스트립 여백 확인)
+// 적중이 한 번도 없으면 검증이 비어 있는 것이므로 실패로 본다.
+//   sim_test_text_run_cache [출력 폴더]   -> 다르면 종료 코드 1
+
+#include <Arduino.h>
+#include "oledPanel.h"
+#include "textRunCache.h"
+#include "simRuntime.h"
+
+namespace {
+
+struct Font {
+    const char* name;
+    const uint8_t* data;
+};
+
+const Font fonts[] = {
+    {"6x10_tf", u8g2_font_6x10_tf},
+    {"ncenB08_tr", u8g2_font_ncenB08_tr},
+    {"ncenB10_tr", u8g2_font_ncenB10_tr},
+#ifdef U8G2LITE_HAVE_OVERHANG_FONT
+    {"overhang", u8g2lite_font_overhang_tr},
+#endif
+};
+
+// 내림 획(j g y q _), 좁은 글자, 넓은 글자, 공백으로 끝나는 문자열
+const char* const texts[] = {"Pin: 8", "Active Low", "jgyq_", "W", "12:34", "AV|.", "i ", "|"};
+
+int failures = 0;
+
+template <typename Panel>
+struct Bench {
+    const char* name;
+    Panel panel{U8G2_R0};
+    TextRunCache<Panel::width> cache;
+    uint8_t reference[Panel::tileWidth * Panel::tileHeight * 8];
+    uint32_t compared = 0;
+
+    static constexpr size_t bufferSize = sizeof(reference);
+
+    explicit Bench(const char* name) : name(name) {}
+
+    void background(bool inverted) {
+        panel.clearBuffer();
+        if (inverted) {
+            panel.setDrawColor(1);
+            panel.drawBox(0, 0, Panel::width, Panel::height);
+        }
+        panel.setDrawColor(inverted ? 0 : 1);
+    }
+
+    bool same(const Font& font, const char* text, int x, int y, bool inverted, uint8_t mode, const char* pass) {
+        compared++;
+        const uint8_t* buffer = panel.getBufferPtr();
+        if (memcmp(buffer, reference, bufferSize) == 0) return true;
+        failures++;
+        size_t i = 0;
+        while (buffer[i] == reference[i]) i++;
+        const size_t stride = size_t(Panel::tileWidth) * 8;
+        Serial.printf("FAIL %s %s \"%s\" at (%d, %d) %s, font mode %u, %s: column %u page %u differs "
+                      "(drawStr 0x%02X, cache 0x%02X)\n",
+                      name, font.name, text, x, y, inverted ? "inverted" : "normal", mode, pass,
+                      unsigned(i % stride), unsigned(i / stride), reference[i], buffer[i]);
+        return false;
+    }
+
+    void check(const Font& font, const char* text, int x, int y, bool inverted, uint8_t mode) {
+        panel.setFont(font.data);
+        panel.setFontMode(mode);
+
+        background(inverted);
+        panel.drawStr(int16_t(x), int16_t(y), text);
+        memcpy(reference, panel.getBufferPtr(), bufferSize);
+
+        // 저장(또는 캐시를 못 쓰는 위치면 u8g2 그대로), 그 다음 적중 복사
+        background(inverted);
+        cache.drawStr(panel, x, y, text);
+        if (!same(font, text, x, y, inverted, mode, "first draw")) return;
+
+        background(inverted);
+        cache.drawStr(panel, x, y, text);
+        same(font, text, x, y, inverted, mode, "second draw");
+    }
+
+    void run() {
+        for (const Font& font : fonts) {
+            panel.setFont(font.data);
+            const uint32_t hitsBefore = cache.getHits();
+            const u8g2_font_info_t& info = panel.getU8g2()->font_info;
+            const int top = info.max_char_height + info.y_offset;     // 바운딩 박스 위가 0인 기준선
+            const int bottom = Panel::height + info.y_offset;          // 바운딩 박스 아래가 화면 끝인 기준선
+
+            for (const char* text : texts) {
+                const int width = panel.getStrWidth(text);
+                if (cache.getWidth(panel, text) != width) {
+                    failures++;
+                    Serial.printf("FAIL %s %s \"%s\": cached width differs\n", name, font.name, text);
+                }
+                const int xs[] = {-3, 0, 1, 2, (Panel::width - width) / 2, Panel::width - width - 1,
+                                  Panel::width - width, Panel::width - width + 3};
+                const int ys[] = {top - 1, top, Panel::height / 2 + 4, bottom, bottom + 1};
+                for (int x : xs) {
+                    for (int y : ys) {
+                        for (uint8_t mode = 0; mode < 2; mode++) {
+                            check(font, text, x, y, false, mode);
+                            check(font, text, x, y, true, mode);
+                        }
+                    }
+                }
+            }
+
+            const uint32_t hits = cache.getHits() - hitsBefore;
+            Serial.printf("%s %s: %lu cache hits\n", name, font.name, (unsigned long)hits);
+            if (hits == 0) {
+                failures++;
+                Serial.printf("FAIL %s %s: the cached path was never taken\n", name, font.name);
+            }
+        }
+    }
+};
+
+Bench<Ssd1306Panel72x40> small("72x40");
+Bench<Ssd1306Panel128x64> large("128x64");
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (!Sim::begin(argc > 1 ? argv[1] : "sim-out/text-run-cache")) return 1;
+    Serial.begin(115200);
+
+    small.run();
+    large.run();
+
+    Serial.printf("%s: %lu comparisons, %d failures\n", failures ? "FAIL" : "ok",
+                  (unsigned long)(small.compared + large.compared), failures);
+    Sim::end();
+    return failures ? 1 : 0;
+}
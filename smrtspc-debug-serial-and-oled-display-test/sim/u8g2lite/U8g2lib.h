@@ -0,0 +1,212 @@
+#ifndef SIM_U8G2LITE_H
+#define SIM_U8G2LITE_H
+
+// 호스트 시뮬레이션용 U8g2 부분 구현 (sim/ 빌드 전용, 보드 빌드에는 쓰이지 않는다).
+// 실제 U8g2는 내려받아야만 빌드할 수 있어서, 네트워크 없이도 시뮬레이션과 골든 이미지 테스트가
+// 돌도록 스케치 모듈이 쓰는 API만 같은 이름과 같은 동작으로 다시 만든 것이다.
+//  - u8x8 계층: 디스플레이/CAD/바이트 콜백 구조, SSD1306 128x64 noname 드라이버(초기화 시퀀스,
+//    전원, 대비, DRAW_TILE), ssd13xx_fast_i2c CAD. 바이트는 I2cBusManager 콜백을 거쳐 Wire로 나간다.
+//  - u8g2 계층: 전체 프레임 버퍼(세로 바이트, LSB 위), 클리핑, 점/선/박스/테두리, 글자 그리기, 회전은 R0만.
+//  - 글꼴: 실제 u8g2 글꼴 데이터 대신 5x7 글리프 하나를 크기(ascent/descent), 굵기, 글자 간격만 바꿔서
+//    u8g2_font_6x10_tf / ncenB08_tr / ncenB10_tr 이름으로 제공한다. 글꼴 높이와 기준선은 원래 글꼴과
+//    비슷하게 맞췄지만 글자 모양은 다르므로, 이 빌드의 PBM은 보드 화면과 픽셀 단위로 같지 않다.
+// 실제 라이브러리로 빌드하려면 cmake에 -DU8G2_SOURCE_DIR=... 또는 -DSIM_FETCH_U8G2=ON 을 준다.
+
+#include <Arduino.h>
+
+#define U8X8_PIN_NONE 255
+
+#define U8X8_PIN_I2C_CLOCK 0
+#define U8X8_PIN_I2C_DATA  1
+#define U8X8_PIN_CS        9
+#define U8X8_PIN_DC        10
+#define U8X8_PIN_RESET     11
+#define U8X8_PIN_CNT       12
+
+// 디스플레이 콜백 메시지
+#define U8X8_MSG_DISPLAY_SETUP_MEMORY   9
+#define U8X8_MSG_DISPLAY_INIT           10
+#define U8X8_MSG_DISPLAY_SET_POWER_SAVE 11
+#define U8X8_MSG_DISPLAY_SET_FLIP_MODE  13
+#define U8X8_MSG_DISPLAY_SET_CONTRAST   14
+#define U8X8_MSG_DISPLAY_DRAW_TILE      15
+#define U8X8_MSG_DISPLAY_REFRESH        16
+
+// CAD / 바이트 콜백 메시지
+#define U8X8_MSG_CAD_INIT           20
+#define U8X8_MSG_CAD_SEND_CMD       21
+#define U8X8_MSG_CAD_SEND_ARG       22
+#define U8X8_MSG_CAD_SEND_DATA      23
+#define U8X8_MSG_CAD_START_TRANSFER 24
+#define U8X8_MSG_CAD_END_TRANSFER   25
+#define U8X8_MSG_BYTE_INIT           U8X8_MSG_CAD_INIT
+#define U8X8_MSG_BYTE_SEND           U8X8_MSG_CAD_SEND_DATA
+#define U8X8_MSG_BYTE_START_TRANSFER U8X8_MSG_CAD_START_TRANSFER
+#define U8X8_MSG_BYTE_END_TRANSFER   U8X8_MSG_CAD_END_TRANSFER
+#define U8X8_MSG_BYTE_SET_DC         32
+
+// GPIO/지연 콜백 메시지
+#define U8X8_MSG_GPIO_AND_DELAY_INIT 40
+#define U8X8_MSG_DELAY_MILLI         41
+#define U8X8_MSG_GPIO_RESET          75
+
+struct u8x8_struct;
+typedef struct u8x8_struct u8x8_t;
+typedef uint8_t (*u8x8_msg_cb)(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr);
+
+typedef struct {
+    uint8_t chip_enable_level;
+    uint8_t chip_disable_level;
+    uint8_t post_chip_enable_wait_ns;
+    uint8_t pre_chip_disable_wait_ns;
+    uint8_t reset_pulse_width_ms;
+    uint8_t post_reset_wait_ms;
+    uint8_t sda_setup_time_ns;
+    uint8_t sck_pulse_width_ns;
+    uint32_t sck_clock_hz;
+    uint8_t spi_mode;
+    uint8_t i2c_bus_clock_100kHz;
+    uint8_t data_setup_time_ns;
+    uint8_t write_pulse_width_ns;
+    uint8_t tile_width;
+    uint8_t tile_height;
+    uint8_t default_x_offset;
+    uint8_t flipmode_x_offset;
+    uint16_t pixel_width;
+    uint16_t pixel_height;
+} u8x8_display_info_t;
+
+typedef struct {
+    uint8_t* tile_ptr;
+    uint8_t cnt;
+    uint8_t x_pos;
+    uint8_t y_pos;
+} u8x8_tile_t;
+
+struct u8x8_struct {
+    const u8x8_display_info_t* display_info;
+    u8x8_msg_cb display_cb;
+    u8x8_msg_cb cad_cb;
+    u8x8_msg_cb byte_cb;
+    u8x8_msg_cb gpio_and_delay_cb;
+    uint32_t bus_clock;     // 0이면 display_info의 기본 클럭
+    uint8_t x_offset;
+    uint8_t is_font_inverse_mode;
+    uint8_t i2c_address;    // 8비트 주소 (255 = CAD가 기본값 0x78로 정함)
+    uint8_t i2c_started;    // ssd13xx_fast_i2c: 명령 트랜잭션이 열려 있음
+    uint8_t pins[U8X8_PIN_CNT];
+};
+
+// ---- u8x8 ----
+void u8x8_SetPin_HW_I2C(u8x8_t* u8x8, uint8_t reset, uint8_t clock, uint8_t data);
+uint8_t u8x8_GetI2CAddress(u8x8_t* u8x8);
+void u8x8_d_helper_display_setup_memory(u8x8_t* u8x8, const u8x8_display_info_t* display_info);
+void u8x8_d_helper_display_init(u8x8_t* u8x8);
+uint8_t u8x8_DrawTile(u8x8_t* u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t* tile_ptr);
+void u8x8_RefreshDisplay(u8x8_t* u8x8);
+void u8x8_InitDisplay(u8x8_t* u8x8);
+void u8x8_SetPowerSave(u8x8_t* u8x8, uint8_t is_enable);
+void u8x8_SetContrast(u8x8_t* u8x8, uint8_t value);
+
+uint8_t u8x8_d_ssd1306_128x64_noname(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr);
+uint8_t u8x8_cad_ssd13xx_fast_i2c(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr);
+uint8_t u8x8_gpio_and_delay_arduino(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr);
+
+// ---- u8g2 ----
+struct u8g2_struct;
+typedef struct u8g2_struct u8g2_t;
+typedef void (*u8g2_draw_ll_hvline_cb)(u8g2_t* u8g2, int16_t x, int16_t y, int16_t len, uint8_t dir);
+
+// 회전 정보 (R0만 지원, 포인터 비교용)
+typedef struct {
+    uint8_t rotation;
+} u8g2_cb_t;
+extern const u8g2_cb_t u8g2_cb_r0;
+#define U8G2_R0 (&u8g2_cb_r0)
+
+typedef struct {
+    uint8_t max_char_width;
+    uint8_t max_char_height;
+    int8_t x_offset;
+    int8_t y_offset;
+    int8_t ascent_A;
+    int8_t descent_g;
+} u8g2_font_info_t;
+
+struct u8g2_struct {
+    u8x8_t u8x8;
+    u8g2_draw_ll_hvline_cb ll_hvline;
+    const u8g2_cb_t* cb;
+    uint8_t* tile_buf_ptr;
+    uint8_t tile_buf_height;
+    uint16_t pixel_buf_width;
+    uint16_t pixel_buf_height;
+    const uint8_t* font;
+    u8g2_font_info_t font_info;
+    int8_t font_ref_ascent;
+    int8_t font_ref_descent;
+    uint8_t font_is_transparent;
+    uint8_t draw_color;   // 0 = 지우기, 1 = 켜기, 2 = XOR
+};
+
+void u8g2_SetupDisplay(u8g2_t* u8g2, u8x8_msg_cb display_cb, u8x8_msg_cb cad_cb, u8x8_msg_cb byte_cb,
+                       u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_SetupBuffer(u8g2_t* u8g2, uint8_t* buf, uint8_t tile_buf_height, u8g2_draw_ll_hvline_cb ll_hvline_cb,
+                      const u8g2_cb_t* u8g2_cb);
+void u8g2_ll_hvline_vertical_top_lsb(u8g2_t* u8g2, int16_t x, int16_t y, int16_t len, uint8_t dir);
+
+// 글꼴 (설명은 맨 위). 원래 이름을 그대로 쓴다
+extern const uint8_t u8g2_font_6x10_tf[];
+extern const uint8_t u8g2_font_ncenB08_tr[];
+extern const uint8_t u8g2_font_ncenB10_tr[];
+// u8g2lite 전용: 글리프가 글자 간격보다 넓고 왼쪽으로 튀어나오는 글꼴 (글자 캐시 여백 검증용)
+#define U8G2LITE_HAVE_OVERHANG_FONT 1
+extern const uint8_t u8g2lite_font_overhang_tr[];
+
+class U8G2 {
+public:
+    U8G2();
+
+    u8x8_t* getU8x8() { return &u8g2.u8x8; }
+    u8g2_t* getU8g2() { return &u8g2; }
+
+    // initDisplay + 화면 지우기 + 켜기
+    bool begin();
+    void initDisplay() { u8x8_InitDisplay(getU8x8()); }
+    void setPowerSave(uint8_t is_enable) { u8x8_SetPowerSave(getU8x8(), is_enable); }
+    void setContrast(uint8_t value) { u8x8_SetContrast(getU8x8(), value); }
+    void setBusClock(uint32_t clock_speed) { u8g2.u8x8.bus_clock = clock_speed; }
+    // 8비트 주소 (7비트 주소 << 1), begin() 전에
+    void setI2CAddress(uint8_t adr) { u8g2.u8x8.i2c_address = adr; }
+
+    uint8_t* getBufferPtr() { return u8g2.tile_buf_ptr; }
+    uint8_t getBufferTileWidth() const { return u8g2.u8x8.display_info->tile_width; }
+    uint8_t getBufferTileHeight() const { return u8g2.tile_buf_height; }
+    uint16_t getDisplayWidth() const { return u8g2.pixel_buf_width; }
+    uint16_t getDisplayHeight() const { return u8g2.pixel_buf_height; }
+
+    void clearBuffer();
+    void sendBuffer();
+    void clearDisplay();
+
+    void setDrawColor(uint8_t color) { u8g2.draw_color = color; }
+    void drawPixel(int16_t x, int16_t y);
+    void drawHLine(int16_t x, int16_t y, int16_t w);
+    void drawVLine(int16_t x, int16_t y, int16_t h);
+    void drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+    void drawBox(int16_t x, int16_t y, int16_t w, int16_t h);
+    void drawFrame(int16_t x, int16_t y, int16_t w, int16_t h);
+
+    void setFont(const uint8_t* font);
+    void setFontMode(uint8_t is_transparent) { u8g2.font_is_transparent = is_transparent; }
+    int8_t getAscent() const { return u8g2.font_ref_ascent; }
+    int8_t getDescent() const { return u8g2.font_ref_descent; }
+    // y는 기준선. 그린 폭(글자 간격 합)을 반환
+    uint16_t drawStr(int16_t x, int16_t y, const char* text);
+    uint16_t getStrWidth(const char* text);
+
+protected:
+    u8g2_t u8g2;
+};
+
+#endif
@@ -0,0 +1,368 @@
+#include "U8g2lib.h"
+
+const u8g2_cb_t u8g2_cb_r0 = {0};
+
+// ---- u8x8: 바이트/CAD 도우미 ----
+
+static void byteStart(u8x8_t* u8x8) {
+    u8x8->byte_cb(u8x8, U8X8_MSG_BYTE_START_TRANSFER, 0, nullptr);
+}
+
+static void byteEnd(u8x8_t* u8x8) {
+    u8x8->byte_cb(u8x8, U8X8_MSG_BYTE_END_TRANSFER, 0, nullptr);
+}
+
+static void byteSend(u8x8_t* u8x8, uint8_t count, const uint8_t* data) {
+    u8x8->byte_cb(u8x8, U8X8_MSG_BYTE_SEND, count, const_cast<uint8_t*>(data));
+}
+
+static void cadStart(u8x8_t* u8x8) { u8x8->cad_cb(u8x8, U8X8_MSG_CAD_START_TRANSFER, 0, nullptr); }
+static void cadEnd(u8x8_t* u8x8) { u8x8->cad_cb(u8x8, U8X8_MSG_CAD_END_TRANSFER, 0, nullptr); }
+static void cadCmd(u8x8_t* u8x8, uint8_t cmd) { u8x8->cad_cb(u8x8, U8X8_MSG_CAD_SEND_CMD, cmd, nullptr); }
+static void cadArg(u8x8_t* u8x8, uint8_t arg) { u8x8->cad_cb(u8x8, U8X8_MSG_CAD_SEND_ARG, arg, nullptr); }
+
+static void cadData(u8x8_t* u8x8, uint8_t count, uint8_t* data) {
+    u8x8->cad_cb(u8x8, U8X8_MSG_CAD_SEND_DATA, count, data);
+}
+
+static void gpioDelay(u8x8_t* u8x8, uint8_t msg, uint8_t arg) {
+    u8x8->gpio_and_delay_cb(u8x8, msg, arg, nullptr);
+}
+
+// ---- u8x8 ----
+
+void u8x8_SetPin_HW_I2C(u8x8_t* u8x8, uint8_t reset, uint8_t clock, uint8_t data) {
+    u8x8->pins[U8X8_PIN_RESET] = reset;
+    u8x8->pins[U8X8_PIN_I2C_CLOCK] = clock;
+    u8x8->pins[U8X8_PIN_I2C_DATA] = data;
+}
+
+uint8_t u8x8_GetI2CAddress(u8x8_t* u8x8) { return u8x8->i2c_address; }
+
+void u8x8_d_helper_display_setup_memory(u8x8_t* u8x8, const u8x8_display_info_t* display_info) {
+    u8x8->display_info = display_info;
+    u8x8->x_offset = display_info->default_x_offset;
+}
+
+// GPIO 초기화, CAD(바이트) 초기화, 리셋 핀 펄스
+void u8x8_d_helper_display_init(u8x8_t* u8x8) {
+    gpioDelay(u8x8, U8X8_MSG_GPIO_AND_DELAY_INIT, 0);
+    u8x8->cad_cb(u8x8, U8X8_MSG_CAD_INIT, 0, nullptr);
+
+    gpioDelay(u8x8, U8X8_MSG_GPIO_RESET, 1);
+    gpioDelay(u8x8, U8X8_MSG_DELAY_MILLI, u8x8->display_info->reset_pulse_width_ms);
+    gpioDelay(u8x8, U8X8_MSG_GPIO_RESET, 0);
+    gpioDelay(u8x8, U8X8_MSG_DELAY_MILLI, u8x8->display_info->reset_pulse_width_ms);
+    gpioDelay(u8x8, U8X8_MSG_GPIO_RESET, 1);
+    gpioDelay(u8x8, U8X8_MSG_DELAY_MILLI, u8x8->display_info->post_reset_wait_ms);
+}
+
+uint8_t u8x8_DrawTile(u8x8_t* u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t* tile_ptr) {
+    u8x8_tile_t tile = {tile_ptr, cnt, x, y};
+    return u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_DRAW_TILE, 1, &tile);
+}
+
+void u8x8_RefreshDisplay(u8x8_t* u8x8) { u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_REFRESH, 0, nullptr); }
+void u8x8_InitDisplay(u8x8_t* u8x8) { u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_INIT, 0, nullptr); }
+
+void u8x8_SetPowerSave(u8x8_t* u8x8, uint8_t is_enable) {
+    u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_SET_POWER_SAVE, is_enable, nullptr);
+}
+
+void u8x8_SetContrast(u8x8_t* u8x8, uint8_t value) {
+    u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_SET_CONTRAST, value, nullptr);
+}
+
+// ---- SSD1306 128x64 (u8x8_d_ssd1306_128x64_noname 과 같은 값과 순서) ----
+
+static const u8x8_display_info_t ssd1306_128x64_noname_display_info = {
+    /* chip_enable_level = */ 0,
+    /* chip_disable_level = */ 1,
+    /* post_chip_enable_wait_ns = */ 20,
+    /* pre_chip_disable_wait_ns = */ 10,
+    /* reset_pulse_width_ms = */ 100,
+    /* post_reset_wait_ms = */ 100,
+    /* sda_setup_time_ns = */ 50,
+    /* sck_pulse_width_ns = */ 50,
+    /* sck_clock_hz = */ 8000000UL,
+    /* spi_mode = */ 0,
+    /* i2c_bus_clock_100kHz = */ 4,
+    /* data_setup_time_ns = */ 40,
+    /* write_pulse_width_ns = */ 150,
+    /* tile_width = */ 16,
+    /* tile_height = */ 8,
+    /* default_x_offset = */ 0,
+    /* flipmode_x_offset = */ 0,
+    /* pixel_width = */ 128,
+    /* pixel_height = */ 64,
+};
+
+// {명령, 인자 수, 인자}
+static const uint8_t ssd1306_128x64_noname_init_seq[][3] = {
+    {0xAE, 0, 0},     // 끄기
+    {0xD5, 1, 0x80},  // 클럭 분주
+    {0xA8, 1, 0x3F},  // 멀티플렉스 64
+    {0xD3, 1, 0x00},  // 표시 오프셋
+    {0x40, 0, 0},     // 시작 줄
+    {0x8D, 1, 0x14},  // 차지 펌프
+    {0x20, 1, 0x00},  // 주소 모드
+    {0xA1, 0, 0},     // 세그먼트 반전
+    {0xC8, 0, 0},     // COM 스캔 방향
+    {0xDA, 1, 0x12},  // COM 핀
+    {0x81, 1, 0xCF},  // 대비
+    {0xD9, 1, 0xF1},  // 프리차지
+    {0xDB, 1, 0x40},  // VCOMH
+    {0x2E, 0, 0},     // 스크롤 끄기
+    {0xA4, 0, 0},     // RAM 출력
+    {0xA6, 0, 0},     // 반전 안 함
+};
+
+uint8_t u8x8_d_ssd1306_128x64_noname(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+    switch (msg) {
+        case U8X8_MSG_DISPLAY_SETUP_MEMORY:
+            u8x8_d_helper_display_setup_memory(u8x8, &ssd1306_128x64_noname_display_info);
+            return 1;
+        case U8X8_MSG_DISPLAY_INIT:
+            u8x8_d_helper_display_init(u8x8);
+            cadStart(u8x8);
+            for (const auto& step : ssd1306_128x64_noname_init_seq) {
+                cadCmd(u8x8, step[0]);
+                if (step[1]) cadArg(u8x8, step[2]);
+            }
+            cadEnd(u8x8);
+            return 1;
+        case U8X8_MSG_DISPLAY_SET_POWER_SAVE:
+            cadStart(u8x8);
+            cadCmd(u8x8, arg_int ? 0xAE : 0xAF);
+            cadEnd(u8x8);
+            return 1;
+        case U8X8_MSG_DISPLAY_SET_CONTRAST:
+            cadStart(u8x8);
+            cadCmd(u8x8, 0x81);
+            cadArg(u8x8, arg_int);
+            cadEnd(u8x8);
+            return 1;
+        case U8X8_MSG_DISPLAY_DRAW_TILE: {
+            const u8x8_tile_t* tile = static_cast<const u8x8_tile_t*>(arg_ptr);
+            cadStart(u8x8);
+            const uint8_t x = uint8_t(tile->x_pos * 8 + u8x8->x_offset);
+            cadCmd(u8x8, uint8_t(0x10 | (x >> 4)));
+            cadArg(u8x8, uint8_t(x & 0x0F));
+            cadCmd(u8x8, uint8_t(0xB0 | tile->y_pos));
+            do {
+                cadData(u8x8, uint8_t(tile->cnt * 8), tile->tile_ptr);
+            } while (--arg_int > 0);
+            cadEnd(u8x8);
+            return 1;
+        }
+        default:
+            return 0;  // 뒤집기, REFRESH 등은 지원하지 않음
+    }
+}
+
+// 명령은 0x00 제어 바이트 하나로 묶고, 데이터는 24바이트씩 0x40 트랜잭션으로 나눠 보낸다
+uint8_t u8x8_cad_ssd13xx_fast_i2c(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+    static const uint8_t commandPrefix = 0x00;
+    static const uint8_t dataPrefix = 0x40;
+
+    switch (msg) {
+        case U8X8_MSG_CAD_SEND_CMD:
+            if (!u8x8->i2c_started) {
+                byteStart(u8x8);
+                byteSend(u8x8, 1, &commandPrefix);
+                u8x8->i2c_started = 1;
+            }
+            byteSend(u8x8, 1, &arg_int);
+            return 1;
+        case U8X8_MSG_CAD_SEND_ARG:
+            byteSend(u8x8, 1, &arg_int);
+            return 1;
+        case U8X8_MSG_CAD_SEND_DATA: {
+            if (u8x8->i2c_started) byteEnd(u8x8);
+            const uint8_t* p = static_cast<const uint8_t*>(arg_ptr);
+            uint8_t remaining = arg_int;
+            do {
+                const uint8_t chunk = remaining > 24 ? 24 : remaining;
+                byteStart(u8x8);
+                byteSend(u8x8, 1, &dataPrefix);
+                byteSend(u8x8, chunk, p);
+                byteEnd(u8x8);
+                p += chunk;
+                remaining = uint8_t(remaining - chunk);
+            } while (remaining > 0);
+            u8x8->i2c_started = 0;
+            return 1;
+        }
+        case U8X8_MSG_CAD_INIT:
+            if (u8x8->i2c_address == 255) u8x8->i2c_address = 0x78;
+            return u8x8->byte_cb(u8x8, U8X8_MSG_BYTE_INIT, arg_int, arg_ptr);
+        case U8X8_MSG_CAD_START_TRANSFER:
+            u8x8->i2c_started = 0;
+            return 1;
+        case U8X8_MSG_CAD_END_TRANSFER:
+            if (u8x8->i2c_started) byteEnd(u8x8);
+            u8x8->i2c_started = 0;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+uint8_t u8x8_gpio_and_delay_arduino(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+    (void)u8x8;
+    (void)arg_ptr;
+    if (msg == U8X8_MSG_DELAY_MILLI) delay(arg_int);
+    return 1;  // 하드웨어 I2C만 쓰므로 GPIO는 할 일이 없다
+}
+
+// ---- u8g2 ----
+
+void u8g2_SetupDisplay(u8g2_t* u8g2, u8x8_msg_cb display_cb, u8x8_msg_cb cad_cb, u8x8_msg_cb byte_cb,
+                       u8x8_msg_cb gpio_and_delay_cb) {
+    u8x8_t* u8x8 = &u8g2->u8x8;
+    memset(u8x8, 0, sizeof(*u8x8));
+    memset(u8x8->pins, U8X8_PIN_NONE, sizeof(u8x8->pins));
+    u8x8->i2c_address = 255;
+    u8x8->display_cb = display_cb;
+    u8x8->cad_cb = cad_cb;
+    u8x8->byte_cb = byte_cb;
+    u8x8->gpio_and_delay_cb = gpio_and_delay_cb;
+    display_cb(u8x8, U8X8_MSG_DISPLAY_SETUP_MEMORY, 0, nullptr);
+}
+
+void u8g2_SetupBuffer(u8g2_t* u8g2, uint8_t* buf, uint8_t tile_buf_height, u8g2_draw_ll_hvline_cb ll_hvline_cb,
+                      const u8g2_cb_t* u8g2_cb) {
+    u8g2->tile_buf_ptr = buf;
+    u8g2->tile_buf_height = tile_buf_height;
+    u8g2->ll_hvline = ll_hvline_cb;
+    u8g2->cb = u8g2_cb;
+    u8g2->pixel_buf_width = uint16_t(u8g2->u8x8.display_info->tile_width * 8);
+    u8g2->pixel_buf_height = uint16_t(tile_buf_height * 8);
+    u8g2->font = nullptr;
+    u8g2->font_info = {};
+    u8g2->font_ref_ascent = 0;
+    u8g2->font_ref_descent = 0;
+    u8g2->font_is_transparent = 0;
+    u8g2->draw_color = 1;
+}
+
+// 세로 바이트(LSB가 위) 버퍼에 가로(dir 0) 또는 세로(dir 1) 선. 좌표는 이미 잘려 있다
+void u8g2_ll_hvline_vertical_top_lsb(u8g2_t* u8g2, int16_t x, int16_t y, int16_t len, uint8_t dir) {
+    const uint16_t stride = u8g2->pixel_buf_width;
+    uint8_t* p = u8g2->tile_buf_ptr + (y >> 3) * stride + x;
+    uint8_t mask = uint8_t(1u << (y & 7));
+    const uint8_t color = u8g2->draw_color;
+
+    while (len-- > 0) {
+        if (color == 0) {
+            *p &= uint8_t(~mask);
+        } else if (color == 1) {
+            *p |= mask;
+        } else {
+            *p ^= mask;
+        }
+        if (dir == 0) {
+            p++;
+        } else {
+            mask = uint8_t(mask << 1);
+            if (mask == 0) {
+                mask = 1;
+                p += stride;
+            }
+        }
+    }
+}
+
+// ---- U8G2 ----
+
+U8G2::U8G2() { memset(&u8g2, 0, sizeof(u8g2)); }
+
+bool U8G2::begin() {
+    initDisplay();
+    clearDisplay();
+    setPowerSave(0);
+    return true;
+}
+
+void U8G2::clearBuffer() {
+    memset(u8g2.tile_buf_ptr, 0, size_t(u8g2.pixel_buf_width) * u8g2.tile_buf_height);
+}
+
+void U8G2::sendBuffer() {
+    const uint8_t tileWidth = getBufferTileWidth();
+    for (uint8_t row = 0; row < u8g2.tile_buf_height; row++) {
+        u8x8_DrawTile(getU8x8(), 0, row, tileWidth, u8g2.tile_buf_ptr + size_t(row) * u8g2.pixel_buf_width);
+    }
+    u8x8_RefreshDisplay(getU8x8());
+}
+
+void U8G2::clearDisplay() {
+    clearBuffer();
+    sendBuffer();
+}
+
+// 클리핑 후 ll_hvline 호출 (보이는 영역 = display_info의 픽셀 크기)
+static void drawHV(u8g2_t* u8g2, int16_t x, int16_t y, int16_t len, uint8_t dir) {
+    const int16_t width = int16_t(u8g2->u8x8.display_info->pixel_width);
+    const int16_t height = int16_t(u8g2->u8x8.display_info->pixel_height);
+    if (len <= 0) return;
+
+    if (dir == 0) {
+        if (y < 0 || y >= height) return;
+        if (x < 0) {
+            len = int16_t(len + x);
+            x = 0;
+        }
+        if (x + len > width) len = int16_t(width - x);
+    } else {
+        if (x < 0 || x >= width) return;
+        if (y < 0) {
+            len = int16_t(len + y);
+            y = 0;
+        }
+        if (y + len > height) len = int16_t(height - y);
+    }
+    if (len <= 0) return;
+    u8g2->ll_hvline(u8g2, x, y, len, dir);
+}
+
+void U8G2::drawPixel(int16_t x, int16_t y) { drawHV(&u8g2, x, y, 1, 0); }
+void U8G2::drawHLine(int16_t x, int16_t y, int16_t w) { drawHV(&u8g2, x, y, w, 0); }
+void U8G2::drawVLine(int16_t x, int16_t y, int16_t h) { drawHV(&u8g2, x, y, h, 1); }
+
+void U8G2::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    const int dx = abs(x2 - x1);
+    const int dy = -abs(y2 - y1);
+    const int sx = x1 < x2 ? 1 : -1;
+    const int sy = y1 < y2 ? 1 : -1;
+    int err = dx + dy;
+    int x = x1;
+    int y = y1;
+    for (;;) {
+        drawPixel(int16_t(x), int16_t(y));
+        if (x == x2 && y == y2) break;
+        const int e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y += sy;
+        }
+    }
+}
+
+void U8G2::drawBox(int16_t x, int16_t y, int16_t w, int16_t h) {
+    for (int16_t i = 0; i < h; i++) drawHLine(x, int16_t(y + i), w);
+}
+
+void U8G2::drawFrame(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (w <= 0 || h <= 0) return;
+    drawHLine(x, y, w);
+    if (h < 2) return;
+    drawHLine(x, int16_t(y + h - 1), w);
+    if (h < 3) return;
+    drawVLine(x, int16_t(y + 1), int16_t(h - 2));
+    drawVLine(int16_t(x + w - 1), int16_t(y + 1), int16_t(h - 2));
+}
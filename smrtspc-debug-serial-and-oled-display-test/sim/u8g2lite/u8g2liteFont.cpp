@@ -0,0 +1,125 @@
+#include "U8g2lib.h"
+
+// 글꼴 머리: 기준선 위 줄 수, 아래 줄 수, 글리프 열 수, 굵게(한 칸 오른쪽 겹쳐 찍기), 글자 간격,
+// 최대 높이(max_char_height), y_offset, x_offset(펜 위치에서 글리프 왼쪽까지).
+// 글리프 모양은 모두 아래 5x8 표에서 늘려 만든다.
+enum FontHeader : uint8_t { ASCENT, DESCENT, COLUMNS, BOLD, ADVANCE, MAX_HEIGHT, Y_OFFSET, X_OFFSET };
+
+const uint8_t u8g2_font_6x10_tf[] = {7, 2, 5, 0, 6, 10, uint8_t(-2), 0};
+const uint8_t u8g2_font_ncenB08_tr[] = {8, 2, 5, 1, 7, 11, uint8_t(-2), 0};
+const uint8_t u8g2_font_ncenB10_tr[] = {10, 3, 6, 1, 8, 14, uint8_t(-3), 0};
+// 9열(+굵게) 글리프가 펜 2픽셀 왼쪽에서 시작하고 글자 간격은 6: 앞뒤 글자와 겹친다
+const uint8_t u8g2lite_font_overhang_tr[] = {8, 2, 9, 1, 6, 11, uint8_t(-2), uint8_t(-2)};
+
+// ASCII 32~126, 열 단위 5바이트. 비트 0이 맨 위, 0~6행이 기준선 위, 7행은 내림 획
+static const uint8_t glyphs[][5] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, {0x00, 0x07, 0x00, 0x07, 0x00},
+    {0x14, 0x7F, 0x14, 0x7F, 0x14}, {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62},
+    {0x36, 0x49, 0x56, 0x20, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00}, {0x00, 0x1C, 0x22, 0x41, 0x00},
+    {0x00, 0x41, 0x22, 0x1C, 0x00}, {0x14, 0x08, 0x3E, 0x08, 0x14}, {0x08, 0x08, 0x3E, 0x08, 0x08},
+    {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, {0x00, 0x60, 0x60, 0x00, 0x00},
+    {0x20, 0x10, 0x08, 0x04, 0x02}, {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00},
+    {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31}, {0x18, 0x14, 0x12, 0x7F, 0x10},
+    {0x27, 0x45, 0x45, 0x45, 0x39}, {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03},
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E}, {0x00, 0x36, 0x36, 0x00, 0x00},
+    {0x00, 0x56, 0x36, 0x00, 0x00}, {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14},
+    {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06}, {0x32, 0x49, 0x79, 0x41, 0x3E},
+    {0x7E, 0x11, 0x11, 0x11, 0x7E}, {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},
+    {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41}, {0x7F, 0x09, 0x09, 0x09, 0x01},
+    {0x3E, 0x41, 0x49, 0x49, 0x7A}, {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00},
+    {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, {0x7F, 0x40, 0x40, 0x40, 0x40},
+    {0x7F, 0x02, 0x0C, 0x02, 0x7F}, {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, {0x7F, 0x09, 0x19, 0x29, 0x46},
+    {0x46, 0x49, 0x49, 0x49, 0x31}, {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F},
+    {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F}, {0x63, 0x14, 0x08, 0x14, 0x63},
+    {0x07, 0x08, 0x70, 0x08, 0x07}, {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00},
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00}, {0x04, 0x02, 0x01, 0x02, 0x04},
+    {0x40, 0x40, 0x40, 0x40, 0x40}, {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78},
+    {0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20}, {0x38, 0x44, 0x44, 0x48, 0x7F},
+    {0x38, 0x54, 0x54, 0x54, 0x18}, {0x08, 0x7E, 0x09, 0x01, 0x02}, {0x18, 0xA4, 0xA4, 0xA4, 0x7C},
+    {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, {0x40, 0x80, 0x84, 0x7D, 0x00},
+    {0x7F, 0x10, 0x28, 0x44, 0x00}, {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78},
+    {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, {0xFC, 0x24, 0x24, 0x24, 0x18},
+    {0x18, 0x24, 0x24, 0x18, 0xFC}, {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20},
+    {0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, {0x1C, 0x20, 0x40, 0x20, 0x1C},
+    {0x3C, 0x40, 0x30, 0x40, 0x3C}, {0x44, 0x28, 0x10, 0x28, 0x44}, {0x1C, 0xA0, 0xA0, 0xA0, 0x7C},
+    {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, {0x00, 0x00, 0x7F, 0x00, 0x00},
+    {0x00, 0x41, 0x36, 0x08, 0x00}, {0x10, 0x08, 0x08, 0x10, 0x08},
+};
+
+static const uint8_t* findGlyph(char c) {
+    if (c < 32 || c > 126) return nullptr;  // _tr/_tf 글꼴에 없는 글자는 그리지 않는다
+    return glyphs[c - 32];
+}
+
+// 글자 하나가 덮는 폭 (간격 제외)
+static int glyphWidth(const uint8_t* font) { return font[COLUMNS] + font[BOLD]; }
+
+void U8G2::setFont(const uint8_t* font) {
+    if (u8g2.font == font) return;
+    u8g2.font = font;
+    u8g2.font_info.max_char_width = uint8_t(glyphWidth(font));
+    u8g2.font_info.max_char_height = font[MAX_HEIGHT];
+    u8g2.font_info.x_offset = int8_t(font[X_OFFSET]);
+    u8g2.font_info.y_offset = int8_t(font[Y_OFFSET]);
+    u8g2.font_info.ascent_A = int8_t(font[ASCENT]);
+    u8g2.font_info.descent_g = int8_t(-font[DESCENT]);
+    u8g2.font_ref_ascent = u8g2.font_info.ascent_A;
+    u8g2.font_ref_descent = u8g2.font_info.descent_g;
+}
+
+uint16_t U8G2::getStrWidth(const char* text) {
+    const uint8_t* font = u8g2.font;
+    if (!font || !text) return 0;
+    int width = 0;
+    int last = 0;
+    for (const char* p = text; *p; p++) {
+        if (!findGlyph(*p)) continue;
+        width += font[ADVANCE];
+        last = font[ADVANCE];
+    }
+    // 마지막 글자는 간격 대신 글리프 오른쪽 끝까지 (u8g2_GetStrWidth와 같음)
+    if (last) width += int8_t(font[X_OFFSET]) + glyphWidth(font) - last;
+    return uint16_t(width);
+}
+
+uint16_t U8G2::drawStr(int16_t x, int16_t y, const char* text) {
+    const uint8_t* font = u8g2.font;
+    if (!font || !text) return 0;
+    const int ascent = font[ASCENT];
+    const int rows = ascent + font[DESCENT];
+    const int columns = font[COLUMNS];
+    const int width = glyphWidth(font);
+    const uint8_t color = u8g2.draw_color;
+    const int offset = int8_t(font[X_OFFSET]);
+    int pen = x;
+
+    for (const char* p = text; *p; p++) {
+        const uint8_t* glyph = findGlyph(*p);
+        if (!glyph) continue;
+        const int left = pen + offset;
+
+        // 불투명 모드는 글자 상자를 배경색으로 먼저 칠한다 (XOR에서는 하지 않음)
+        if (!u8g2.font_is_transparent && color < 2) {
+            u8g2.draw_color = uint8_t(1 - color);
+            drawBox(int16_t(left), int16_t(y - ascent), int16_t(width), int16_t(rows));
+            u8g2.draw_color = color;
+        }
+
+        for (int c = 0; c < columns; c++) {
+            const uint8_t bits = glyph[c * 5 / columns];
+            for (int r = 0; r < rows; r++) {
+                const int sourceRow = r < ascent ? r * 7 / ascent : 7;
+                if (!(bits & (1u << sourceRow))) continue;
+                const int16_t py = int16_t(y - ascent + r);
+                drawPixel(int16_t(left + c), py);
+                // XOR에서 겹쳐 찍으면 지워지므로 굵게는 다음 열에 원래 비트가 없을 때만
+                if (font[BOLD] && (c + 1 >= columns || !(glyph[(c + 1) * 5 / columns] & (1u << sourceRow)))) {
+                    drawPixel(int16_t(left + c + 1), py);
+                }
+            }
+        }
+        pen += font[ADVANCE];
+    }
+    return uint16_t(pen - x);
+}
@@ -0,0 +1,61 @@
+#include "taskRuntime.h"
+#include "metricsRegistry.h"
+
+TaskHandle_t TaskRuntime::spawn(const char* name, TaskFunction_t function, void* parameter,
+                                uint32_t stackBytes, UBaseType_t priority) {
+    TaskHandle_t handle = nullptr;
+    if (xTaskCreate(function, name, stackBytes, parameter, priority, &handle) != pdPASS) {
+        return nullptr;
+    }
+    add(name, handle, stackBytes);
+    return handle;
+}
+
+bool TaskRuntime::adopt(const char* name, TaskHandle_t handle, uint32_t stackBytes) {
+    return add(name, handle ? handle : xTaskGetCurrentTaskHandle(), stackBytes);
+}
+
+bool TaskRuntime::add(const char* name, TaskHandle_t handle, uint32_t stackBytes) {
+    bool added = false;
+    portENTER_CRITICAL(&lock);
+    if (entryCount < MAX_TASKS) {
+        entries[entryCount++] = {handle, name, stackBytes, 0, 0};
+        added = true;
+    }
+    portEXIT_CRITICAL(&lock);
+    if (added) Metrics.watchTask(name, handle);
+    return added;
+}
+
+void TaskRuntime::addBusyTime(uint32_t micros) {
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    portENTER_CRITICAL(&lock);
+    for (uint8_t i = 0; i < entryCount; i++) {
+        if (entries[i].handle == self) {
+            entries[i].busyMicros += micros;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+void TaskRuntime::printReport(Print& out) {
+    const uint32_t now = micros();
+    const uint32_t window = now - lastReportMicros;
+    lastReportMicros = now;
+
+    out.println("Task            Prio  Stack  MinFree   CPU%");
+    for (uint8_t i = 0; i < entryCount; i++) {
+        portENTER_CRITICAL(&lock);
+        Entry entry = entries[i];
+        entries[i].reportedBusyMicros = entry.busyMicros;
+        portEXIT_CRITICAL(&lock);
+
+        // ESP-IDF의 high-water mark는 바이트 단위 (스택을 가장 많이 썼을 때 남은 양)
+        const UBaseType_t minFree = uxTaskGetStackHighWaterMark(entry.handle);
+        const uint64_t busy = entry.busyMicros - entry.reportedBusyMicros;
+        const unsigned permille = window ? unsigned(busy * 1000 / window) : 0;
+        out.printf("%-15s %4u  %5lu  %7u  %3u.%u\n", entry.name, (unsigned)uxTaskPriorityGet(entry.handle),
+                   (unsigned long)entry.stackBytes, (unsigned)minFree, permille / 10, permille % 10);
+    }
+}
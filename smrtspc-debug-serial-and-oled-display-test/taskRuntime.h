@@ -0,0 +1,207 @@
+#ifndef TASK_RUNTIME_H
+#define TASK_RUNTIME_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/event_groups.h>
+
+// 예제 앱들이 공통으로 쓰는 FreeRTOS 태스크 관리 계층.
+//  - spawn(): 태스크 생성과 등록 (ESP32-C3는 단일 코어이므로 코어 고정 없이 생성)
+//  - Channel<T>: 태스크 사이의 타입 있는 메시지 큐. 받는 쪽은 폴링 대신 블록해서 기다린다.
+//  - Mailbox<T>: 최신 값 하나만 유지하는 우편함. 화면 상태처럼 마지막 값만 의미 있을 때 사용
+//  - WorkTimer: 태스크가 실제로 일한 시간(CPU 시간)을 누적
+//  - printReport(): 스택 최고 사용량(high-water mark)과 CPU 사용률 출력 -> 스택/우선순위 조정 근거
+//
+// 우선순위는 아래 값을 기준으로 정한다 (높을수록 먼저 실행).
+namespace TaskPriority {
+    constexpr UBaseType_t Background = 1;  // 네트워크 조회, 로그 등
+    constexpr UBaseType_t Screen = 2;      // 화면 갱신
+    constexpr UBaseType_t Sensor = 3;      // 센서/입력 처리
+    constexpr UBaseType_t Control = 4;     // 모터 제어 등 주기가 중요한 작업
+}
+
+class TaskRuntime {
+public:
+    // 싱글톤 인스턴스 반환
+    static TaskRuntime& getInstance() {
+        static TaskRuntime instance;
+        return instance;
+    }
+
+    // 태스크 생성 후 등록. 실패하면 nullptr
+    TaskHandle_t spawn(const char* name, TaskFunction_t function, void* parameter,
+                       uint32_t stackBytes, UBaseType_t priority);
+
+    // 이미 실행 중인 태스크(예: Arduino loop 태스크)를 통계 대상에 추가
+    bool adopt(const char* name, TaskHandle_t handle = nullptr, uint32_t stackBytes = 0);
+
+    // 현재 태스크의 작업 시간 누적 (WorkTimer가 호출)
+    void addBusyTime(uint32_t micros);
+
+    // 등록된 태스크의 스택 여유, CPU 사용률(지난 보고 이후) 출력
+    void printReport(Print& out);
+
+    static constexpr uint8_t MAX_TASKS = 12;
+
+private:
+    // 생성자/소멸자 private로 선언하여 싱글톤 패턴 유지
+    TaskRuntime() = default;
+    ~TaskRuntime() = default;
+    TaskRuntime(const TaskRuntime&) = delete;
+    TaskRuntime& operator=(const TaskRuntime&) = delete;
+
+    struct Entry {
+        TaskHandle_t handle;
+        const char* name;
+        uint32_t stackBytes;
+        uint64_t busyMicros;
+        uint64_t reportedBusyMicros;
+    };
+
+    Entry entries[MAX_TASKS];
+    uint8_t entryCount = 0;
+    uint32_t lastReportMicros = 0;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+    bool add(const char* name, TaskHandle_t handle, uint32_t stackBytes);
+};
+
+// 전역 인스턴스 참조
+inline TaskRuntime& Tasks = TaskRuntime::getInstance();
+
+// 범위(scope) 동안의 시간을 현재 태스크의 작업 시간으로 누적
+//   while (true) { channel.receive(msg); WorkTimer work; ...처리... }
+class WorkTimer {
+public:
+    WorkTimer() : start(micros()) {}
+    ~WorkTimer() { Tasks.addBusyTime(micros() - start); }
+
+private:
+    uint32_t start;
+};
+
+// 타입 있는 메시지 큐. 값을 복사해서 전달하므로 T는 작은 구조체여야 한다.
+template <typename T, UBaseType_t Depth = 8>
+class Channel {
+public:
+    bool begin() {
+        if (!queue) queue = xQueueCreate(Depth, sizeof(T));
+        return queue != nullptr;
+    }
+
+    // 보내기. 기본은 기다리지 않고 가득 차면 false (dropped 증가)
+    bool send(const T& message, TickType_t wait = 0) {
+        if (queue && xQueueSend(queue, &message, wait) == pdPASS) return true;
+        dropped++;
+        return false;
+    }
+
+    // 받기. 메시지가 올 때까지 태스크가 블록된다 (CPU 사용 없음)
+    bool receive(T& message, TickType_t wait = portMAX_DELAY) {
+        return queue && xQueueReceive(queue, &message, wait) == pdPASS;
+    }
+
+    UBaseType_t pending() const { return queue ? uxQueueMessagesWaiting(queue) : 0; }
+    uint32_t getDropped() const { return dropped; }
+
+private:
+    QueueHandle_t queue = nullptr;
+    volatile uint32_t dropped = 0;
+};
+
+// 최신 값 하나만 보관하는 우편함. publish()는 절대 블록되지 않고 이전 값을 덮어쓴다.
+// 읽는 태스크마다 reader()로 Reader를 만들고, wait()는 마지막으로 읽은 뒤 새 값이 있으면
+// 가장 최신 값만 돌려준다 (중간 값은 건너뜀). 값마다 버전 번호가 붙어 몇 개를 건너뛰었는지 알 수 있다.
+// 읽는 쪽 깨우기는 Reader마다 이벤트 그룹 비트 하나를 쓴다 (최대 MAX_READERS개).
+template <typename T>
+class Mailbox {
+public:
+    static constexpr uint8_t MAX_READERS = 8;
+
+    class Reader {
+    public:
+        Reader() = default;
+
+        // 새 값이 올 때까지 기다렸다가 최신 값을 out에 복사. 시간 초과면 false
+        bool wait(T& out, TickType_t timeout = portMAX_DELAY) {
+            if (!box) return false;
+            while (box->getVersion() == seen) {
+                EventBits_t bits = xEventGroupWaitBits(box->events, bit, pdTRUE, pdFALSE, timeout);
+                if ((bits & bit) == 0) return false;
+            }
+            return poll(out);
+        }
+
+        // 기다리지 않고 새 값이 있을 때만 복사
+        bool poll(T& out) {
+            if (!box) return false;
+            uint32_t version = box->read(out);
+            if (version == seen) return false;
+            if (version - seen > 1 && seen != 0) skipped += version - seen - 1;
+            seen = version;
+            return true;
+        }
+
+        uint32_t getVersion() const { return seen; }
+        uint32_t getSkipped() const { return skipped; }   // 읽기 전에 덮어써진 값의 수
+
+    private:
+        friend class Mailbox;
+        Reader(Mailbox* box, EventBits_t bit) : box(box), bit(bit) {}
+
+        Mailbox* box = nullptr;
+        EventBits_t bit = 0;
+        uint32_t seen = 0;
+        uint32_t skipped = 0;
+    };
+
+    bool begin() {
+        if (!events) events = xEventGroupCreate();
+        return events != nullptr;
+    }
+
+    // 읽는 쪽 등록 (begin() 이후, 태스크 시작 전에)
+    Reader reader() {
+        if (!events || readerCount >= MAX_READERS) return Reader();
+        EventBits_t bit = EventBits_t(1) << readerCount++;
+        readerBits |= bit;
+        return Reader(this, bit);
+    }
+
+    // 값 갱신. 기다리지 않으며 이전 값은 덮어쓴다
+    void publish(const T& value) {
+        portENTER_CRITICAL(&lock);
+        latest = value;
+        version++;
+        portEXIT_CRITICAL(&lock);
+        if (events) xEventGroupSetBits(events, readerBits);
+    }
+
+    // 최신 값을 복사하고 그 버전을 반환 (0 = 아직 값 없음)
+    uint32_t read(T& out) {
+        portENTER_CRITICAL(&lock);
+        out = latest;
+        uint32_t current = version;
+        portEXIT_CRITICAL(&lock);
+        return current;
+    }
+
+    uint32_t getVersion() {
+        portENTER_CRITICAL(&lock);
+        uint32_t current = version;
+        portEXIT_CRITICAL(&lock);
+        return current;
+    }
+
+private:
+    T latest = T();
+    uint32_t version = 0;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    EventGroupHandle_t events = nullptr;
+    EventBits_t readerBits = 0;
+    uint8_t readerCount = 0;
+};
+
+#endif
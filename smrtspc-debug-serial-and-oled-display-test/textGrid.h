@@ -0,0 +1,82 @@
+#ifndef TEXT_GRID_H
+#define TEXT_GRID_H
+
+#include <stdint.h>
+#include <string.h>
+
+// 고정 폭 글꼴 화면을 문자 칸(cell) 격자로 보관하는 retained 뷰.
+// 매 갱신마다 격자에 새 내용을 쓰고 flush()를 부르면, 마지막으로 그린 내용과 다른 칸만
+// drawCell(column, row, ch, color)로 다시 그린다. 화면 전체를 지우고 다시 그리지 않으므로
+// 깜빡임이 없고 전송하는 픽셀 수가 바뀐 글자 수에 비례한다.
+// 하드웨어에 의존하지 않는다 (그리는 방법은 flush()에 넘기는 함수가 결정).
+template <uint8_t Columns, uint8_t Rows>
+class TextGrid {
+public:
+    TextGrid() {
+        clear();
+        memcpy(drawn, next, sizeof(drawn));  // 처음 화면은 지워진 상태로 본다
+    }
+
+    // 다음에 그릴 내용을 모두 공백으로
+    void clear() {
+        for (uint8_t row = 0; row < Rows; row++) clearRow(row);
+    }
+
+    void clearRow(uint8_t row) {
+        if (row >= Rows) return;
+        for (uint8_t column = 0; column < Columns; column++) next[row][column] = {' ', 0};
+    }
+
+    // (column, row)부터 문자열 쓰기. 격자를 넘는 부분은 버린다. 다음 칸 위치를 반환
+    uint8_t print(uint8_t column, uint8_t row, const char* text, uint16_t color) {
+        if (row >= Rows || !text) return column;
+        while (*text && column < Columns) {
+            next[row][column++] = {*text++, color};
+        }
+        return column;
+    }
+
+    // 다음 flush()에서 모든 칸을 다시 그린다 (화면을 다른 코드가 덮어썼을 때)
+    void invalidate() {
+        for (uint8_t row = 0; row < Rows; row++) {
+            for (uint8_t column = 0; column < Columns; column++) drawn[row][column] = {'\0', 0};
+        }
+    }
+
+    // 바뀐 칸만 그린다. 다시 그린 칸 수를 반환
+    template <typename DrawCell>
+    uint16_t flush(DrawCell&& drawCell) {
+        uint16_t changed = 0;
+        for (uint8_t row = 0; row < Rows; row++) {
+            for (uint8_t column = 0; column < Columns; column++) {
+                const Cell& want = next[row][column];
+                Cell& have = drawn[row][column];
+                if (same(want, have)) continue;
+                drawCell(column, row, want.ch, want.color);
+                have = want;
+                changed++;
+            }
+        }
+        return changed;
+    }
+
+    static constexpr uint8_t columns = Columns;
+    static constexpr uint8_t rows = Rows;
+
+private:
+    struct Cell {
+        char ch;
+        uint16_t color;
+    };
+
+    // 공백은 글자색과 상관없이 배경만 남으므로 같은 칸으로 본다
+    static bool same(const Cell& a, const Cell& b) {
+        if (a.ch != b.ch) return false;
+        return a.ch == ' ' || a.color == b.color;
+    }
+
+    Cell next[Rows][Columns];
+    Cell drawn[Rows][Columns];
+};
+
+#endif
@@ -0,0 +1,192 @@
+#ifndef TEXT_RUN_CACHE_H
+#define TEXT_RUN_CACHE_H
+
+#include <U8g2lib.h>
+#include <string.h>
+
+// (폰트, 문자열) 단위로 측정한 폭과 렌더링된 비트맵 스트립을 저장하는 고정 크기 LRU 캐시.
+// "Pin: 8", "Active Low" 처럼 매번 같은 라벨을 다시 그릴 때 글리프 디코딩과 getStrWidth()를
+// 건너뛰고, 저장해 둔 열(column) 비트를 프레임 버퍼에 그대로 복사한다.
+//
+// 스트립은 배경이 균일한 영역에 그린 결과에서만 만들고, 적중 시에도 대상 영역의 배경이
+// 균일할 때만 복사한다. 그 외(그래픽 위에 겹쳐 그리기, XOR 색상, 회전 등)는 u8g2로 그대로 그린다.
+template <uint8_t MaxColumns, uint8_t Capacity = 8>
+class TextRunCache {
+public:
+    static constexpr uint8_t maxTextLength = 23;
+
+    // 현재 폰트 기준 문자열 폭 (캐시에 있으면 getStrWidth() 생략)
+    int getWidth(U8G2& u8g2, const char* text) {
+        Entry* entry = find(u8g2.getU8g2()->font, text);
+        return entry ? entry->width : u8g2.getStrWidth(text);
+    }
+
+    // (x, y) 기준선에 문자열 그리기
+    void drawStr(U8G2& u8g2, int x, int y, const char* text) {
+        u8g2_t* u = u8g2.getU8g2();
+        if (!text || strlen(text) > maxTextLength) {
+            u8g2.drawStr(x, y, text);
+            return;
+        }
+
+        Entry* entry = find(u->font, text);
+        const int width = entry ? entry->width : u8g2.getStrWidth(text);
+        Strip strip;
+        if (!prepare(u8g2, x, y, width, strip)) {
+            u8g2.drawStr(x, y, text);
+            return;
+        }
+
+        const bool background = isBackground(strip);
+        // 화면 가장자리에서 잘린 모양과 글꼴 모드가 저장할 때와 같아야 그대로 복사할 수 있다
+        // (불투명 모드는 겹치는 글리프의 배경 상자가 앞 글자를 지우므로 모양이 다르다)
+        if (entry && background && entry->offset == strip.offset && entry->columns == strip.columns &&
+            entry->transparent == u->font_is_transparent) {
+            hits++;
+            entry->lastUsed = ++useCounter;
+            blit(strip, entry->bits);
+            return;
+        }
+
+        misses++;
+        u8g2.drawStr(x, y, text);
+        if (!background) return;
+
+        // 배경이 균일한 상태에서 그렸으므로 바뀐 비트가 곧 글리프 마스크
+        Entry& slot = entry ? *entry : victim();
+        slot.font = u->font;
+        strcpy(slot.text, text);
+        slot.width = uint16_t(width);
+        slot.offset = strip.offset;
+        slot.columns = strip.columns;
+        slot.transparent = u->font_is_transparent;
+        slot.lastUsed = ++useCounter;
+        const uint32_t backgroundBits = strip.backgroundBits();
+        for (uint8_t c = 0; c < strip.columns; c++) {
+            slot.bits[c] = readColumn(strip, c) ^ backgroundBits;
+        }
+    }
+
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+
+private:
+    struct Entry {
+        const uint8_t* font = nullptr;
+        char text[maxTextLength + 1];
+        uint16_t width;
+        int16_t offset;    // x - 스트립 왼쪽 (저장할 때)
+        uint8_t columns;   // 스트립 폭 (저장할 때)
+        uint8_t transparent;
+        uint32_t lastUsed = 0;
+        uint32_t bits[MaxColumns];  // 열마다 위쪽부터 LSB, 1 = 글리프 픽셀
+    };
+
+    // 프레임 버퍼 안에서 문자열이 차지하는 영역
+    struct Strip {
+        uint8_t* buffer;
+        size_t stride;  // 한 page(8픽셀 행)의 바이트 수
+        int left;
+        int16_t offset;  // x - left
+        int top;
+        uint8_t columns;
+        uint8_t height;
+        uint8_t color;
+
+        uint32_t heightMask() const { return height >= 32 ? 0xFFFFFFFFu : ((1u << height) - 1); }
+        uint32_t backgroundBits() const { return color ? 0 : heightMask(); }
+    };
+
+    Entry entries[Capacity];
+    uint32_t useCounter = 0;
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+
+    Entry* find(const uint8_t* font, const char* text) {
+        for (Entry& e : entries) {
+            if (e.font == font && strcmp(e.text, text) == 0) return &e;
+        }
+        return nullptr;
+    }
+
+    Entry& victim() {
+        Entry* oldest = &entries[0];
+        for (Entry& e : entries) {
+            if (e.lastUsed < oldest->lastUsed) oldest = &e;
+        }
+        return *oldest;
+    }
+
+    // 캐시를 쓸 수 있는 조건이면 strip을 채우고 true
+    bool prepare(U8G2& u8g2, int x, int y, int textWidth, Strip& strip) {
+        u8g2_t* u = u8g2.getU8g2();
+        if (u->cb != U8G2_R0 || u->draw_color > 1) return false;
+
+        // 세로는 글꼴 바운딩 박스. 가로 여유도 바운딩 박스로 정한다: 글자마다 그리는 픽셀(배경 포함)은
+        // [펜 + x_offset, 펜 + x_offset + max_char_width) 안에 있고 펜은 x + textWidth를 넘지 않는다.
+        // 글리프가 글자 간격보다 넓거나 왼쪽으로 튀어나와도 스트립 밖에 그려지는 픽셀이 없도록 (최소 1픽셀)
+        const u8g2_font_info_t& info = u->font_info;
+        const int leftMargin = info.x_offset < -1 ? -info.x_offset : 1;
+        const int rightExtent = info.x_offset + info.max_char_width;
+        const int rightMargin = rightExtent > 1 ? rightExtent : 1;
+        const int height = info.max_char_height;
+        strip.buffer = u8g2.getBufferPtr();
+        strip.stride = size_t(u8g2.getBufferTileWidth()) * 8;
+        strip.top = y - info.max_char_height - info.y_offset;
+        strip.color = u->draw_color;
+
+        // u8g2도 버퍼 밖에는 그리지 않으므로 가로는 버퍼 안으로 자른다
+        int left = x - leftMargin;
+        int right = x + textWidth + rightMargin;
+        if (left < 0) left = 0;
+        if (right > int(strip.stride)) right = int(strip.stride);
+        strip.left = left;
+        strip.offset = int16_t(x - left);
+
+        if (height <= 0 || height > 32 || right <= left || right - left > MaxColumns) return false;
+        if (strip.top < 0) return false;
+        if (strip.top + height > u8g2.getBufferTileHeight() * 8) return false;
+
+        strip.columns = uint8_t(right - left);
+        strip.height = uint8_t(height);
+        return true;
+    }
+
+    static uint32_t readColumn(const Strip& strip, uint8_t c) {
+        const uint8_t* p = strip.buffer + (strip.top >> 3) * strip.stride + strip.left + c;
+        const int shift = strip.top & 7;
+        const int pages = (shift + strip.height + 7) >> 3;
+        uint64_t acc = 0;
+        for (int i = 0; i < pages; i++, p += strip.stride) {
+            acc |= uint64_t(*p) << (8 * i);
+        }
+        return uint32_t(acc >> shift) & strip.heightMask();
+    }
+
+    // 영역 전체가 현재 그리기 색의 배경색으로 채워져 있는지
+    static bool isBackground(const Strip& strip) {
+        const uint32_t background = strip.backgroundBits();
+        for (uint8_t c = 0; c < strip.columns; c++) {
+            if (readColumn(strip, c) != background) return false;
+        }
+        return true;
+    }
+
+    // 저장된 마스크를 page 단위 바이트로 프레임 버퍼에 복사
+    static void blit(const Strip& strip, const uint32_t* bits) {
+        const int shift = strip.top & 7;
+        const int pages = (shift + strip.height + 7) >> 3;
+        uint8_t* column = strip.buffer + (strip.top >> 3) * strip.stride + strip.left;
+        for (uint8_t c = 0; c < strip.columns; c++, column++) {
+            uint64_t v = uint64_t(bits[c]) << shift;
+            uint8_t* p = column;
+            for (int i = 0; i < pages; i++, p += strip.stride, v >>= 8) {
+                const uint8_t b = uint8_t(v);
+                if (strip.color) *p |= b;
+                else *p &= uint8_t(~b);
+            }
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,224 @@
+#include "tftDmaPanel.h"
+#include <Adafruit_GFX.h>
+#include <driver/spi_master.h>
+#include <esp_heap_caps.h>
+#include <esp_lcd_panel_vendor.h>
+
+namespace {
+
+const spi_host_device_t HOST = SPI2_HOST;
+const size_t TRANSFER_QUEUE_DEPTH = 10;   // 띠 하나 = 창 명령 3개 + 픽셀 1개
+
+// ST7789 GRAM은 240x320. 작은 패널은 가운데에 놓이므로 (Adafruit_ST7789::init과 같은 계산)
+int16_t gap(int16_t ramSide, int16_t panelSide) { return int16_t((ramSide - panelSide) / 2); }
+
+// 띠 버퍼에 글자를 그리는 Adafruit_GFX. 캔버스 좌표 top..top+lines 줄만 버퍼에 쓴다
+class BandCanvas : public Adafruit_GFX {
+public:
+    BandCanvas(int16_t w, int16_t h) : Adafruit_GFX(w, h) {}
+
+    void target(uint16_t* band, int16_t firstLine, int16_t lineCount) {
+        pixels = band;
+        top = firstLine;
+        lines = lineCount;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        y -= top;
+        if (x < 0 || x >= _width || y < 0 || y >= lines) return;
+        pixels[y * _width + x] = color;
+    }
+
+private:
+    uint16_t* pixels = nullptr;
+    int16_t top = 0;
+    int16_t lines = 0;
+};
+
+}  // namespace
+
+esp_err_t TftDmaPanel::begin(const Pins& pins, int16_t width, int16_t height, uint32_t clockHz) {
+    end();
+    panelWidth = width;
+    panelHeight = height;
+    const size_t bandBytes = size_t(width) * BAND_LINES * sizeof(uint16_t);
+
+    // 버퍼와 세마포어를 먼저 (완료 콜백이 쓴다)
+    esp_err_t err = ESP_OK;
+    for (uint8_t i = 0; i < BUFFER_COUNT && err == ESP_OK; i++) {
+        buffers[i] = static_cast<uint16_t*>(heap_caps_malloc(bandBytes, MALLOC_CAP_DMA));
+        if (!buffers[i]) err = ESP_ERR_NO_MEM;
+    }
+    if (err == ESP_OK) {
+        freeBuffers = xSemaphoreCreateCounting(BUFFER_COUNT, BUFFER_COUNT);
+        if (!freeBuffers) err = ESP_ERR_NO_MEM;
+    }
+
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num = pins.mosi;
+    bus.miso_io_num = -1;
+    bus.sclk_io_num = pins.sclk;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = int(bandBytes);   // 띠 하나가 DMA 전송 하나
+    if (err == ESP_OK) {
+        err = spi_bus_initialize(HOST, &bus, SPI_DMA_CH_AUTO);
+        busInitialized = err == ESP_OK;
+    }
+
+    if (err == ESP_OK) {
+        esp_lcd_panel_io_spi_config_t config = {};
+        config.dc_gpio_num = pins.dc;
+        config.cs_gpio_num = pins.cs;
+        config.pclk_hz = clockHz;
+        config.lcd_cmd_bits = 8;
+        config.lcd_param_bits = 8;
+        config.spi_mode = 0;
+        config.trans_queue_depth = TRANSFER_QUEUE_DEPTH;
+        config.on_color_trans_done = onTransferDone;
+        config.user_ctx = this;
+        err = esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)HOST, &config, &io);
+    }
+
+    if (err == ESP_OK) {
+        esp_lcd_panel_dev_config_t device = {};
+        device.reset_gpio_num = pins.rst;
+        device.bits_per_pixel = 16;
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+        device.rgb_ele_order = LCD_RGB_ELEMENT_ORDER_RGB;
+#else
+        device.color_space = ESP_LCD_COLOR_SPACE_RGB;
+#endif
+        err = esp_lcd_new_panel_st7789(io, &device, &panel);
+    }
+
+    if (err == ESP_OK) err = esp_lcd_panel_reset(panel);
+    if (err == ESP_OK) err = esp_lcd_panel_init(panel);
+    // 이 패널은 반전을 끈 상태가 정상 색 (예제들의 invertDisplay(false)와 같음)
+    if (err == ESP_OK) err = esp_lcd_panel_invert_color(panel, false);
+    if (err == ESP_OK) {
+        const bool landscape = width > height;
+        const int16_t shortSide = landscape ? height : width;
+        const int16_t longSide = landscape ? width : height;
+        const int16_t shortGap = gap(240, shortSide);
+        const int16_t longGap = gap(320, longSide);
+        // Adafruit setRotation(1) = MY|MV, setRotation(0) = MX|MY
+        err = esp_lcd_panel_swap_xy(panel, landscape);
+        if (err == ESP_OK) err = esp_lcd_panel_mirror(panel, !landscape, true);
+        if (err == ESP_OK) {
+            err = landscape ? esp_lcd_panel_set_gap(panel, longGap, shortGap)
+                            : esp_lcd_panel_set_gap(panel, shortGap, longGap);
+        }
+    }
+#if ESP_IDF_VERSION_MAJOR >= 5
+    if (err == ESP_OK) err = esp_lcd_panel_disp_on_off(panel, true);
+#else
+    if (err == ESP_OK) err = esp_lcd_panel_disp_off(panel, false);
+#endif
+
+    if (err != ESP_OK) end();
+    return err;
+}
+
+void TftDmaPanel::end() {
+    if (freeBuffers) {
+        waitIdle();
+        vSemaphoreDelete(freeBuffers);
+        freeBuffers = nullptr;
+    }
+    if (panel) {
+        esp_lcd_panel_del(panel);
+        panel = nullptr;
+    }
+    if (io) {
+        esp_lcd_panel_io_del(io);
+        io = nullptr;
+    }
+    if (busInitialized) {
+        spi_bus_free(HOST);
+        busInitialized = false;
+    }
+    for (uint8_t i = 0; i < BUFFER_COUNT; i++) {
+        heap_caps_free(buffers[i]);
+        buffers[i] = nullptr;
+    }
+    next = 0;
+}
+
+uint16_t* TftDmaPanel::acquireBand() {
+    xSemaphoreTake(freeBuffers, portMAX_DELAY);
+    return buffers[next];
+}
+
+void TftDmaPanel::sendBand(int16_t x, int16_t y, int16_t w, int16_t h) {
+    // 창 명령은 앞 전송이 끝난 뒤에 나가고, 픽셀은 큐에 들어간 채로 반환된다
+    if (esp_lcd_panel_draw_bitmap(panel, x, y, x + w, y + h, buffers[next]) != ESP_OK) {
+        xSemaphoreGive(freeBuffers);   // 전송되지 않았으므로 완료 콜백도 없다
+    }
+    next = uint8_t((next + 1) % BUFFER_COUNT);
+}
+
+void TftDmaPanel::waitIdle() {
+    for (uint8_t i = 0; i < BUFFER_COUNT; i++) xSemaphoreTake(freeBuffers, portMAX_DELAY);
+    for (uint8_t i = 0; i < BUFFER_COUNT; i++) xSemaphoreGive(freeBuffers);
+}
+
+void TftDmaPanel::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > panelWidth) w = int16_t(panelWidth - x);
+    if (y + h > panelHeight) h = int16_t(panelHeight - y);
+    if (w <= 0 || h <= 0) return;
+
+    const uint16_t value = toPanel(color);
+    for (int16_t top = 0; top < h; top += BAND_LINES) {
+        const int16_t lines = h - top < BAND_LINES ? int16_t(h - top) : BAND_LINES;
+        uint16_t* pixels = acquireBand();
+        const size_t count = size_t(w) * lines;
+        for (size_t i = 0; i < count; i++) pixels[i] = value;
+        sendBand(x, int16_t(y + top), w, lines);
+    }
+}
+
+void TftDmaPanel::drawFrame(RenderBand render, void* context) {
+    for (int16_t top = 0; top < panelHeight; top += BAND_LINES) {
+        const int16_t lines = panelHeight - top < BAND_LINES ? int16_t(panelHeight - top) : BAND_LINES;
+        uint16_t* pixels = acquireBand();
+        render(pixels, top, lines, context);
+        sendBand(0, top, panelWidth, lines);
+    }
+}
+
+void TftDmaPanel::drawText(int16_t x, int16_t y, const char* text, uint16_t color, uint16_t background,
+                           uint8_t size) {
+    if (x < 0 || y < 0 || x >= panelWidth || y >= panelHeight || size == 0) return;
+    const size_t textWidth = strlen(text) * 6 * size;
+    const int16_t w = textWidth < size_t(panelWidth - x) ? int16_t(textWidth) : int16_t(panelWidth - x);
+    int16_t h = int16_t(8 * size);
+    if (y + h > panelHeight) h = int16_t(panelHeight - y);
+    if (w <= 0) return;
+
+    BandCanvas canvas(w, h);
+    canvas.setTextWrap(false);
+    canvas.setTextSize(size);
+    canvas.setTextColor(toPanel(color), toPanel(background));
+    // 글자가 띠보다 크면 띠 높이씩 나눠 여러 번 그린다
+    for (int16_t top = 0; top < h; top += BAND_LINES) {
+        const int16_t lines = h - top < BAND_LINES ? int16_t(h - top) : BAND_LINES;
+        canvas.target(acquireBand(), top, lines);
+        canvas.setCursor(0, 0);
+        canvas.print(text);
+        sendBand(x, int16_t(y + top), w, lines);
+    }
+}
+
+#if ESP_IDF_VERSION_MAJOR >= 5
+bool TftDmaPanel::onTransferDone(esp_lcd_panel_io_handle_t, esp_lcd_panel_io_event_data_t*, void* context) {
+#else
+bool TftDmaPanel::onTransferDone(esp_lcd_panel_io_handle_t, void* context, void*) {
+#endif
+    // ISR: 픽셀 전송 하나가 끝났으니 그 버퍼를 돌려준다
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(static_cast<TftDmaPanel*>(context)->freeBuffers, &woken);
+    return woken == pdTRUE;
+}
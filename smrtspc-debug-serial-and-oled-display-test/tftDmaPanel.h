@@ -0,0 +1,80 @@
+#ifndef TFT_DMA_PANEL_H
+#define TFT_DMA_PANEL_H
+
+#include <Arduino.h>
+#include <esp_idf_version.h>
+#include <esp_lcd_panel_io.h>
+#include <esp_lcd_panel_ops.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// ST7789 TFT (예: 284x76)를 ESP-IDF esp_lcd(esp_lcd_panel_io_spi)로 구동한다.
+//  - 하드웨어 SPI(SPI2_HOST) + DMA. 픽셀은 띠(band, 화면 폭 x BAND_LINES줄) 단위로 창을 열어 한 번에 보낸다.
+//  - 띠 버퍼는 두 개. 전송은 큐에 넣고 바로 돌아오므로, 한 띠가 DMA로 나가는 동안 CPU는 다음 띠를 그린다.
+//    전송이 끝나면 완료 콜백(ISR)이 버퍼를 돌려준다 (acquireBand()는 빈 버퍼가 생길 때까지 기다림).
+//  - esp_lcd는 창 명령(CASET/RASET/RAMWR)을 보내기 전에 앞 픽셀 전송이 끝나기를 기다리므로
+//    겹치는 것은 "다음 띠 그리기"와 "이번 띠 전송"이다.
+//  - 띠 버퍼의 픽셀은 패널 바이트 순서(빅 엔디언 RGB565). color565() 값은 toPanel()로 바꿔 넣는다.
+// Adafruit_ST7789와 같은 SPI 버스를 동시에 쓸 수 없으므로 Arduino SPI는 SPI.end()로 놓은 뒤 begin()한다.
+class TftDmaPanel {
+public:
+    static constexpr int16_t BAND_LINES = 16;
+    static constexpr uint8_t BUFFER_COUNT = 2;
+
+    struct Pins {
+        int8_t sclk;
+        int8_t mosi;
+        int8_t cs;
+        int8_t dc;
+        int8_t rst;
+    };
+
+    // 한 띠 그리기: pixels는 width() x lines, 화면 y부터
+    using RenderBand = void (*)(uint16_t* pixels, int16_t y, int16_t lines, void* context);
+
+    TftDmaPanel() = default;
+    ~TftDmaPanel() { end(); }
+    TftDmaPanel(const TftDmaPanel&) = delete;
+    TftDmaPanel& operator=(const TftDmaPanel&) = delete;
+
+    // width > height 이면 가로 방향 (Adafruit setRotation(1)과 같은 방향)
+    esp_err_t begin(const Pins& pins, int16_t width, int16_t height, uint32_t clockHz);
+    void end();
+
+    int16_t width() const { return panelWidth; }
+    int16_t height() const { return panelHeight; }
+
+    // 빈 띠 버퍼 (앞 전송이 끝날 때까지 기다림). 채운 뒤 반드시 sendBand()로 보낸다
+    uint16_t* acquireBand();
+    // 방금 받은 버퍼의 앞 w x h 픽셀을 이 창으로 전송 (큐에 넣고 바로 반환)
+    void sendBand(int16_t x, int16_t y, int16_t w, int16_t h);
+    // 큐에 넣은 전송이 모두 끝날 때까지
+    void waitIdle();
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void fillScreen(uint16_t color) { fillRect(0, 0, panelWidth, panelHeight, color); }
+    // 화면 전체를 띠마다 render로 그리며 전송
+    void drawFrame(RenderBand render, void* context);
+    // Adafruit 기본 글꼴(6x8) x size. 배경색으로 글자 칸 전체를 덮고, 화면 오른쪽에서 잘린다
+    void drawText(int16_t x, int16_t y, const char* text, uint16_t color, uint16_t background, uint8_t size = 1);
+
+    static uint16_t toPanel(uint16_t color) { return uint16_t((color << 8) | (color >> 8)); }
+
+private:
+    esp_lcd_panel_io_handle_t io = nullptr;
+    esp_lcd_panel_handle_t panel = nullptr;
+    SemaphoreHandle_t freeBuffers = nullptr;   // 전송이 끝나 다시 쓸 수 있는 버퍼 수
+    uint16_t* buffers[BUFFER_COUNT] = {};
+    uint8_t next = 0;                          // 다음에 채울 버퍼
+    bool busInitialized = false;
+    int16_t panelWidth = 0;
+    int16_t panelHeight = 0;
+
+#if ESP_IDF_VERSION_MAJOR >= 5
+    static bool onTransferDone(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t* event, void* context);
+#else
+    static bool onTransferDone(esp_lcd_panel_io_handle_t io, void* context, void* event);
+#endif
+};
+
+#endif
@@ -0,0 +1,245 @@
+#include "tickerFetcher.h"
+#include "metricsRegistry.h"
+
+namespace {
+
+// 읽을 데이터가 올 때까지 대기. 연결이 끊기거나 시간이 지나면 false
+bool waitForData(WiFiClient& client, uint32_t deadline) {
+    while (client.available() <= 0) {
+        if (!client.connected() || int32_t(millis() - deadline) >= 0) return false;
+        delay(1);
+    }
+    return true;
+}
+
+// 한 줄 읽기 (chunked 조각 머리). '\r\n'은 떼고 넘치는 문자는 버린다
+bool readLine(WiFiClient& client, char* line, size_t size, uint32_t deadline) {
+    size_t length = 0;
+    while (true) {
+        if (!waitForData(client, deadline)) return false;
+        const int c = client.read();
+        if (c < 0) continue;
+        if (c == '\n') break;
+        if (c != '\r' && length + 1 < size) line[length++] = char(c);
+    }
+    line[length] = '\0';
+    return true;
+}
+
+}  // namespace
+
+bool TickerFetcher::begin(const char* const* markets, uint8_t count, const char* baseUrl, uint32_t interval) {
+    if (count == 0 || count > TickerSnapshot::MAX_MARKETS || !baseUrl) return false;
+
+    pending = TickerSnapshot();
+    pending.count = count;
+
+    url = baseUrl;
+    url += "/v1/ticker?markets=";
+    for (uint8_t i = 0; i < count; i++) {
+        strncpy(pending.quotes[i].market, markets[i], sizeof(pending.quotes[i].market) - 1);
+        if (i > 0) url += ",";
+        url += pending.quotes[i].market;
+    }
+
+    secure = strncmp(baseUrl, "https://", 8) == 0;
+    intervalMs = interval;
+
+    // 인증서 검증 없이 암호화만 (기존 HTTPClient::begin(url)의 https 동작과 같음)
+    secureClient.setInsecure();
+    http.setReuse(true);
+
+    // 본문을 직접 읽으므로 전송 방식(chunked 여부) 헤더가 필요하다
+    static const char* headerKeys[] = {"Transfer-Encoding"};
+    http.collectHeaders(headerKeys, 1);
+
+    return prices.begin();
+}
+
+bool TickerFetcher::start(uint32_t stackBytes, UBaseType_t priority) {
+    if (task) return true;
+    if (pending.count == 0) return false;
+    task = Tasks.spawn("Ticker", taskEntry, this, stackBytes, priority);
+    return task != nullptr;
+}
+
+void TickerFetcher::taskEntry(void* parameter) {
+    TickerFetcher* self = static_cast<TickerFetcher*>(parameter);
+    TickType_t lastWake = xTaskGetTickCount();
+
+    while (true) {
+        {
+            WorkTimer work;
+            self->refresh();
+        }
+        // WiFi가 끊긴 동안은 조회 주기 대신 재연결 간격으로 깨어나서, 다시 붙으면 바로 조회
+        if (self->reconnectDelayMs != 0 && self->reconnectDelayMs < self->intervalMs) {
+            vTaskDelay(pdMS_TO_TICKS(self->reconnectDelayMs));
+            lastWake = xTaskGetTickCount();
+            continue;
+        }
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(self->intervalMs));
+    }
+}
+
+bool TickerFetcher::refresh() {
+    static MetricsRegistry::Histogram& latencyHistogram = Metrics.histogram("http.fetch_ms");
+    static MetricsRegistry::Counter& failureCounter = Metrics.counter("http.failures");
+
+    if (WiFi.status() != WL_CONNECTED) {
+        reconnectWiFi();
+        failureCounter.add();
+        portENTER_CRITICAL(&statsLock);
+        stats.requests++;
+        stats.failures++;
+        stats.lastHttpCode = 0;
+        portEXIT_CRITICAL(&statsLock);
+        return false;
+    }
+    reconnectDelayMs = 0;
+
+    const uint32_t startMs = millis();
+    WiFiClient& client = secure ? static_cast<WiFiClient&>(secureClient) : plainClient;
+    const bool reused = client.connected();
+
+    http.begin(client, url);
+    const int httpCode = http.GET();
+
+    uint32_t bodyBytes = 0;
+    bool complete = false;
+    received = 0;
+    if (httpCode == HTTP_CODE_OK) {
+        complete = readQuotes(bodyBytes) && !parser.hasError();
+    }
+    // 본문을 끝까지 읽지 못했으면 연결 상태를 알 수 없으므로 닫고 다음에 새로 연결
+    if (httpCode > 0 && !complete) client.stop();
+    http.end();  // keep-alive 응답이면 연결은 닫히지 않고 다음 조회에서 다시 쓴다
+
+    const uint32_t latency = millis() - startMs;
+    const bool success = received > 0;
+    latencyHistogram.record(latency);
+    if (!success) failureCounter.add();
+
+    portENTER_CRITICAL(&statsLock);
+    stats.requests++;
+    if (!success) stats.failures++;
+    if (reused) {
+        stats.reusedConnections++;
+    } else if (httpCode > 0) {
+        stats.newConnections++;
+        if (secure) stats.tlsHandshakes++;
+    }
+    stats.lastHttpCode = httpCode;
+    stats.lastBodyBytes = bodyBytes;
+    stats.lastLatencyMs = latency;
+    if (latency > stats.maxLatencyMs) stats.maxLatencyMs = latency;
+    stats.totalLatencyMs += latency;
+    portEXIT_CRITICAL(&statsLock);
+
+    if (success) {
+        pending.complete = received == pending.count;
+        pending.fetchedAtMs = millis();
+        prices.publish(pending);
+    }
+    return success && pending.complete;
+}
+
+void TickerFetcher::reconnectWiFi() {
+    const uint32_t now = millis();
+    if (reconnectDelayMs != 0 && int32_t(now - nextReconnectMs) < 0) return;
+
+    // 끊기기 전의 소켓은 쓸 수 없으므로 닫아 두고 다음 조회에서 새로 연결
+    secureClient.stop();
+    plainClient.stop();
+    WiFi.reconnect();
+
+    reconnectDelayMs = reconnectDelayMs == 0 ? RECONNECT_MIN_MS : min(reconnectDelayMs * 2, RECONNECT_MAX_MS);
+    nextReconnectMs = now + reconnectDelayMs;
+
+    portENTER_CRITICAL(&statsLock);
+    stats.wifiReconnects++;
+    portEXIT_CRITICAL(&statsLock);
+}
+
+bool TickerFetcher::readQuotes(uint32_t& bodyBytes) {
+    for (uint8_t i = 0; i < pending.count; i++) {
+        pending.quotes[i].valid = false;
+    }
+    received = 0;
+    parser.reset(onQuote, this);
+
+    WiFiClient* stream = http.getStreamPtr();
+    if (!stream) return false;
+    WiFiClient& client = *stream;
+    const uint32_t deadline = millis() + BODY_TIMEOUT_MS;
+    const int contentLength = http.getSize();
+    const bool chunked = http.header("Transfer-Encoding").equalsIgnoreCase("chunked");
+    char buffer[READ_CHUNK];
+
+    // length 바이트를 읽어 파서에 넣는다 (길이를 모르면 연결이 닫힐 때까지)
+    auto feed = [&](uint32_t length) {
+        while (length > 0) {
+            if (!waitForData(client, deadline)) return false;
+            const int count = client.read(reinterpret_cast<uint8_t*>(buffer),
+                                          length < sizeof(buffer) ? length : sizeof(buffer));
+            if (count <= 0) continue;
+            parser.feed(buffer, count);
+            bodyBytes += count;
+            length -= count;
+        }
+        return true;
+    };
+
+    if (chunked) {
+        // 조각 머리(16진수 길이) + 데이터 + CRLF, 길이 0인 조각과 빈 줄로 끝난다
+        char line[16];
+        while (true) {
+            if (!readLine(client, line, sizeof(line), deadline)) return false;
+            const uint32_t length = strtoul(line, nullptr, 16);
+            if (length == 0) break;
+            if (!feed(length) || !readLine(client, line, sizeof(line), deadline)) return false;
+        }
+        do {
+            if (!readLine(client, line, sizeof(line), deadline)) return false;
+        } while (line[0] != '\0');
+        return true;
+    }
+
+    if (contentLength >= 0) return feed(contentLength);
+
+    feed(UINT32_MAX);  // 길이 정보가 없으면 서버가 연결을 닫을 때까지
+    return parser.isDone();
+}
+
+void TickerFetcher::onQuote(const TickerQuote& quote, void* context) {
+    TickerFetcher* self = static_cast<TickerFetcher*>(context);
+
+    // 응답 순서는 요청 순서와 다를 수 있으므로 마켓 이름으로 찾는다
+    for (uint8_t i = 0; i < self->pending.count; i++) {
+        TickerQuote& slot = self->pending.quotes[i];
+        if (slot.valid || strcmp(slot.market, quote.market) != 0) continue;
+        slot = quote;
+        slot.valid = true;
+        self->received++;
+        return;
+    }
+}
+
+TickerFetchStats TickerFetcher::getStats() {
+    portENTER_CRITICAL(&statsLock);
+    TickerFetchStats copy = stats;
+    portEXIT_CRITICAL(&statsLock);
+    return copy;
+}
+
+void TickerFetcher::printStats(Print& out) {
+    const TickerFetchStats copy = getStats();
+    out.printf("Ticker: requests %lu, failed %lu, wifi reconnects %lu, connects %lu (tls %lu), reused %lu, http %d\n",
+               (unsigned long)copy.requests, (unsigned long)copy.failures, (unsigned long)copy.wifiReconnects,
+               (unsigned long)copy.newConnections,
+               (unsigned long)copy.tlsHandshakes, (unsigned long)copy.reusedConnections, copy.lastHttpCode);
+    out.printf("Ticker latency: last %lu ms, avg %lu ms, max %lu ms, body %lu bytes\n",
+               (unsigned long)copy.lastLatencyMs,
+               (unsigned long)(copy.requests ? copy.totalLatencyMs / copy.requests : 0),
+               (unsigned long)copy.maxLatencyMs, (unsigned long)copy.lastBodyBytes);
+}
@@ -0,0 +1,114 @@
+#ifndef TICKER_FETCHER_H
+#define TICKER_FETCHER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
+#include "taskRuntime.h"
+#include "tickerParser.h"
+
+// Upbit 시세(ticker) 조회기.
+//  - 설정한 마켓 전체를 한 번의 요청으로 묶어서 조회한다 (/v1/ticker?markets=KRW-BTC,KRW-ETH,...)
+//  - TLS 연결은 keep-alive로 유지하고 다음 조회에서 다시 쓴다 (핸드셰이크는 연결이 끊겼을 때만)
+//  - 응답 본문은 버퍼에 모으지 않고 소켓에서 읽는 대로 TickerParser에 넣는다 (힙 할당 없음)
+//  - 조회는 자체 백그라운드 태스크가 주기적으로 하고, 결과는 Mailbox로 발행한다.
+//    화면 태스크는 reader()로 받은 Reader로 새 시세가 올 때까지 기다리기만 하면 된다.
+//  - WiFi가 끊겨 있으면 조회 대신 WiFi.reconnect()를 부른다. 재연결 시도 간격은 1초부터 두 배씩 최대 5분
+//    (코어의 자동 재연결은 끊김 이벤트가 한 번 올 때만 시도하므로 AP가 오래 꺼져 있으면 다시 붙지 않는다)
+//  - 기본 주소는 https://api.upbit.com. 테스트할 때는 server.py의 모의 서버(http://<PC IP>:5003)를 지정
+struct TickerSnapshot {
+    static constexpr uint8_t MAX_MARKETS = 6;
+
+    TickerQuote quotes[MAX_MARKETS];
+    uint8_t count;
+    bool complete;           // 모든 마켓을 받았을 때 true
+    uint32_t fetchedAtMs;    // 조회 완료 시각 (millis)
+};
+
+struct TickerFetchStats {
+    uint32_t requests = 0;
+    uint32_t failures = 0;
+    uint32_t wifiReconnects = 0;    // WiFi.reconnect() 호출 수
+    uint32_t newConnections = 0;    // 새 연결을 연 횟수 (keep-alive면 첫 조회 이후 증가하지 않아야 함)
+    uint32_t tlsHandshakes = 0;     // 그중 https 연결 (http 모의 서버면 0)
+    uint32_t reusedConnections = 0; // 기존 연결을 다시 쓴 횟수
+    int lastHttpCode = 0;
+    uint32_t lastBodyBytes = 0;     // 마지막 응답 본문 크기
+    uint32_t lastLatencyMs = 0;     // 요청 시작부터 파싱 완료까지
+    uint32_t maxLatencyMs = 0;
+    uint64_t totalLatencyMs = 0;
+};
+
+class TickerFetcher {
+public:
+    // 싱글톤 인스턴스 반환
+    static TickerFetcher& getInstance() {
+        static TickerFetcher instance;
+        return instance;
+    }
+
+    // 조회할 마켓과 서버 설정. markets는 "KRW-BTC" 형식, 최대 TickerSnapshot::MAX_MARKETS개
+    bool begin(const char* const* markets, uint8_t count,
+               const char* baseUrl = DEFAULT_BASE_URL, uint32_t intervalMs = 60000);
+
+    // 백그라운드 조회 태스크 시작 (시작하자마자 한 번 조회)
+    bool start(uint32_t stackBytes = 8192, UBaseType_t priority = TaskPriority::Background);
+
+    // 지금 한 번 조회하고 결과를 발행. 태스크를 쓰지 않을 때 직접 호출해도 된다.
+    bool refresh();
+
+    // 시세를 받을 태스크마다 하나씩 (start() 전에)
+    Mailbox<TickerSnapshot>::Reader reader() { return prices.reader(); }
+
+    TickerFetchStats getStats();
+    void printStats(Print& out);
+
+    static constexpr const char* DEFAULT_BASE_URL = "https://api.upbit.com";
+
+private:
+    // 생성자/소멸자 private로 선언하여 싱글톤 패턴 유지
+    TickerFetcher() = default;
+    ~TickerFetcher() = default;
+    TickerFetcher(const TickerFetcher&) = delete;
+    TickerFetcher& operator=(const TickerFetcher&) = delete;
+
+    static void taskEntry(void* parameter);
+
+    // 응답 본문을 스트림에서 읽으며 pending을 채운다. 본문을 끝까지 읽었으면 true
+    bool readQuotes(uint32_t& bodyBytes);
+    static void onQuote(const TickerQuote& quote, void* context);
+    // WiFi가 끊겼을 때 간격을 늘려 가며 재연결 시도
+    void reconnectWiFi();
+
+    static constexpr uint32_t BODY_TIMEOUT_MS = 5000;
+    static constexpr size_t READ_CHUNK = 128;   // 스택 읽기 버퍼
+    static constexpr uint32_t RECONNECT_MIN_MS = 1000;
+    static constexpr uint32_t RECONNECT_MAX_MS = 300000;
+
+    String url;
+    bool secure = true;
+    uint32_t intervalMs = 60000;
+    TickerSnapshot pending = TickerSnapshot();   // 조회 중인 시세 (마지막 값 유지)
+    uint8_t received = 0;
+    TickerParser parser;
+
+    // 조회 사이에 유지되는 연결 (https면 secureClient, http면 plainClient)
+    WiFiClientSecure secureClient;
+    WiFiClient plainClient;
+    HTTPClient http;
+
+    Mailbox<TickerSnapshot> prices;
+    TaskHandle_t task = nullptr;
+
+    uint32_t reconnectDelayMs = 0;   // 0 = 연결됨 (다음 끊김에서 바로 시도)
+    uint32_t nextReconnectMs = 0;
+
+    TickerFetchStats stats;
+    portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+};
+
+// 전역 인스턴스 참조
+inline TickerFetcher& Tickers = TickerFetcher::getInstance();
+
+#endif
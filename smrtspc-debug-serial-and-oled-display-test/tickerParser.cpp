@@ -0,0 +1,243 @@
+#include "tickerParser.h"
+#include <stdlib.h>
+
+namespace {
+
+// 응답 필드 이름 (TickerParser::Field 순서)
+const char* const fieldNames[] = {
+    "market",
+    "trade_price",
+    "prev_closing_price",
+    "trade_date_kst",
+    "trade_time_kst"
+};
+
+// 시세 객체의 깊이 (최상위 배열 = 1)
+constexpr uint8_t QUOTE_DEPTH = 2;
+
+}  // namespace
+
+void TickerParser::reset(QuoteHandler newHandler, void* newContext) {
+    handler = newHandler;
+    context = newContext;
+    quote = TickerQuote();
+    quoteCount = 0;
+    depth = 0;
+    objectLevels = 0;
+    expectKey = false;
+    inString = false;
+    stringIsKey = false;
+    escaped = false;
+    inScalar = false;
+    done = false;
+    error = false;
+    field = NONE;
+    tokenLength = 0;
+    tokenOverflow = false;
+}
+
+bool TickerParser::feed(const char* data, size_t length) {
+    for (size_t i = 0; i < length && !error; i++) {
+        process(data[i]);
+    }
+    return !error;
+}
+
+void TickerParser::process(char c) {
+    if (inString) {
+        if (escaped) {
+            escaped = false;
+            appendToken(c);  // 관심 필드에는 이스케이프가 없으므로 문자만 남긴다
+        } else if (c == '\\') {
+            escaped = true;
+        } else if (c == '"') {
+            inString = false;
+            endString();
+        } else {
+            appendToken(c);
+        }
+        return;
+    }
+
+    if (inScalar) {
+        if (c != ',' && c != '}' && c != ']' && c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+            appendToken(c);
+            return;
+        }
+        inScalar = false;
+        endScalar();
+    }
+
+    switch (c) {
+        case '"':
+            inString = true;
+            stringIsKey = inObject() && expectKey;
+            startToken();
+            break;
+        case '{':
+            field = NONE;
+            if (depth == 0) {
+                error = true;  // 시세 응답은 배열 (오류 응답은 객체)
+                return;
+            }
+            if (!push(true)) return;
+            expectKey = true;
+            if (depth == QUOTE_DEPTH) quote = TickerQuote();
+            break;
+        case '[':
+            field = NONE;
+            push(false);
+            break;
+        case '}': {
+            const bool quoteEnd = depth == QUOTE_DEPTH;
+            field = NONE;
+            if (!pop(true)) return;
+            if (quoteEnd) {
+                quoteCount++;
+                if (handler) handler(quote, context);
+            }
+            break;
+        }
+        case ']':
+            if (pop(false) && depth == 0) done = true;
+            field = NONE;
+            break;
+        case ':':
+            expectKey = false;
+            break;
+        case ',':
+            if (inObject()) expectKey = true;
+            break;
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+            break;
+        default:
+            // 숫자, true/false/null
+            if (depth == 0) {
+                error = true;
+                return;
+            }
+            inScalar = true;
+            startToken();
+            appendToken(c);
+            break;
+    }
+}
+
+bool TickerParser::push(bool object) {
+    if (depth >= MAX_DEPTH || done) {
+        error = true;
+        return false;
+    }
+    if (object) {
+        objectLevels |= 1u << depth;
+    } else {
+        objectLevels &= ~(1u << depth);
+    }
+    depth++;
+    return true;
+}
+
+bool TickerParser::pop(bool object) {
+    if (depth == 0 || inObject() != object) {
+        error = true;
+        return false;
+    }
+    depth--;
+    if (inObject()) expectKey = false;
+    return true;
+}
+
+void TickerParser::startToken() {
+    tokenLength = 0;
+    tokenOverflow = false;
+}
+
+void TickerParser::appendToken(char c) {
+    // 관심 없는 값은 저장하지 않는다 (길이에 상관없이 건너뜀)
+    if (depth != QUOTE_DEPTH || (!stringIsKey && field == NONE)) return;
+    if (tokenLength + 1 < TOKEN_SIZE) {
+        token[tokenLength++] = c;
+    } else {
+        tokenOverflow = true;
+    }
+}
+
+void TickerParser::endString() {
+    token[tokenLength] = '\0';
+
+    if (stringIsKey) {
+        stringIsKey = false;
+        field = NONE;
+        if (depth != QUOTE_DEPTH || tokenOverflow) return;
+        for (uint8_t i = 0; i < sizeof(fieldNames) / sizeof(fieldNames[0]); i++) {
+            if (strcmp(token, fieldNames[i]) == 0) {
+                field = Field(i);
+                break;
+            }
+        }
+        return;
+    }
+
+    assign();
+}
+
+void TickerParser::endScalar() {
+    token[tokenLength] = '\0';
+    assign();
+}
+
+void TickerParser::assign() {
+    if (depth != QUOTE_DEPTH || field == NONE) return;
+
+    switch (field) {
+        case MARKET:
+            strncpy(quote.market, token, sizeof(quote.market) - 1);
+            quote.market[sizeof(quote.market) - 1] = '\0';
+            quote.valid = true;
+            break;
+        case TRADE_PRICE:
+            quote.price = strtof(token, nullptr);
+            break;
+        case PREV_CLOSING_PRICE:
+            quote.prevClose = strtof(token, nullptr);
+            break;
+        case TRADE_DATE:
+            formatDate(token, quote.date);
+            break;
+        case TRADE_TIME:
+            formatTime(token, quote.time);
+            break;
+        default:
+            break;
+    }
+    field = NONE;
+}
+
+void TickerParser::formatDate(const char* digits, char* out) {
+    if (!digits || strlen(digits) < 8) {
+        strcpy(out, "0000/00/00");
+        return;
+    }
+    memcpy(out, digits, 4);
+    out[4] = '/';
+    memcpy(out + 5, digits + 4, 2);
+    out[7] = '/';
+    memcpy(out + 8, digits + 6, 2);
+    out[10] = '\0';
+}
+
+void TickerParser::formatTime(const char* digits, char* out) {
+    if (!digits || strlen(digits) < 6) {
+        strcpy(out, "00:00:00");
+        return;
+    }
+    memcpy(out, digits, 2);
+    out[2] = ':';
+    memcpy(out + 3, digits + 2, 2);
+    out[5] = ':';
+    memcpy(out + 6, digits + 4, 2);
+    out[8] = '\0';
+}
@@ -0,0 +1,100 @@
+#ifndef TICKER_PARSER_H
+#define TICKER_PARSER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// 마켓 하나의 시세 (필요한 필드만)
+struct TickerQuote {
+    char market[12];    // "KRW-BTC"
+    float price;        // trade_price
+    float prevClose;    // prev_closing_price
+    char date[11];      // YYYY/MM/DD (KST)
+    char time[9];       // HH:MM:SS (KST)
+    bool valid;
+
+    // "KRW-BTC" -> "BTC"
+    const char* symbol() const {
+        const char* dash = strchr(market, '-');
+        return dash ? dash + 1 : market;
+    }
+
+    // 전일 종가 대비 변동률(%). 종가가 없으면 0
+    float changePercent() const {
+        return prevClose > 0 ? (price - prevClose) / prevClose * 100 : 0;
+    }
+};
+
+// Upbit /v1/ticker 응답([{...}, {...}])을 조각 단위로 받아 읽는 스트리밍 파서.
+// 응답 전체를 메모리에 올리지 않고, 바이트가 들어오는 대로 상태만 바꾸며
+// market, trade_price, prev_closing_price, trade_date_kst, trade_time_kst 만 골라 TickerQuote에 채운다.
+// 나머지 필드는 값을 저장하지 않고 건너뛴다. 힙 할당이 없고 하드웨어에 의존하지 않는다.
+//
+//   parser.reset(onQuote, context);
+//   while (...) parser.feed(buffer, length);   // 배열 안의 객체가 끝날 때마다 onQuote 호출
+//   parser.isDone()
+class TickerParser {
+public:
+    typedef void (*QuoteHandler)(const TickerQuote& quote, void* context);
+
+    void reset(QuoteHandler handler = nullptr, void* context = nullptr);
+
+    // 응답 조각 입력. 문법 오류가 있었으면 false (이후 입력은 무시)
+    bool feed(const char* data, size_t length);
+
+    bool isDone() const { return done; }        // 최상위 배열이 닫힘
+    bool hasError() const { return error; }
+    uint16_t getQuoteCount() const { return quoteCount; }
+
+    // "20240131" -> "2024/01/31", "093015" -> "09:30:15" (자릿수가 모자라면 0으로 채운 값)
+    static void formatDate(const char* digits, char* out);
+    static void formatTime(const char* digits, char* out);
+
+private:
+    static constexpr uint8_t MAX_DEPTH = 16;
+    static constexpr uint8_t TOKEN_SIZE = 24;   // 가장 긴 관심 필드 이름/값보다 길게
+
+    enum Field : int8_t {
+        NONE = -1,
+        MARKET,
+        TRADE_PRICE,
+        PREV_CLOSING_PRICE,
+        TRADE_DATE,
+        TRADE_TIME
+    };
+
+    QuoteHandler handler = nullptr;
+    void* context = nullptr;
+
+    TickerQuote quote;
+    uint16_t quoteCount = 0;
+
+    uint8_t depth = 0;
+    uint16_t objectLevels = 0;   // 깊이별 컨테이너 종류 (비트 1 = 객체, 0 = 배열)
+    bool expectKey = false;
+    bool inString = false;
+    bool stringIsKey = false;
+    bool escaped = false;
+    bool inScalar = false;
+    bool done = false;
+    bool error = false;
+    Field field = NONE;
+
+    char token[TOKEN_SIZE];
+    uint8_t tokenLength = 0;
+    bool tokenOverflow = false;
+
+    bool inObject() const { return depth > 0 && (objectLevels & (1u << (depth - 1))); }
+    bool push(bool object);
+    bool pop(bool object);
+
+    void appendToken(char c);
+    void startToken();
+    void endString();
+    void endScalar();
+    void assign();
+    void process(char c);
+};
+
+#endif
@@ -0,0 +1,167 @@
+#
+# DEBUG_TRACE 바이너리 로그 디코더
+#
+# pip install pyserial
+# python trace_decode.py --elf build/firmware.elf --port /dev/ttyACM0
+# python trace_decode.py --elf build/firmware.elf --input capture.bin
+# python trace_decode.py --elf build/firmware.elf --list
+#
+# 일반 텍스트 로그는 그대로 출력하고, 0x00으로 시작하는 트레이스 프레임은
+# ELF의 포맷 문자열 테이블로 다시 문자열을 만든다.
+#   프레임: 0x00 | uint32 포맷 주소 | uint32 타임스탬프(us) | uint8 길이 | 인자
+#
+
+
+import argparse
+import re
+import struct
+import sys
+
+SHT_SYMTAB = 2
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+FORMAT_SPEC = re.compile(r'%([-+ #0]*\d*(?:\.\d+)?)(hh|h|ll|l|z|j|t)?([diouxXcsfFeEgGp%])')
+
+
+class FormatTable:
+    """펌웨어 ELF(32비트 리틀엔디언)에서 포맷 문자열을 주소로 찾는다."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.image = f.read()
+        if self.image[:4] != b'\x7fELF' or self.image[4] != 1:
+            raise ValueError('not a 32-bit ELF file: ' + path)
+
+        shoff, = struct.unpack_from('<I', self.image, 0x20)
+        shentsize, shnum = struct.unpack_from('<HH', self.image, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            (name, sh_type, flags, addr, offset, size,
+             link, info, align, entsize) = struct.unpack_from('<10I', self.image, shoff + i * shentsize)
+            self.sections.append((sh_type, flags, addr, offset, size, link, entsize))
+
+        # DEBUG_TRACE 매크로가 만든 static 변수(_traceFormat) 목록 = 빌드 시점의 포맷 테이블
+        self.formats = {}
+        for sh_type, _, _, offset, size, link, entsize in self.sections:
+            if sh_type != SHT_SYMTAB:
+                continue
+            strtab = self.sections[link]
+            for pos in range(offset, offset + size, entsize or 16):
+                st_name, st_value = struct.unpack_from('<II', self.image, pos)
+                if b'_traceFormat' in self._cstring(strtab[3] + st_name):
+                    text = self.lookup(st_value)
+                    if text is not None:
+                        self.formats[st_value] = text
+
+    def _cstring(self, offset):
+        end = self.image.find(b'\0', offset)
+        return self.image[offset:end]
+
+    def lookup(self, address):
+        if address in self.formats:
+            return self.formats[address]
+        # 심볼이 없는 빌드(strip 등)에서는 주소로 섹션 내용을 직접 읽는다
+        for sh_type, flags, addr, offset, size, _, _ in self.sections:
+            if flags & SHF_ALLOC and sh_type != SHT_NOBITS and addr <= address < addr + size:
+                return self._cstring(offset + address - addr).decode('utf-8', 'replace')
+        return None
+
+
+def format_args(fmt, payload):
+    """포맷 문자열의 변환 지정자 순서대로 payload에서 인자를 꺼내 Python % 포맷으로 출력."""
+    values = []
+    pos = 0
+
+    def convert(match):
+        nonlocal pos
+        flags, length, conv = match.groups()
+        if conv == '%':
+            return '%%'
+        if conv == 's':
+            n = payload[pos]
+            values.append(payload[pos + 1:pos + 1 + n].decode('utf-8', 'replace'))
+            pos += 1 + n
+        elif conv in 'fFeEgG':
+            values.append(struct.unpack_from('<f', payload, pos)[0])
+            pos += 4
+        elif length == 'll':
+            values.append(struct.unpack_from('<q' if conv in 'di' else '<Q', payload, pos)[0])
+            pos += 8
+        else:
+            values.append(struct.unpack_from('<i' if conv in 'di' else '<I', payload, pos)[0])
+            pos += 4
+        if conv == 'p':
+            return '0x%08x'
+        return '%' + flags + conv
+
+    try:
+        pattern = FORMAT_SPEC.sub(convert, fmt)
+        return pattern % tuple(values)
+    except (struct.error, IndexError, TypeError, ValueError):
+        return fmt + ' <bad args: ' + payload.hex() + '>'
+
+
+def decode(stream, table, out):
+    text = bytearray()
+    while True:
+        byte = stream.read(1)
+        if not byte:
+            break
+        if byte != b'\0':
+            text += byte
+            if byte == b'\n':
+                out.write(text.decode('utf-8', 'replace'))
+                out.flush()
+                text.clear()
+            continue
+
+        header = stream.read(9)
+        if len(header) < 9:
+            break
+        address, timestamp, length = struct.unpack('<IIB', header)
+        payload = stream.read(length)
+
+        fmt = table.lookup(address)
+        if fmt is None:
+            message = '<unknown trace 0x%08x: %s>' % (address, payload.hex())
+        else:
+            message = format_args(fmt, payload)
+        out.write('[%lu.%06lu] %s\n' % (timestamp // 1000000, timestamp % 1000000, message))
+        out.flush()
+
+    if text:
+        out.write(text.decode('utf-8', 'replace'))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode DEBUG_TRACE binary logs')
+    parser.add_argument('--elf', required=True, help='firmware ELF with the trace format table')
+    parser.add_argument('--port', help='serial port to read from')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--input', help='captured log file (default: stdin)')
+    parser.add_argument('--list', action='store_true', help='print the format table and exit')
+    args = parser.parse_args()
+
+    table = FormatTable(args.elf)
+    if args.list:
+        for address, fmt in sorted(table.formats.items()):
+            print('0x%08x  %r' % (address, fmt))
+        return
+
+    if args.port:
+        import serial
+        stream = serial.Serial(args.port, args.baud)
+    elif args.input:
+        stream = open(args.input, 'rb')
+    else:
+        stream = sys.stdin.buffer
+
+    try:
+        decode(stream, table, sys.stdout)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()